@@ -30,6 +30,7 @@
 
 // To be able to serialize XDMFEntry
 #include <boost/serialization/map.hpp>
+#include <boost/serialization/version.hpp>
 
 #include <limits>
 #include <ostream>
@@ -1224,6 +1225,22 @@ namespace DataOutBase
      */
     std::map<std::string, std::string> physical_units;
 
+    /**
+     * The number of significant bits with which the values of the data
+     * fields are written in VTU format. VTU files store data as 32-bit
+     * floating point numbers, which have 24 significant bits; this is also
+     * the default. Choosing a smaller number rounds each value to the given
+     * number of bits, e.g., 11 for the precision of a 16-bit floating point
+     * number. The values are still written as 32-bit numbers, but their
+     * trailing bits are zero, which makes the compressed output considerably
+     * smaller. This is useful for monitoring output of long-running
+     * computations where the full precision is not needed.
+     *
+     * The coordinates of the points are always written with full precision.
+     * This field is ignored for VTK file format.
+     */
+    unsigned int n_significant_bits;
+
     /**
      * Constructor. Initializes the member variables with names corresponding
      * to the argument names of this function.
@@ -1234,7 +1251,8 @@ namespace DataOutBase
       const bool             print_date_and_time = true,
       const CompressionLevel compression_level   = CompressionLevel::best_speed,
       const bool             write_higher_order_cells          = false,
-      const std::map<std::string, std::string> &physical_units = {});
+      const std::map<std::string, std::string> &physical_units = {},
+      const unsigned int                        n_significant_bits = 24);
   };
 
 
@@ -2415,6 +2433,35 @@ namespace DataOutBase
                       const std::string &solution_filename,
                       const MPI_Comm     comm);
 
+  /**
+   * Write the data in @p data_filter as one step of a time series to the
+   * HDF5 file @p filename. This is meant for computations on a mesh that
+   * does not change between the time steps: For the first step, i.e., if
+   * @p time_step is zero, the file is created and the mesh is written to
+   * it. For all later steps, the file is opened again and only the solution
+   * values are added, in a separate group for each time step. Thus, the
+   * mesh is stored only once for the whole time series. The data sets are
+   * stored in chunks and compressed as specified by @p flags, and written
+   * collectively by all processes in @p comm.
+   *
+   * XDMFEntry objects that describe the individual time steps can be created
+   * with DataOutInterface::create_xdmf_time_step_entry(), and a single XDMF
+   * file that indexes all time steps with
+   * DataOutInterface::write_xdmf_file().
+   *
+   * @note The patches and the data sets must be the same for all time steps,
+   *   except for the values of the data sets. Each time step can only be
+   *   written once.
+   */
+  template <int dim, int spacedim>
+  void
+  write_hdf5_time_step(const std::vector<Patch<dim, spacedim>> &patches,
+                       const DataOutFilter                     &data_filter,
+                       const DataOutBase::Hdf5Flags            &flags,
+                       const std::string                       &filename,
+                       const unsigned int                       time_step,
+                       const MPI_Comm                           comm);
+
   /**
    * DataOutFilter is an intermediate data format that reduces the amount of
    * data that will be written to files. The object filled by this function
@@ -2933,6 +2980,42 @@ public:
                   const std::string            &filename,
                   const MPI_Comm                comm) const;
 
+  /**
+   * Create an XDMFEntry for one time step written with
+   * write_hdf5_time_step(). Below is an example of how to write a time
+   * series on a fixed mesh, where the mesh is written only once:
+   *
+   * @code
+   * std::vector<XDMFEntry> xdmf_entries;
+   * for (unsigned int step = 0; step < n_steps; ++step)
+   *   {
+   *     // ... compute the solution and build the patches ...
+   *     DataOutBase::DataOutFilter data_filter(
+   *       DataOutBase::DataOutFilterFlags(true, true));
+   *     data_out.write_filtered_data(data_filter);
+   *     data_out.write_hdf5_time_step(data_filter,
+   *                                   "solution.h5",
+   *                                   step,
+   *                                   MPI_COMM_WORLD);
+   *     xdmf_entries.push_back(
+   *       data_out.create_xdmf_time_step_entry(data_filter,
+   *                                            "solution.h5",
+   *                                            step,
+   *                                            time,
+   *                                            MPI_COMM_WORLD));
+   *     data_out.write_xdmf_file(xdmf_entries,
+   *                              "solution.xdmf",
+   *                              MPI_COMM_WORLD);
+   *   }
+   * @endcode
+   */
+  XDMFEntry
+  create_xdmf_time_step_entry(const DataOutBase::DataOutFilter &data_filter,
+                              const std::string                &h5_filename,
+                              const unsigned int                time_step,
+                              const double                      cur_time,
+                              const MPI_Comm                    comm) const;
+
   /**
    * Write the data in @p data_filter to a single HDF5 file containing both the
    * mesh and solution values. Below is an example of how to use this function
@@ -2966,6 +3049,18 @@ public:
                       const std::string                &solution_filename,
                       const MPI_Comm                    comm) const;
 
+  /**
+   * Write the data in @p data_filter as one step of a time series to the
+   * HDF5 file @p filename, writing the mesh only for the first step. See
+   * DataOutBase::write_hdf5_time_step() and create_xdmf_time_step_entry()
+   * for more information.
+   */
+  void
+  write_hdf5_time_step(const DataOutBase::DataOutFilter &data_filter,
+                       const std::string                &filename,
+                       const unsigned int                time_step,
+                       const MPI_Comm                    comm) const;
+
   /**
    * DataOutFilter is an intermediate data format that reduces the amount of
    * data that will be written to files. The object filled by this function
@@ -3465,17 +3560,34 @@ public:
   void
   add_attribute(const std::string &attr_name, const unsigned int dimension);
 
+  /**
+   * Set the group within the HDF5 solution file that holds the attributes
+   * of this entry. By default, the attributes are stored at the root of the
+   * file. DataOutBase::write_hdf5_time_step() writes the data of each time
+   * step into a separate group.
+   */
+  void
+  set_solution_group(const std::string &group_name);
+
   /**
    * Read or write the data of this object for serialization using the
    * [BOOST serialization
    * library](https://www.boost.org/doc/libs/1_74_0/libs/serialization/doc/index.html).
+   *
+   * The group of the solution file was added in version 1 of the archive
+   * format. Archives of version 0 can still be read, and the attributes of
+   * such entries are stored at the root of the solution file.
    */
   template <class Archive>
   void
-  serialize(Archive &ar, const unsigned int /*version*/)
+  serialize(Archive &ar, const unsigned int version)
   {
     ar &valid &h5_sol_filename &h5_mesh_filename &entry_time &num_nodes
       &num_cells &dimension &space_dimension &cell_type &attribute_dims;
+    if (version > 0)
+      ar &h5_sol_group;
+    else
+      h5_sol_group.clear();
   }
 
   /**
@@ -3507,6 +3619,13 @@ private:
    */
   std::string h5_sol_filename;
 
+  /**
+   * The name of the group within the HDF5 solution file that holds the
+   * attributes, or an empty string if they are stored at the root of the
+   * file.
+   */
+  std::string h5_sol_group;
+
   /**
    * The name of the HDF5 mesh file this entry references.
    */
@@ -3591,4 +3710,7 @@ namespace DataOutBase
 
 DEAL_II_NAMESPACE_CLOSE
 
+// version 1 of the archive format adds the group of the solution file
+BOOST_CLASS_VERSION(dealii::XDMFEntry, 1)
+
 #endif
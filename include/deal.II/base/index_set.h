@@ -26,6 +26,7 @@
 #include <boost/container/small_vector.hpp>
 
 #include <algorithm>
+#include <cstdint>
 #include <vector>
 
 
@@ -63,6 +64,14 @@ DEAL_II_NAMESPACE_OPEN
  * The data structures used in this class along with a rationale can be found
  * in the
  * @ref distributed_paper "Distributed Computing paper".
+ *
+ * If a set consists of many small ranges that are close to each other, as is
+ * for example the case for the locally relevant degrees of freedom of
+ * fragmented subdomains, compress() additionally stores the set as a bitmap
+ * with the number of elements preceding each 64-bit word. The bitmap is only
+ * set up if it does not use more memory than the ranges, and it is used by
+ * is_element() and index_within_set() to answer queries for indices outside
+ * the largest range in constant time rather than with a binary search.
  */
 class IndexSet
 {
@@ -294,6 +303,21 @@ public:
   size_type
   index_within_set(const size_type global_index) const;
 
+  /**
+   * Compute index_within_set() for all entries of @p global_indices and
+   * store the result in @p local_indices, which is resized as necessary.
+   * If the global indices are sorted, all of them are found in a single pass
+   * over the ranges of this set, which is considerably cheaper than
+   * individual queries. Unsorted indices are allowed, but each index smaller
+   * than its predecessor triggers a binary search.
+   *
+   * Like the function above, this function requires the index set to be
+   * compressed.
+   */
+  void
+  index_within_set(const std::vector<size_type> &global_indices,
+                   std::vector<size_type>       &local_indices) const;
+
   /**
    * Each index set can be represented as the union of a number of contiguous
    * intervals of indices, where if necessary intervals may only consist of
@@ -621,7 +645,8 @@ public:
 
   /**
    * Determine an estimate for the memory consumption (in bytes) of this
-   * object.
+   * object. This includes the bitmap representation set up by compress(), if
+   * any.
    */
   std::size_t
   memory_consumption() const;
@@ -1109,6 +1134,33 @@ private:
    */
   mutable size_type largest_range;
 
+  /**
+   * The number of bits in each word of @p bitmap.
+   */
+  static constexpr unsigned int bits_per_word = 64;
+
+  /**
+   * An alternative representation of this set as a bitmap, in which bit
+   * <tt>i % bits_per_word</tt> of word <tt>i / bits_per_word</tt> is set if
+   * <tt>bitmap_start + i</tt> is an element of the set. The bitmap covers all
+   * indices between the first and the last element of the set. It is set up
+   * by do_compress() if the set consists of many ranges and the bitmap is not
+   * larger than @p ranges, and is empty otherwise.
+   */
+  mutable std::vector<std::uint64_t> bitmap;
+
+  /**
+   * The number of elements of this set that precede each word of @p bitmap,
+   * i.e., the value of index_within_set() for the first element in the word.
+   */
+  mutable std::vector<size_type> bitmap_n_preceding;
+
+  /**
+   * The index represented by the first bit of @p bitmap. This is a multiple
+   * of @p bits_per_word.
+   */
+  mutable size_type bitmap_start;
+
   /**
    * A mutex that is used to synchronize operations of the do_compress()
    * function that is called from many 'const' functions via compress().
@@ -1121,6 +1173,20 @@ private:
   void
   do_compress() const;
 
+  /**
+   * Set up @p bitmap and @p bitmap_n_preceding from @p ranges if the ranges
+   * are dense enough, or clear them otherwise. Called by do_compress().
+   */
+  void
+  setup_bitmap() const;
+
+  /**
+   * Release the memory of the bitmap representation, e.g. because the
+   * ranges have been changed.
+   */
+  void
+  clear_bitmap() const;
+
   /**
    * Expensive part of is_element() that does a binary search in case we did
    * not find the index in the largest range. Kept separate to avoid pulling
@@ -1643,6 +1709,7 @@ inline IndexSet::IndexSet()
   : is_compressed(true)
   , index_space_size(0)
   , largest_range(numbers::invalid_unsigned_int)
+  , bitmap_start(0)
 {}
 
 
@@ -1651,6 +1718,7 @@ inline IndexSet::IndexSet(const size_type size)
   : is_compressed(true)
   , index_space_size(size)
   , largest_range(numbers::invalid_unsigned_int)
+  , bitmap_start(0)
 {}
 
 
@@ -1660,11 +1728,16 @@ inline IndexSet::IndexSet(IndexSet &&is) noexcept
   , is_compressed(is.is_compressed)
   , index_space_size(is.index_space_size)
   , largest_range(is.largest_range)
+  , bitmap(std::move(is.bitmap))
+  , bitmap_n_preceding(std::move(is.bitmap_n_preceding))
+  , bitmap_start(is.bitmap_start)
 {
   is.ranges.clear();
   is.is_compressed    = true;
   is.index_space_size = 0;
   is.largest_range    = numbers::invalid_unsigned_int;
+  is.bitmap.clear();
+  is.bitmap_n_preceding.clear();
 
   compress();
 }
@@ -1674,15 +1747,20 @@ inline IndexSet::IndexSet(IndexSet &&is) noexcept
 inline IndexSet &
 IndexSet::operator=(IndexSet &&is) noexcept
 {
-  ranges           = std::move(is.ranges);
-  is_compressed    = is.is_compressed;
-  index_space_size = is.index_space_size;
-  largest_range    = is.largest_range;
+  ranges             = std::move(is.ranges);
+  is_compressed      = is.is_compressed;
+  index_space_size   = is.index_space_size;
+  largest_range      = is.largest_range;
+  bitmap             = std::move(is.bitmap);
+  bitmap_n_preceding = std::move(is.bitmap_n_preceding);
+  bitmap_start       = is.bitmap_start;
 
   is.ranges.clear();
   is.is_compressed    = true;
   is.index_space_size = 0;
   is.largest_range    = numbers::invalid_unsigned_int;
+  is.bitmap.clear();
+  is.bitmap_n_preceding.clear();
 
   compress();
 
@@ -1741,6 +1819,7 @@ IndexSet::clear()
   ranges.clear();
   is_compressed = true;
   largest_range = numbers::invalid_unsigned_int;
+  clear_bitmap();
 }
 
 
@@ -2105,6 +2184,11 @@ inline void
 IndexSet::serialize(Archive &ar, const unsigned int)
 {
   ar &ranges &is_compressed &index_space_size &largest_range;
+
+  // the bitmap representation is not stored, but set up again from the
+  // ranges
+  if (Archive::is_loading::value)
+    do_compress();
 }
 
 DEAL_II_NAMESPACE_CLOSE
@@ -925,6 +925,270 @@ namespace Utilities
                const MPI_Comm            mpi_communicator,
                const ArrayView<T>       &results);
 
+    /**
+     * A description of how the processes of an
+     * @ref GlossMPICommunicator "MPI communicator"
+     * are distributed among the compute nodes of a cluster. This information
+     * is used by the node-aware reduction functions node_aware_sum() and
+     * node_aware_max(), which first combine the contributions of the
+     * processes within a node, then exchange the partial results among one
+     * "leader" process per node, and finally broadcast the result within the
+     * node again. On machines with many processes per node, this replaces a
+     * reduction over all processes by one over the (much smaller) number of
+     * nodes, which reduces the latency of the operation.
+     *
+     * Objects of this type are created by get_node_topology() and remain
+     * valid as long as the communicator they describe.
+     */
+    struct NodeTopology
+    {
+      /**
+       * The communicator described by this object.
+       */
+      MPI_Comm communicator;
+
+      /**
+       * The communicator of the processes that share the memory of the
+       * compute node of the current process, as created by
+       * <code>MPI_Comm_split_type(..., MPI_COMM_TYPE_SHARED, ...)</code>.
+       */
+      MPI_Comm node_communicator;
+
+      /**
+       * The communicator between the first process of each node (the rank
+       * zero of @p node_communicator). Set to MPI_COMM_NULL on all other
+       * processes.
+       */
+      MPI_Comm leader_communicator;
+
+      /**
+       * The number of compute nodes spanned by the communicator.
+       */
+      unsigned int n_nodes;
+
+      /**
+       * Whether a two-level reduction is expected to be faster than a flat
+       * one, i.e., whether the communicator spans more than one node and at
+       * least one of the nodes hosts more than one process.
+       */
+      bool use_hierarchical_reductions;
+    };
+
+    /**
+     * Return the node topology of the communicator @p mpi_communicator.
+     *
+     * The sub-communicators are created upon the first call for a given
+     * communicator, which is a collective operation, and are cached as an
+     * attribute of @p mpi_communicator (see <code>MPI_Comm_set_attr</code>).
+     * Subsequent calls hence do not communicate. The cached data is released
+     * automatically once @p mpi_communicator is freed.
+     *
+     * Looking up the cached attribute requires a lock, so classes that
+     * reduce over the same communicator many times, such as
+     * Utilities::MPI::Partitioner, keep a reference to the returned object
+     * and pass it to the variants of node_aware_sum() and node_aware_max()
+     * that take a NodeTopology argument.
+     */
+    const NodeTopology &
+    get_node_topology(const MPI_Comm mpi_communicator);
+
+    /**
+     * Return the sum over all processors of the value @p t, like sum(), but
+     * use a node-aware two-level algorithm if get_node_topology() indicates
+     * that this is beneficial for @p mpi_communicator. Otherwise, this
+     * function falls back to a plain <code>MPI_Allreduce</code>.
+     *
+     * This function is used for the reductions in dot products and norms of
+     * the parallel vector classes and the Krylov solvers built upon them.
+     *
+     * @note The result is the same on all processes, but the order in which
+     * the contributions are added differs from the one of sum(). For
+     * floating point numbers, the two results can therefore differ in the
+     * last digits.
+     *
+     * @note The type T must be a data type supported by MPI or a
+     * std::complex of such a type.
+     */
+    template <typename T>
+    T
+    node_aware_sum(const T &t, const MPI_Comm mpi_communicator);
+
+    /**
+     * Like the previous function, but take the sums over the elements of an
+     * array as specified by the ArrayView arguments, like the corresponding
+     * version of sum().
+     *
+     * Input and output arrays may be the same.
+     */
+    template <typename T>
+    void
+    node_aware_sum(const ArrayView<const T> &values,
+                   const MPI_Comm            mpi_communicator,
+                   const ArrayView<T>       &sums);
+
+    /**
+     * Return the maximum over all processors of the value @p t, like max(),
+     * but with the node-aware algorithm described for node_aware_sum().
+     */
+    template <typename T>
+    T
+    node_aware_max(const T &t, const MPI_Comm mpi_communicator);
+
+    /**
+     * Like node_aware_sum(), but take the node topology of the communicator
+     * as previously obtained by get_node_topology(), which avoids looking it
+     * up again.
+     */
+    template <typename T>
+    T
+    node_aware_sum(const T &t, const NodeTopology &topology);
+
+    /**
+     * Like node_aware_sum() for arrays, but take the node topology of the
+     * communicator as previously obtained by get_node_topology().
+     */
+    template <typename T>
+    void
+    node_aware_sum(const ArrayView<const T> &values,
+                   const NodeTopology       &topology,
+                   const ArrayView<T>       &sums);
+
+    /**
+     * Like node_aware_max(), but take the node topology of the communicator
+     * as previously obtained by get_node_topology().
+     */
+    template <typename T>
+    T
+    node_aware_max(const T &t, const NodeTopology &topology);
+
+    /**
+     * A class that collects the local contributions to several sums over
+     * all processes of a communicator, and computes all of these sums with a
+     * single reduction operation. Iterative solvers often need two or three
+     * inner products at the same point of the algorithm; computing them with
+     * one message instead of one message each reduces the number of global
+     * synchronization points, which dominate the cost of these operations
+     * on large machines.
+     *
+     * The typical use is as follows:
+     * @code
+     * Utilities::MPI::ReductionBatch<double> batch(mpi_communicator);
+     * const unsigned int index_0 = batch.add(local_sum_0);
+     * const unsigned int index_1 = batch.add(local_sum_1);
+     * batch.compute();
+     * const double sum_0 = batch[index_0];
+     * const double sum_1 = batch[index_1];
+     * @endcode
+     *
+     * The reduction can also be done with a non-blocking
+     * <code>MPI_Iallreduce</code> by calling compute_start() and
+     * compute_finish() instead of compute(), in order to overlap the
+     * communication with other work.
+     *
+     * Further sums can be added after a reduction. The next reduction then
+     * only computes the sums added since the previous one, while the results
+     * of the earlier sums remain available.
+     *
+     * See InnerProductBatch for a class that collects inner products of
+     * vectors.
+     */
+    template <typename T>
+    class ReductionBatch
+    {
+    public:
+      /**
+       * Constructor. The sums are taken over all processes of
+       * @p mpi_communicator.
+       */
+      explicit ReductionBatch(const MPI_Comm mpi_communicator);
+
+      /**
+       * Destructor. Waits for an outstanding non-blocking reduction.
+       */
+      ~ReductionBatch();
+
+      /**
+       * Add the contribution @p local_value of the current process to a new
+       * sum, and return the index under which the sum can be queried after
+       * the reduction. The indices are assigned consecutively, starting at
+       * zero.
+       */
+      unsigned int
+      add(const T &local_value);
+
+      /**
+       * Compute all sums added since the last reduction with one reduction
+       * operation. This is a collective operation that needs to be called by
+       * all processes of the communicator, after they have called add() the
+       * same number of times.
+       */
+      void
+      compute();
+
+      /**
+       * Start the computation of all sums added since the last reduction
+       * with a non-blocking reduction. The results are available after
+       * compute_finish() has been called.
+       */
+      void
+      compute_start();
+
+      /**
+       * Wait for the non-blocking reduction started by compute_start().
+       */
+      void
+      compute_finish();
+
+      /**
+       * Return the sum with the given @p index over all processes.
+       *
+       * @pre compute(), or compute_start() and compute_finish(), must have
+       * been called after the call to add() that returned @p index.
+       */
+      const T &
+      operator[](const unsigned int index) const;
+
+      /**
+       * Return the number of sums collected in this object.
+       */
+      unsigned int
+      size() const;
+
+      /**
+       * Remove all sums, such that the object can be used for a new batch.
+       */
+      void
+      clear();
+
+    private:
+      /**
+       * The communicator over which the sums are taken.
+       */
+      const MPI_Comm mpi_communicator;
+
+      /**
+       * The local contributions before, and the sums after the reduction.
+       */
+      std::vector<T> values;
+
+      /**
+       * The request of a non-blocking reduction.
+       */
+      MPI_Request request;
+
+      /**
+       * Whether a non-blocking reduction is in progress.
+       */
+      bool reduction_in_progress;
+
+      /**
+       * The number of leading entries of @p values that hold reduced values.
+       * The entries behind them are local contributions that have not been
+       * reduced yet.
+       */
+      unsigned int n_reduced;
+    };
+
     /**
      * A data structure to store the result of the min_max_avg() function.
      * The structure stores the minimum, maximum, and average of one
@@ -1743,6 +2007,15 @@ namespace Utilities
                  const ArrayView<const T> &values,
                  const MPI_Comm            mpi_communicator,
                  const ArrayView<T>       &output);
+
+      // declaration for an internal function that lives in mpi.templates.h:
+      // a reduction along the sub-communicators given by @p topology
+      template <typename T>
+      void
+      hierarchical_all_reduce(const MPI_Op             &mpi_op,
+                              const ArrayView<const T> &values,
+                              const NodeTopology       &topology,
+                              const ArrayView<T>       &output);
     } // namespace internal
 
 
@@ -1802,6 +2075,143 @@ namespace Utilities
 
 
 
+    template <typename T>
+    inline ReductionBatch<T>::ReductionBatch(const MPI_Comm mpi_communicator)
+      : mpi_communicator(mpi_communicator)
+      , request(MPI_REQUEST_NULL)
+      , reduction_in_progress(false)
+      , n_reduced(0)
+    {}
+
+
+
+    template <typename T>
+    inline ReductionBatch<T>::~ReductionBatch()
+    {
+      if (reduction_in_progress)
+        {
+          try
+            {
+              compute_finish();
+            }
+          catch (...)
+            {}
+        }
+    }
+
+
+
+    template <typename T>
+    inline unsigned int
+    ReductionBatch<T>::add(const T &local_value)
+    {
+      Assert(reduction_in_progress == false,
+             ExcMessage("You can't add values while a reduction is in "
+                        "progress."));
+      values.push_back(local_value);
+      return values.size() - 1;
+    }
+
+
+
+    template <typename T>
+    inline void
+    ReductionBatch<T>::compute()
+    {
+      Assert(reduction_in_progress == false,
+             ExcMessage("A non-blocking reduction is in progress."));
+      const unsigned int n_new = values.size() - n_reduced;
+      if (n_new > 0 && job_supports_mpi() &&
+          n_mpi_processes(mpi_communicator) > 1)
+        node_aware_sum(ArrayView<const T>(values.data() + n_reduced, n_new),
+                       mpi_communicator,
+                       ArrayView<T>(values.data() + n_reduced, n_new));
+      n_reduced = values.size();
+    }
+
+
+
+    template <typename T>
+    inline void
+    ReductionBatch<T>::compute_start()
+    {
+      Assert(reduction_in_progress == false,
+             ExcMessage("A non-blocking reduction is already in progress."));
+#ifdef DEAL_II_WITH_MPI
+      const unsigned int n_new = values.size() - n_reduced;
+      if (n_new > 0 && job_supports_mpi() &&
+          n_mpi_processes(mpi_communicator) > 1)
+        {
+          const int ierr = MPI_Iallreduce(MPI_IN_PLACE,
+                                          values.data() + n_reduced,
+                                          n_new,
+                                          mpi_type_id_for_type<T>,
+                                          MPI_SUM,
+                                          mpi_communicator,
+                                          &request);
+          AssertThrowMPI(ierr);
+          reduction_in_progress = true;
+          return;
+        }
+#endif
+      n_reduced = values.size();
+    }
+
+
+
+    template <typename T>
+    inline void
+    ReductionBatch<T>::compute_finish()
+    {
+#ifdef DEAL_II_WITH_MPI
+      if (reduction_in_progress)
+        {
+          reduction_in_progress = false;
+          const int ierr        = MPI_Wait(&request, MPI_STATUS_IGNORE);
+          AssertThrowMPI(ierr);
+        }
+#endif
+      // add() is not allowed while the reduction is in progress, so all
+      // entries are reduced now
+      n_reduced = values.size();
+    }
+
+
+
+    template <typename T>
+    inline const T &
+    ReductionBatch<T>::operator[](const unsigned int index) const
+    {
+      AssertIndexRange(index, values.size());
+      Assert(index < n_reduced,
+             ExcMessage("You need to call compute() before accessing the "
+                        "results."));
+      return values[index];
+    }
+
+
+
+    template <typename T>
+    inline unsigned int
+    ReductionBatch<T>::size() const
+    {
+      return values.size();
+    }
+
+
+
+    template <typename T>
+    inline void
+    ReductionBatch<T>::clear()
+    {
+      Assert(reduction_in_progress == false,
+             ExcMessage("A non-blocking reduction is in progress."));
+      values.clear();
+      n_reduced = 0;
+    }
+
+
+
     template <typename T, unsigned int N>
     void
     sum(const T (&values)[N], const MPI_Comm mpi_communicator, T (&sums)[N])
@@ -135,6 +135,77 @@ namespace Utilities
               std::copy(values.begin(), values.end(), output.begin());
           }
       }
+
+
+      template <typename T>
+      void
+      hierarchical_all_reduce(const MPI_Op             &mpi_op,
+                              const ArrayView<const T> &values,
+                              const NodeTopology       &topology,
+                              const ArrayView<T>       &output)
+      {
+        AssertDimension(values.size(), output.size());
+#ifdef DEAL_II_WITH_MPI
+        if (job_supports_mpi())
+          {
+            // complex numbers are reduced as pairs of real numbers, which is
+            // only valid for the sum
+            using value_type = typename numbers::NumberTraits<T>::real_type;
+            const int n_entries =
+              values.size() * (numbers::NumberTraits<T>::is_complex ? 2 : 1);
+            const MPI_Datatype datatype = mpi_type_id_for_type<value_type>;
+            Assert(numbers::NumberTraits<T>::is_complex == false ||
+                     mpi_op == MPI_SUM,
+                   ExcNotImplemented());
+
+            // step 1: reduce the contributions of the processes on each node
+            // to the first process of the node
+            const bool is_leader =
+              this_mpi_process(topology.node_communicator) == 0;
+            int ierr =
+              MPI_Reduce((is_leader && values == output) ?
+                           MPI_IN_PLACE :
+                           static_cast<const void *>(values.data()),
+                         static_cast<void *>(output.data()),
+                         n_entries,
+                         datatype,
+                         mpi_op,
+                         0,
+                         topology.node_communicator);
+            AssertThrowMPI(ierr);
+
+            // step 2: reduce the partial results of the nodes among the
+            // leaders
+            if (is_leader)
+              {
+                Assert(topology.leader_communicator != MPI_COMM_NULL,
+                       ExcInternalError());
+                ierr = MPI_Allreduce(MPI_IN_PLACE,
+                                     static_cast<void *>(output.data()),
+                                     n_entries,
+                                     datatype,
+                                     mpi_op,
+                                     topology.leader_communicator);
+                AssertThrowMPI(ierr);
+              }
+
+            // step 3: distribute the result within each node
+            ierr = MPI_Bcast(static_cast<void *>(output.data()),
+                             n_entries,
+                             datatype,
+                             0,
+                             topology.node_communicator);
+            AssertThrowMPI(ierr);
+          }
+        else
+#endif
+          {
+            (void)mpi_op;
+            (void)topology;
+            if (values != output)
+              std::copy(values.begin(), values.end(), output.begin());
+          }
+      }
     } // namespace internal
 
 
@@ -394,6 +465,83 @@ namespace Utilities
 
 
 
+    template <typename T>
+    T
+    node_aware_sum(const T &t, const MPI_Comm mpi_communicator)
+    {
+      return node_aware_sum(t, get_node_topology(mpi_communicator));
+    }
+
+
+
+    template <typename T>
+    void
+    node_aware_sum(const ArrayView<const T> &values,
+                   const MPI_Comm            mpi_communicator,
+                   const ArrayView<T>       &sums)
+    {
+      node_aware_sum(values, get_node_topology(mpi_communicator), sums);
+    }
+
+
+
+    template <typename T>
+    T
+    node_aware_max(const T &t, const MPI_Comm mpi_communicator)
+    {
+      return node_aware_max(t, get_node_topology(mpi_communicator));
+    }
+
+
+
+    template <typename T>
+    T
+    node_aware_sum(const T &t, const NodeTopology &topology)
+    {
+      T return_value{};
+      node_aware_sum(ArrayView<const T>(&t, 1),
+                     topology,
+                     ArrayView<T>(&return_value, 1));
+      return return_value;
+    }
+
+
+
+    template <typename T>
+    void
+    node_aware_sum(const ArrayView<const T> &values,
+                   const NodeTopology       &topology,
+                   const ArrayView<T>       &sums)
+    {
+      if (topology.use_hierarchical_reductions)
+        internal::hierarchical_all_reduce(MPI_SUM, values, topology, sums);
+      else
+        internal::all_reduce(MPI_SUM, values, topology.communicator, sums);
+    }
+
+
+
+    template <typename T>
+    T
+    node_aware_max(const T &t, const NodeTopology &topology)
+    {
+      T return_value{};
+
+      if (topology.use_hierarchical_reductions)
+        internal::hierarchical_all_reduce(MPI_MAX,
+                                          ArrayView<const T>(&t, 1),
+                                          topology,
+                                          ArrayView<T>(&return_value, 1));
+      else
+        internal::all_reduce(MPI_MAX,
+                             ArrayView<const T>(&t, 1),
+                             topology.communicator,
+                             ArrayView<T>(&return_value, 1));
+      return return_value;
+    }
+
+
+
     template <typename T>
     T
     reduce(const T                                      &vec,
@@ -22,6 +22,8 @@
 #include <deal.II/base/mpi.templates.h>
 #include <deal.II/base/mpi_tags.h>
 
+#include <chrono>
+
 DEAL_II_NAMESPACE_OPEN
 
 
@@ -112,6 +114,13 @@ namespace Utilities
      * in an MPI universe, since some implementations are better or worse
      * suited for large or small parallel computations.
      *
+     * If a consensus algorithm is called repeatedly with the same targets,
+     * the neighbor_graph() function can be used instead. It stores the
+     * communication pattern found by the NBX algorithm in a
+     * NeighborGraphCache object and re-uses it in subsequent calls, with
+     * neighborhood collectives on an MPI communicator with a graph topology,
+     * as long as the targets do not change on any process.
+     *
      * This namespace also implements specializations of each of the
      * functions for the specific case where a calling process is not
      * actually interested in receiving and processing answers -- that
@@ -1038,6 +1047,295 @@ namespace Utilities
         const MPI_Comm comm);
 
 
+      /**
+       * A class that stores the communication pattern set up by a consensus
+       * algorithm, i.e., the ranks of the processes a process sends requests
+       * to (the targets) and the ranks of the processes it receives requests
+       * from (the sources), in terms of an MPI communicator with a distributed
+       * graph topology, see MPI_Dist_graph_create_adjacent(). The graph
+       * connects each process with the union of its targets and sources.
+       *
+       * Objects of this class are used by the NeighborGraph implementation of
+       * the consensus algorithms: Many algorithms call a consensus algorithm
+       * repeatedly with the same targets on all processes, for example when
+       * the points of Utilities::MPI::RemotePointEvaluation are re-located
+       * after a small deformation of the mesh. In that case, the sources do not
+       * change either, and the requests and answers can be exchanged with
+       * MPI_Neighbor_alltoallv() on the graph communicator rather than by
+       * the non-blocking point-to-point messages and the barrier of the NBX
+       * algorithm.
+       *
+       * Whether the stored pattern can be re-used is decided by a single
+       * global reduction, since all processes need to agree on it. If the
+       * targets change on any process, the NBX algorithm is run again to
+       * determine the new sources, and the graph communicator is re-created.
+       *
+       * The class keeps track of how often the pattern had to be set up and
+       * how often it could be re-used, together with the time spent in either
+       * case, see get_statistics().
+       */
+      class NeighborGraphCache
+      {
+      public:
+        /**
+         * Statistics collected by the NeighborGraph algorithm over all
+         * exchanges performed with a cache object.
+         */
+        struct Statistics
+        {
+          /**
+           * Number of exchanges for which the communication pattern had to
+           * be set up, i.e., which were performed by the NBX algorithm.
+           */
+          unsigned int n_setups = 0;
+
+          /**
+           * Number of exchanges that re-used the stored communication
+           * pattern.
+           */
+          unsigned int n_reuses = 0;
+
+          /**
+           * Accumulated wall time (in seconds) of the exchanges that set up
+           * the communication pattern, including the creation of the graph
+           * communicator.
+           */
+          double setup_time = 0.;
+
+          /**
+           * Accumulated wall time (in seconds) of the exchanges that re-used
+           * the communication pattern, including the reduction that checks
+           * the validity of the pattern.
+           */
+          double reuse_time = 0.;
+
+          /**
+           * Return an estimate for the wall time (in seconds) saved by
+           * re-using the communication pattern, computed as the number of
+           * re-uses times the difference between the average time of an
+           * exchange with and without set up of the pattern. Zero is returned
+           * as long as no timings of both kinds are available.
+           */
+          double
+          estimated_time_saved() const;
+        };
+
+        /**
+         * Constructor. The object does not store any communication pattern
+         * until it is set up by the first exchange.
+         */
+        NeighborGraphCache();
+
+        /**
+         * Destructor. Frees the graph communicator.
+         */
+        ~NeighborGraphCache();
+
+        /**
+         * Since the object owns an MPI communicator, it may not be copied.
+         */
+        NeighborGraphCache(const NeighborGraphCache &) = delete;
+
+        /**
+         * Since the object owns an MPI communicator, it may not be copied.
+         */
+        NeighborGraphCache &
+        operator=(const NeighborGraphCache &) = delete;
+
+        /**
+         * Return whether the stored communication pattern has been set up
+         * for the given @p targets on the communicator @p comm on all
+         * processes of @p comm.
+         *
+         * @note This is a collective operation on @p comm. Communicators are
+         *   compared by their handles, so the pattern of a communicator that
+         *   has been freed might be re-used for a new communicator that
+         *   obtained the same handle; call clear() after freeing the
+         *   communicator if this is a concern.
+         */
+        bool
+        is_up_to_date(const std::vector<unsigned int> &targets,
+                      const MPI_Comm                   comm) const;
+
+        /**
+         * Store the communication pattern given by @p targets and @p sources
+         * and create the graph communicator. This is a collective operation
+         * on @p comm.
+         */
+        void
+        reinit(const std::vector<unsigned int> &targets,
+               const std::vector<unsigned int> &sources,
+               const MPI_Comm                   comm);
+
+        /**
+         * Free the graph communicator and forget the stored communication
+         * pattern. The statistics are not reset.
+         */
+        void
+        clear();
+
+        /**
+         * Return the sorted list of ranks this process sends requests to.
+         */
+        const std::vector<unsigned int> &
+        get_targets() const;
+
+        /**
+         * Return the sorted list of ranks this process receives requests
+         * from.
+         */
+        const std::vector<unsigned int> &
+        get_sources() const;
+
+        /**
+         * Return the sorted union of the targets and the sources, which
+         * defines the order of the buffers passed to and returned by
+         * exchange().
+         */
+        const std::vector<unsigned int> &
+        get_neighbors() const;
+
+        /**
+         * Return the position of the rank @p rank within get_neighbors().
+         */
+        unsigned int
+        neighbor_index(const unsigned int rank) const;
+
+        /**
+         * Send the buffer `send_buffers[i]` to the process
+         * `get_neighbors()[i]` and return the buffers received from the
+         * neighbors, in the same order, using neighborhood collectives on the
+         * graph communicator. Empty buffers are sent to neighbors that do not
+         * need to receive any data. This is a collective operation on the
+         * communicator the pattern has been set up for.
+         */
+        std::vector<std::vector<char>>
+        exchange(const std::vector<std::vector<char>> &send_buffers) const;
+
+        /**
+         * Return the statistics collected so far.
+         */
+        const Statistics &
+        get_statistics() const;
+
+      private:
+        /**
+         * The communicator the pattern has been set up for.
+         */
+        MPI_Comm communicator;
+
+        /**
+         * The communicator with the distributed graph topology.
+         */
+        MPI_Comm graph_communicator;
+
+        /**
+         * The sorted list of targets.
+         */
+        std::vector<unsigned int> targets;
+
+        /**
+         * The sorted list of sources.
+         */
+        std::vector<unsigned int> sources;
+
+        /**
+         * The sorted union of targets and sources.
+         */
+        std::vector<unsigned int> neighbors;
+
+        /**
+         * The statistics, updated by NeighborGraph::run().
+         */
+        Statistics statistics;
+
+        template <typename RequestType, typename AnswerType>
+        friend class NeighborGraph;
+      };
+
+
+
+      /**
+       * An implementation of the Interface base class that re-uses the
+       * communication pattern of the previous exchange stored in a
+       * NeighborGraphCache object if the targets have not changed on any
+       * process. In that case, the requests and answers are exchanged by two
+       * neighborhood collectives on the graph communicator of the cache.
+       * Otherwise, the NBX algorithm is used and the resulting pattern is
+       * stored in the cache for subsequent calls.
+       *
+       * On a single process, the work is delegated to the Serial class and
+       * the cache is not used.
+       *
+       * @tparam RequestType The type of the elements of the vector to be sent.
+       * @tparam AnswerType The type of the elements of the vector to be received.
+       */
+      template <typename RequestType, typename AnswerType>
+      class NeighborGraph : public Interface<RequestType, AnswerType>
+      {
+      public:
+        /**
+         * Constructor. The @p cache object has to remain alive as long as this
+         * object is used.
+         */
+        NeighborGraph(NeighborGraphCache &cache);
+
+        /**
+         * Destructor.
+         */
+        virtual ~NeighborGraph() = default;
+
+        // Import the declarations from the base class.
+        using Interface<RequestType, AnswerType>::run;
+
+        /**
+         * @copydoc Interface::run()
+         */
+        virtual std::vector<unsigned int>
+        run(
+          const std::vector<unsigned int>                      &targets,
+          const std::function<RequestType(const unsigned int)> &create_request,
+          const std::function<AnswerType(const unsigned int,
+                                         const RequestType &)> &answer_request,
+          const std::function<void(const unsigned int, const AnswerType &)>
+                        &process_answer,
+          const MPI_Comm comm) override;
+
+      private:
+        /**
+         * The cache of the communication pattern.
+         */
+        NeighborGraphCache &cache;
+      };
+
+
+
+      /**
+       * This function implements a concrete algorithm for the
+       * consensus algorithms problem (see the documentation of the
+       * surrounding namespace), using the communication pattern stored in
+       * @p cache if the targets have not changed on any process since the
+       * previous call with the same cache object, and the NBX algorithm
+       * otherwise. See the NeighborGraph class for details.
+       *
+       * The arguments besides @p cache have the same meaning as for the
+       * selector() function, and the same restrictions regarding exceptions
+       * thrown by the function objects apply.
+       */
+      template <typename RequestType, typename AnswerType>
+      std::vector<unsigned int>
+      neighbor_graph(
+        NeighborGraphCache                                   &cache,
+        const std::vector<unsigned int>                      &targets,
+        const std::function<RequestType(const unsigned int)> &create_request,
+        const std::function<AnswerType(const unsigned int, const RequestType &)>
+          &answer_request,
+        const std::function<void(const unsigned int, const AnswerType &)>
+                      &process_answer,
+        const MPI_Comm comm);
+
+
+
 
 #ifndef DOXYGEN
       // Implementation of the functions in this namespace.
@@ -1252,6 +1550,24 @@ namespace Utilities
           comm);
       }
 
+
+      template <typename RequestType, typename AnswerType>
+      std::vector<unsigned int>
+      neighbor_graph(
+        NeighborGraphCache                                   &cache,
+        const std::vector<unsigned int>                      &targets,
+        const std::function<RequestType(const unsigned int)> &create_request,
+        const std::function<AnswerType(const unsigned int, const RequestType &)>
+          &answer_request,
+        const std::function<void(const unsigned int, const AnswerType &)>
+                      &process_answer,
+        const MPI_Comm comm)
+      {
+        return NeighborGraph<RequestType, AnswerType>(cache).run(
+          targets, create_request, answer_request, process_answer, comm);
+      }
+
+
 #endif
 
 
@@ -2170,6 +2486,121 @@ namespace Utilities
       }
 
 
+      template <typename RequestType, typename AnswerType>
+      NeighborGraph<RequestType, AnswerType>::NeighborGraph(
+        NeighborGraphCache &cache)
+        : cache(cache)
+      {}
+
+
+
+      template <typename RequestType, typename AnswerType>
+      std::vector<unsigned int>
+      NeighborGraph<RequestType, AnswerType>::run(
+        const std::vector<unsigned int>                      &targets,
+        const std::function<RequestType(const unsigned int)> &create_request,
+        const std::function<AnswerType(const unsigned int, const RequestType &)>
+          &answer_request,
+        const std::function<void(const unsigned int, const AnswerType &)>
+                      &process_answer,
+        const MPI_Comm comm)
+      {
+        Assert(has_unique_elements(targets),
+               ExcMessage("The consensus algorithms expect that each process "
+                          "only sends a single message to another process, "
+                          "but the targets provided include duplicates."));
+
+        const unsigned int n_procs = (Utilities::MPI::job_supports_mpi() ?
+                                        Utilities::MPI::n_mpi_processes(comm) :
+                                        1);
+        if (n_procs == 1)
+          return Serial<RequestType, AnswerType>().run(
+            targets, create_request, answer_request, process_answer, comm);
+
+        static CollectiveMutex      mutex;
+        CollectiveMutex::ScopedLock lock(mutex, comm);
+
+        std::vector<unsigned int> sources;
+
+        try
+          {
+            const auto start_time = std::chrono::steady_clock::now();
+
+            if (cache.is_up_to_date(targets, comm))
+              {
+                // 1) Send the requests to the targets. The slots of all other
+                //    neighbors remain empty.
+                std::vector<std::vector<char>> send_buffers(
+                  cache.get_neighbors().size());
+                if (create_request)
+                  for (const unsigned int target : targets)
+                    send_buffers[cache.neighbor_index(target)] =
+                      Utilities::pack(create_request(target), false);
+
+                std::vector<std::vector<char>> recv_buffers =
+                  cache.exchange(send_buffers);
+
+                // 2) Answer the requests of the sources and send the answers
+                //    back.
+                for (auto &buffer : send_buffers)
+                  buffer.clear();
+                if (answer_request)
+                  for (const unsigned int source : cache.get_sources())
+                    {
+                      const unsigned int index = cache.neighbor_index(source);
+                      send_buffers[index] = Utilities::pack(
+                        answer_request(source,
+                                       Utilities::unpack<RequestType>(
+                                         recv_buffers[index], false)),
+                        false);
+                    }
+
+                recv_buffers = cache.exchange(send_buffers);
+
+                // 3) Process the answers of the targets.
+                if (process_answer)
+                  for (const unsigned int target : targets)
+                    process_answer(
+                      target,
+                      Utilities::unpack<AnswerType>(
+                        recv_buffers[cache.neighbor_index(target)], false));
+
+                sources = cache.get_sources();
+
+                ++cache.statistics.n_reuses;
+                cache.statistics.reuse_time +=
+                  std::chrono::duration<double>(
+                    std::chrono::steady_clock::now() - start_time)
+                    .count();
+              }
+            else
+              {
+                // The pattern has changed on at least one process: determine
+                // the sources with the NBX algorithm, which also performs the
+                // exchange, and store the new pattern.
+                sources = NBX<RequestType, AnswerType>().run(targets,
+                                                             create_request,
+                                                             answer_request,
+                                                             process_answer,
+                                                             comm);
+                cache.reinit(targets, sources, comm);
+
+                ++cache.statistics.n_setups;
+                cache.statistics.setup_time +=
+                  std::chrono::duration<double>(
+                    std::chrono::steady_clock::now() - start_time)
+                    .count();
+              }
+          }
+        catch (...)
+          {
+            handle_exception(std::current_exception(), comm);
+          }
+
+        return sources;
+      }
+
+
     } // namespace ConsensusAlgorithms
   }   // end of namespace MPI
 } // end of namespace Utilities
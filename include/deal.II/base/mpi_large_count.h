@@ -336,6 +336,56 @@ namespace Utilities
         return MPI_SUCCESS;
       }
 
+      /**
+       * Start to collectively write a possibly large @p count of data at the
+       * location @p offset. The operation is completed by waiting on
+       * @p request, and @p buf must not be modified before that.
+       *
+       * Nonblocking collective file operations are only available since
+       * MPI 3.1. For older MPI versions, the data is written with a blocking
+       * call and @p request is set to <tt>MPI_REQUEST_NULL</tt>.
+       *
+       * See the MPI 4.x standard for details.
+       */
+      inline int
+      File_iwrite_at_all_c(MPI_File     fh,
+                           MPI_Offset   offset,
+                           const void  *buf,
+                           MPI_Count    count,
+                           MPI_Datatype datatype,
+                           MPI_Request *request)
+      {
+#  if MPI_VERSION > 3 || (MPI_VERSION == 3 && MPI_SUBVERSION >= 1)
+        if (count <= LargeCount::mpi_max_int_count)
+          return MPI_File_iwrite_at_all(
+            fh, offset, buf, count, datatype, request);
+
+        MPI_Datatype bigtype;
+        int          ierr;
+        ierr = Type_contiguous_c(count, datatype, &bigtype);
+        if (ierr != MPI_SUCCESS)
+          return ierr;
+        ierr = MPI_Type_commit(&bigtype);
+        if (ierr != MPI_SUCCESS)
+          return ierr;
+
+        ierr = MPI_File_iwrite_at_all(fh, offset, buf, 1, bigtype, request);
+        if (ierr != MPI_SUCCESS)
+          return ierr;
+
+        // Freeing the datatype only marks it for deallocation, the pending
+        // operation can still use it.
+        ierr = MPI_Type_free(&bigtype);
+        if (ierr != MPI_SUCCESS)
+          return ierr;
+        return MPI_SUCCESS;
+#  else
+        *request = MPI_REQUEST_NULL;
+        return File_write_at_all_c(
+          fh, offset, buf, count, datatype, MPI_STATUS_IGNORE);
+#  endif
+      }
+
       /**
        * Collectively write a possibly large @p count of data in order.
        *
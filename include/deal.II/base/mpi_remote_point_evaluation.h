@@ -35,6 +35,17 @@ namespace GridTools
   }
 } // namespace GridTools
 
+namespace Utilities
+{
+  namespace MPI
+  {
+    namespace ConsensusAlgorithms
+    {
+      class NeighborGraphCache;
+    }
+  } // namespace MPI
+} // namespace Utilities
+
 namespace Utilities
 {
   namespace MPI
@@ -310,6 +321,18 @@ namespace Utilities
       bool
       is_ready() const;
 
+      /**
+       * Return the object that stores the communication pattern used to
+       * determine the owners of the points in reinit(). If the points are
+       * re-located, e.g., after a deformation of the mesh, and the potential
+       * owners of the points have not changed on any process, the pattern
+       * of the previous call to reinit() is re-used. The statistics of the
+       * returned object give the number of times the pattern has been set up
+       * and re-used, along with an estimate of the time saved.
+       */
+      const ConsensusAlgorithms::NeighborGraphCache &
+      get_consensus_cache() const;
+
     private:
       /**
        * Tolerance to be used while determining the surrounding cells of a
@@ -339,6 +362,11 @@ namespace Utilities
        */
       boost::signals2::connection tria_signal;
 
+      /**
+       * Communication pattern of the consensus algorithm used in reinit().
+       */
+      std::unique_ptr<ConsensusAlgorithms::NeighborGraphCache> consensus_cache;
+
       /**
        * Flag indicating if the reinit() function has been called and if yes
        * the triangulation has not been modified since then (potentially
@@ -414,6 +442,58 @@ namespace Utilities
 
 
 
+    namespace internal
+    {
+      /**
+       * Pack the given values into a buffer to be sent to another process.
+       * Values of trivially copyable type are copied into the buffer
+       * directly, other values are serialized via a temporary vector.
+       */
+      template <typename T>
+      std::vector<char>
+      pack_remote_values(const ArrayView<const T> &values)
+      {
+        if constexpr (std::is_trivially_copyable_v<T> &&
+                      !std::is_same_v<T, bool>)
+          return Utilities::pack(values, false);
+        else
+          return Utilities::pack(std::vector<T>(values.begin(), values.end()),
+                                 false);
+      }
+
+
+
+      /**
+       * Return a view to the values in a buffer created by
+       * pack_remote_values(). Values of trivially copyable type are read in
+       * place from the @p buffer, other values are unpacked into
+       * @p storage.
+       */
+      template <typename T>
+      ArrayView<const T>
+      unpack_remote_values(const std::vector<char> &buffer,
+                           std::vector<T>          &storage)
+      {
+        // the values start after the number of values at the beginning of
+        // the buffer, so reading them in place requires them to need no
+        // stricter alignment than that number
+        if constexpr (std::is_trivially_copyable_v<T> &&
+                      !std::is_same_v<T, bool> &&
+                      alignof(T) <= alignof(typename std::vector<T>::size_type))
+          {
+            (void)storage;
+            return Utilities::unpack_view<T>(buffer.cbegin(), buffer.cend());
+          }
+        else
+          {
+            storage = Utilities::unpack<std::vector<T>>(buffer, false);
+            return make_array_view(storage);
+          }
+      }
+    } // namespace internal
+
+
+
     template <int dim, int spacedim>
     template <typename T>
     ArrayView<T>
@@ -510,10 +590,9 @@ namespace Utilities
 
           send_requests.emplace_back(MPI_Request());
 
-          send_buffer.emplace_back(Utilities::pack(
-            std::vector<T>(buffer_comm.begin() + send_ptrs[i],
-                           buffer_comm.begin() + send_ptrs[i + 1]),
-            false));
+          send_buffer.emplace_back(internal::pack_remote_values(
+            ArrayView<const T>(buffer_comm.data() + send_ptrs[i],
+                               send_ptrs[i + 1] - send_ptrs[i])));
 
           const int ierr = MPI_Isend(send_buffer.back().data(),
                                      send_buffer.back().size(),
@@ -527,6 +606,7 @@ namespace Utilities
 
       // receive data
       std::vector<char> buffer_char;
+      std::vector<T>    buffer_storage;
 
       for (unsigned int i = 0; i < recv_ranks.size(); ++i)
         {
@@ -557,8 +637,8 @@ namespace Utilities
           AssertThrowMPI(ierr);
 
           // unpack data
-          const auto buffer =
-            Utilities::unpack<std::vector<T>>(buffer_char, false);
+          const ArrayView<const T> buffer =
+            internal::unpack_remote_values(buffer_char, buffer_storage);
 
           // write data into output vector
           const auto ptr =
@@ -698,10 +778,9 @@ namespace Utilities
 
           send_requests.push_back(MPI_Request());
 
-          send_buffer.emplace_back(Utilities::pack(
-            std::vector<T>(buffer_comm.begin() + recv_ptrs[i],
-                           buffer_comm.begin() + recv_ptrs[i + 1]),
-            false));
+          send_buffer.emplace_back(internal::pack_remote_values(
+            ArrayView<const T>(buffer_comm.data() + recv_ptrs[i],
+                               recv_ptrs[i + 1] - recv_ptrs[i])));
 
           const int ierr = MPI_Isend(send_buffer.back().data(),
                                      send_buffer.back().size(),
@@ -715,6 +794,7 @@ namespace Utilities
 
       // receive data
       std::vector<char> recv_buffer;
+      std::vector<T>    recv_buffer_storage;
 
       for (unsigned int i = 0; i < send_ranks.size(); ++i)
         {
@@ -745,8 +825,8 @@ namespace Utilities
           AssertThrowMPI(ierr);
 
           // unpack data
-          const auto recv_buffer_unpacked =
-            Utilities::unpack<std::vector<T>>(recv_buffer, false);
+          const ArrayView<const T> recv_buffer_unpacked =
+            internal::unpack_remote_values(recv_buffer, recv_buffer_storage);
 
           // write data into buffer vector
           const auto ptr =
@@ -131,6 +131,22 @@ namespace Utilities
           partitioner_export_start,
           partitioner_export_end = partitioner_export_start + 200,
 
+          /// Partitioner::set_shared_memory_communicator()
+          partitioner_shared_memory_setup_0,
+          partitioner_shared_memory_setup_1,
+
+          /// 200 tags for the shared-memory variant of
+          /// Partitioner::export_to_ghosted_array_start()
+          partitioner_shared_memory_export_start,
+          partitioner_shared_memory_export_end =
+            partitioner_shared_memory_export_start + 200,
+
+          /// 200 tags for the shared-memory variant of
+          /// Partitioner::import_from_ghosted_array_start()
+          partitioner_shared_memory_import_start,
+          partitioner_shared_memory_import_end =
+            partitioner_shared_memory_import_start + 200,
+
           /// NoncontiguousPartitioner::update_values
           noncontiguous_partitioner_update_ghost_values_start,
           noncontiguous_partitioner_update_ghost_values_end =
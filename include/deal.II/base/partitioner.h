@@ -22,6 +22,7 @@
 #include <deal.II/base/communication_pattern_base.h>
 #include <deal.II/base/index_set.h>
 #include <deal.II/base/memory_space.h>
+#include <deal.II/base/mpi.h>
 #include <deal.II/base/mpi_stub.h>
 #include <deal.II/base/types.h>
 
@@ -472,6 +473,16 @@ namespace Utilities
       virtual MPI_Comm
       get_mpi_communicator() const override;
 
+      /**
+       * Return the node topology of the underlying MPI communicator, see
+       * Utilities::MPI::get_node_topology(). The topology is looked up once
+       * when the locally owned indices are set, such that the node-aware
+       * reductions of the parallel vectors and solvers do not need to look it
+       * up again in every dot product or norm.
+       */
+      const Utilities::MPI::NodeTopology &
+      get_node_topology() const;
+
       /**
        * Return whether ghost indices have been explicitly added as a @p
        * ghost_indices argument. Only true if a reinit() call or constructor
@@ -480,6 +491,48 @@ namespace Utilities
       bool
       ghost_indices_initialized() const;
 
+      /**
+       * Enable the exchange of ghost data with the processes that share the
+       * memory of the calling process by direct memory access rather than MPI
+       * messages. The communicator @p communicator_sm must contain the
+       * processes of the communicator of this class that are located on the
+       * same shared-memory domain as the calling process. Such a communicator
+       * can be created by
+       * @code
+       *   MPI_Comm comm_sm;
+       *   MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL,
+       *                       &comm_sm);
+       * @endcode
+       * The communicator is not duplicated, so it must stay valid as long as
+       * this object is in use. Passing MPI_COMM_SELF disables the
+       * shared-memory exchange again.
+       *
+       * This function is collective over the communicator of this class and
+       * must be called after the ghost indices have been set, since
+       * set_ghost_indices() resets the shared-memory communicator. Subsets of
+       * a larger ghost index set are not supported.
+       *
+       * A LinearAlgebra::distributed::Vector initialized with this
+       * partitioner and with @p communicator_sm as its `comm_sm` argument
+       * allocates its memory in an MPI-3 shared-memory window on
+       * @p communicator_sm (see
+       * LinearAlgebra::distributed::Vector::shared_vector_data()). Its
+       * update_ghost_values() and compress() functions then read the ghost
+       * values of the processes on the same node directly from their memory
+       * and only send MPI messages to processes on other nodes. Vectors
+       * initialized with this partitioner and the default `comm_sm` use
+       * private memory and MPI messages only.
+       */
+      void
+      set_shared_memory_communicator(const MPI_Comm communicator_sm);
+
+      /**
+       * Return the communicator set by set_shared_memory_communicator(), or
+       * MPI_COMM_SELF if all ghost data is exchanged with MPI messages.
+       */
+      MPI_Comm
+      get_shared_memory_communicator() const;
+
 #ifdef DEAL_II_WITH_MPI
       /**
        * Start the exportation of the data in a locally owned array to the
@@ -636,6 +689,83 @@ namespace Utilities
         const ArrayView<Number, MemorySpaceType>       &locally_owned_storage,
         const ArrayView<Number, MemorySpaceType>       &ghost_array,
         std::vector<MPI_Request>                       &requests) const;
+
+      /**
+       * Same as the function above, but for arrays allocated in a
+       * shared-memory window on the communicator given to
+       * set_shared_memory_communicator(). The argument @p shared_arrays
+       * contains the arrays (locally owned and ghost entries) of all
+       * processes of that communicator, ordered by their rank, as returned by
+       * LinearAlgebra::distributed::Vector::shared_vector_data(). For
+       * processes on the same node, this function only signals that the
+       * locally owned data is ready to be read; the ghost values are then
+       * copied directly from the memory of the owner in
+       * export_to_ghosted_array_finish(). The size of @p ghost_array must be
+       * n_ghost_indices().
+       *
+       * If no shared-memory communicator has been set, this function falls
+       * back to the function above.
+       */
+      template <typename Number>
+      void
+      export_to_ghosted_array_start(
+        const unsigned int                          communication_channel,
+        const ArrayView<const Number>              &locally_owned_array,
+        const std::vector<ArrayView<const Number>> &shared_arrays,
+        const ArrayView<Number>                    &temporary_storage,
+        const ArrayView<Number>                    &ghost_array,
+        std::vector<MPI_Request>                   &requests) const;
+
+      /**
+       * Finish the exportation started with the variant of
+       * export_to_ghosted_array_start() with shared-memory arrays. Besides
+       * waiting for the MPI messages, this function copies the ghost values
+       * owned by processes on the same node and waits until the processes
+       * on the same node have read the locally owned values of the calling
+       * process, such that the latter can be modified after this function
+       * returns.
+       */
+      template <typename Number>
+      void
+      export_to_ghosted_array_finish(
+        const std::vector<ArrayView<const Number>> &shared_arrays,
+        const ArrayView<Number>                    &ghost_array,
+        std::vector<MPI_Request>                   &requests) const;
+
+      /**
+       * Same as the import_from_ghosted_array_start() function above, but for
+       * arrays allocated in a shared-memory window on the communicator given
+       * to set_shared_memory_communicator(), see the shared-memory variant of
+       * export_to_ghosted_array_start(). For processes on the same node, this
+       * function only signals that the ghost data is ready to be read by the
+       * owner.
+       */
+      template <typename Number>
+      void
+      import_from_ghosted_array_start(
+        const VectorOperation::values               vector_operation,
+        const unsigned int                          communication_channel,
+        const std::vector<ArrayView<const Number>> &shared_arrays,
+        const ArrayView<Number>                    &ghost_array,
+        const ArrayView<Number>                    &temporary_storage,
+        std::vector<MPI_Request>                   &requests) const;
+
+      /**
+       * Finish the importation started with the variant of
+       * import_from_ghosted_array_start() with shared-memory arrays. The
+       * contributions of processes on the same node are read directly from
+       * their ghost arrays. The ghost entries of the calling process are set
+       * to zero once its owners on the same node have read them.
+       */
+      template <typename Number>
+      void
+      import_from_ghosted_array_finish(
+        const VectorOperation::values               vector_operation,
+        const ArrayView<const Number>              &temporary_storage,
+        const std::vector<ArrayView<const Number>> &shared_arrays,
+        const ArrayView<Number>                    &locally_owned_storage,
+        const ArrayView<Number>                    &ghost_array,
+        std::vector<MPI_Request>                   &requests) const;
 #endif
 
       /**
@@ -783,10 +913,51 @@ namespace Utilities
        */
       MPI_Comm communicator;
 
+      /**
+       * The node topology of the communicator, or nullptr if the partitioner
+       * was set up without a communicator, in which case get_node_topology()
+       * looks it up for MPI_COMM_SELF.
+       */
+      const Utilities::MPI::NodeTopology *node_topology;
+
       /**
        * A variable storing whether the ghost indices have been explicitly set.
        */
       bool have_ghost_indices;
+
+      /**
+       * The communicator of the processes on the same shared-memory domain
+       * set by set_shared_memory_communicator().
+       */
+      MPI_Comm communicator_sm;
+
+      /**
+       * For each entry of ghost_targets_data, the rank of the owning process
+       * within communicator_sm, or numbers::invalid_unsigned_int if the data
+       * is exchanged with MPI messages.
+       */
+      std::vector<unsigned int> ghost_targets_sm_ranks;
+
+      /**
+       * For each entry of import_targets_data, the rank of the requesting
+       * process within communicator_sm, or numbers::invalid_unsigned_int if
+       * the data is exchanged with MPI messages.
+       */
+      std::vector<unsigned int> import_targets_sm_ranks;
+
+      /**
+       * For the ghost indices owned by processes within communicator_sm, the
+       * position of the entry in the array of the owner. The entries are
+       * ordered as the ghost indices, skipping those of remote owners.
+       */
+      std::vector<unsigned int> sm_ghost_indices_data;
+
+      /**
+       * For each entry of import_targets_data with a process within
+       * communicator_sm, the position of the first ghost entry belonging to
+       * the calling process in the array of that process.
+       */
+      std::vector<unsigned int> sm_import_ghost_starts;
     };
 
 
@@ -978,12 +1149,31 @@ namespace Utilities
 
 
 
+    inline const Utilities::MPI::NodeTopology &
+    Partitioner::get_node_topology() const
+    {
+      if (node_topology != nullptr)
+        return *node_topology;
+      else
+        return Utilities::MPI::get_node_topology(communicator);
+    }
+
+
+
     inline bool
     Partitioner::ghost_indices_initialized() const
     {
       return have_ghost_indices;
     }
 
+
+
+    inline MPI_Comm
+    Partitioner::get_shared_memory_communicator() const
+    {
+      return communicator_sm;
+    }
+
 #endif // ifndef DOXYGEN
 
   } // end of namespace MPI
@@ -801,6 +801,432 @@ namespace Utilities
     }
 
 
+
+    template <typename Number>
+    void
+    Partitioner::export_to_ghosted_array_start(
+      const unsigned int                          communication_channel,
+      const ArrayView<const Number>              &locally_owned_array,
+      const std::vector<ArrayView<const Number>> &shared_arrays,
+      const ArrayView<Number>                    &temporary_storage,
+      const ArrayView<Number>                    &ghost_array,
+      std::vector<MPI_Request>                   &requests) const
+    {
+      if (communicator_sm == MPI_COMM_SELF)
+        {
+          export_to_ghosted_array_start<Number, MemorySpace::Host>(
+            communication_channel,
+            locally_owned_array,
+            temporary_storage,
+            ghost_array,
+            requests);
+          return;
+        }
+
+      AssertDimension(temporary_storage.size(), n_import_indices());
+      AssertDimension(ghost_array.size(), n_ghost_indices());
+      AssertDimension(shared_arrays.size(),
+                      Utilities::MPI::n_mpi_processes(communicator_sm));
+      AssertIndexRange(communication_channel, 200);
+      Assert(requests.empty(),
+             ExcMessage("Another operation seems to still be running. "
+                        "Call update_ghost_values_finish() first."));
+      (void)shared_arrays;
+
+      const unsigned int n_import_targets = import_targets_data.size();
+      const unsigned int n_ghost_targets  = ghost_targets_data.size();
+
+      if (n_import_targets > 0)
+        AssertDimension(locally_owned_array.size(), locally_owned_size());
+
+      const int mpi_tag =
+        Utilities::MPI::internal::Tags::partitioner_export_start +
+        communication_channel;
+      const int mpi_tag_sm =
+        Utilities::MPI::internal::Tags::partitioner_shared_memory_export_start +
+        communication_channel;
+
+      // The first n_ghost_targets + n_import_targets requests are organized
+      // as in the function above, except that processes on the same node
+      // only exchange empty messages signaling that the locally owned data
+      // is ready to be read. The next n_import_targets requests wait for the
+      // processes on the same node to have read the locally owned data, and
+      // the last n_ghost_targets requests are used in the _finish function
+      // to signal the owners that the calling process has read their data.
+      requests.resize(2 * (n_ghost_targets + n_import_targets),
+                      MPI_REQUEST_NULL);
+
+      int     dummy           = 0;
+      Number *ghost_array_ptr = ghost_array.data();
+      for (unsigned int i = 0; i < n_ghost_targets; ++i)
+        {
+          const bool is_sm =
+            ghost_targets_sm_ranks[i] != numbers::invalid_unsigned_int;
+          const int ierr =
+            MPI_Irecv(is_sm ? static_cast<void *>(&dummy) : ghost_array_ptr,
+                      is_sm ? 0 : ghost_targets_data[i].second * sizeof(Number),
+                      MPI_BYTE,
+                      ghost_targets_data[i].first,
+                      mpi_tag,
+                      communicator,
+                      &requests[i]);
+          AssertThrowMPI(ierr);
+          ghost_array_ptr += ghost_targets_data[i].second;
+        }
+
+      Number *temp_array_ptr = temporary_storage.data();
+      for (unsigned int i = 0; i < n_import_targets; ++i)
+        {
+          const bool is_sm =
+            import_targets_sm_ranks[i] != numbers::invalid_unsigned_int;
+          if (is_sm)
+            {
+              const int ierr = MPI_Irecv(&dummy,
+                                         0,
+                                         MPI_BYTE,
+                                         import_targets_data[i].first,
+                                         mpi_tag_sm,
+                                         communicator,
+                                         &requests[n_ghost_targets +
+                                                   n_import_targets + i]);
+              AssertThrowMPI(ierr);
+            }
+          else
+            {
+              // copy the data to be sent to the import_data field
+              unsigned int index = 0;
+              for (unsigned int c = import_indices_chunks_by_rank_data[i];
+                   c < import_indices_chunks_by_rank_data[i + 1];
+                   ++c)
+                {
+                  const unsigned int chunk_size =
+                    import_indices_data[c].second -
+                    import_indices_data[c].first;
+                  std::memcpy(temp_array_ptr + index,
+                              locally_owned_array.data() +
+                                import_indices_data[c].first,
+                              chunk_size * sizeof(Number));
+                  index += chunk_size;
+                }
+              AssertDimension(index, import_targets_data[i].second);
+            }
+
+          const int ierr =
+            MPI_Isend(is_sm ? static_cast<void *>(&dummy) : temp_array_ptr,
+                      is_sm ? 0 :
+                              import_targets_data[i].second * sizeof(Number),
+                      MPI_BYTE,
+                      import_targets_data[i].first,
+                      mpi_tag,
+                      communicator,
+                      &requests[n_ghost_targets + i]);
+          AssertThrowMPI(ierr);
+          temp_array_ptr += import_targets_data[i].second;
+        }
+    }
+
+
+
+    template <typename Number>
+    void
+    Partitioner::export_to_ghosted_array_finish(
+      const std::vector<ArrayView<const Number>> &shared_arrays,
+      const ArrayView<Number>                    &ghost_array,
+      std::vector<MPI_Request>                   &requests) const
+    {
+      if (communicator_sm == MPI_COMM_SELF)
+        {
+          export_to_ghosted_array_finish<Number, MemorySpace::Host>(
+            ghost_array, requests);
+          return;
+        }
+
+      const unsigned int n_import_targets = import_targets_data.size();
+      const unsigned int n_ghost_targets  = ghost_targets_data.size();
+
+      AssertDimension(ghost_array.size(), n_ghost_indices());
+      AssertDimension(requests.size(),
+                      2 * (n_ghost_targets + n_import_targets));
+
+      // wait for the data of remote processes and for the signals of the
+      // owners on the same node. for the latter, read the ghost values
+      // directly from the memory of the owner and tell it that we are done.
+      // the tag of this message is derived from the tag of the owner's
+      // signal, which encodes the communication channel
+      int                 dummy           = 0;
+      const unsigned int *sm_indices_ptr  = sm_ghost_indices_data.data();
+      Number             *ghost_array_ptr = ghost_array.data();
+      for (unsigned int i = 0; i < n_ghost_targets; ++i)
+        {
+          MPI_Status status;
+          int        ierr = MPI_Wait(&requests[i], &status);
+          AssertThrowMPI(ierr);
+
+          if (ghost_targets_sm_ranks[i] != numbers::invalid_unsigned_int)
+            {
+              const Number *owner_array =
+                shared_arrays[ghost_targets_sm_ranks[i]].data();
+              for (unsigned int j = 0; j < ghost_targets_data[i].second; ++j)
+                ghost_array_ptr[j] = owner_array[sm_indices_ptr[j]];
+              sm_indices_ptr += ghost_targets_data[i].second;
+
+              ierr = MPI_Isend(
+                &dummy,
+                0,
+                MPI_BYTE,
+                ghost_targets_data[i].first,
+                status.MPI_TAG -
+                  Utilities::MPI::internal::Tags::partitioner_export_start +
+                  Utilities::MPI::internal::Tags::
+                    partitioner_shared_memory_export_start,
+                communicator,
+                &requests[n_ghost_targets + 2 * n_import_targets + i]);
+              AssertThrowMPI(ierr);
+            }
+          ghost_array_ptr += ghost_targets_data[i].second;
+        }
+
+      // wait for the remaining sends and for the processes on the same node
+      // to have read our data, which may be modified after this call
+      const int ierr =
+        MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+      AssertThrowMPI(ierr);
+      requests.resize(0);
+    }
+
+
+
+    template <typename Number>
+    void
+    Partitioner::import_from_ghosted_array_start(
+      const VectorOperation::values               vector_operation,
+      const unsigned int                          communication_channel,
+      const std::vector<ArrayView<const Number>> &shared_arrays,
+      const ArrayView<Number>                    &ghost_array,
+      const ArrayView<Number>                    &temporary_storage,
+      std::vector<MPI_Request>                   &requests) const
+    {
+      if (communicator_sm == MPI_COMM_SELF)
+        {
+          import_from_ghosted_array_start<Number, MemorySpace::Host>(
+            vector_operation,
+            communication_channel,
+            ghost_array,
+            temporary_storage,
+            requests);
+          return;
+        }
+
+      AssertDimension(temporary_storage.size(), n_import_indices());
+      AssertDimension(ghost_array.size(), n_ghost_indices());
+      AssertDimension(shared_arrays.size(),
+                      Utilities::MPI::n_mpi_processes(communicator_sm));
+      AssertIndexRange(communication_channel, 200);
+      Assert(requests.empty(),
+             ExcMessage("Another compress operation seems to still be running. "
+                        "Call compress_finish() first."));
+      (void)shared_arrays;
+      (void)vector_operation;
+
+      // as in the function above, only check the consistency of inserted
+      // data in debug mode
+#    ifndef DEBUG
+      if (vector_operation == VectorOperation::insert)
+        return;
+#    endif
+
+      if (n_ghost_indices() == 0 && n_import_indices() == 0)
+        return;
+
+      const unsigned int n_import_targets = import_targets_data.size();
+      const unsigned int n_ghost_targets  = ghost_targets_data.size();
+
+      const int mpi_tag =
+        Utilities::MPI::internal::Tags::partitioner_import_start +
+        communication_channel;
+      const int mpi_tag_sm =
+        Utilities::MPI::internal::Tags::partitioner_shared_memory_import_start +
+        communication_channel;
+
+      // same layout of the requests as in export_to_ghosted_array_start()
+      // with the roles of ghost and import targets interchanged: here, the
+      // owner reads the ghost data of the processes on the same node
+      requests.resize(2 * (n_ghost_targets + n_import_targets),
+                      MPI_REQUEST_NULL);
+
+      int     dummy          = 0;
+      Number *temp_array_ptr = temporary_storage.data();
+      for (unsigned int i = 0; i < n_import_targets; ++i)
+        {
+          const bool is_sm =
+            import_targets_sm_ranks[i] != numbers::invalid_unsigned_int;
+          const int ierr =
+            MPI_Irecv(is_sm ? static_cast<void *>(&dummy) : temp_array_ptr,
+                      is_sm ? 0 :
+                              import_targets_data[i].second * sizeof(Number),
+                      MPI_BYTE,
+                      import_targets_data[i].first,
+                      mpi_tag,
+                      communicator,
+                      &requests[i]);
+          AssertThrowMPI(ierr);
+          temp_array_ptr += import_targets_data[i].second;
+        }
+
+      Number *ghost_array_ptr = ghost_array.data();
+      for (unsigned int i = 0; i < n_ghost_targets; ++i)
+        {
+          const bool is_sm =
+            ghost_targets_sm_ranks[i] != numbers::invalid_unsigned_int;
+          if (is_sm)
+            {
+              const int ierr = MPI_Irecv(&dummy,
+                                         0,
+                                         MPI_BYTE,
+                                         ghost_targets_data[i].first,
+                                         mpi_tag_sm,
+                                         communicator,
+                                         &requests[n_import_targets +
+                                                   n_ghost_targets + i]);
+              AssertThrowMPI(ierr);
+            }
+
+          const int ierr =
+            MPI_Isend(is_sm ? static_cast<void *>(&dummy) : ghost_array_ptr,
+                      is_sm ? 0 : ghost_targets_data[i].second * sizeof(Number),
+                      MPI_BYTE,
+                      ghost_targets_data[i].first,
+                      mpi_tag,
+                      communicator,
+                      &requests[n_import_targets + i]);
+          AssertThrowMPI(ierr);
+          ghost_array_ptr += ghost_targets_data[i].second;
+        }
+    }
+
+
+
+    template <typename Number>
+    void
+    Partitioner::import_from_ghosted_array_finish(
+      const VectorOperation::values               vector_operation,
+      const ArrayView<const Number>              &temporary_storage,
+      const std::vector<ArrayView<const Number>> &shared_arrays,
+      const ArrayView<Number>                    &locally_owned_array,
+      const ArrayView<Number>                    &ghost_array,
+      std::vector<MPI_Request>                   &requests) const
+    {
+      if (communicator_sm == MPI_COMM_SELF)
+        {
+          import_from_ghosted_array_finish<Number, MemorySpace::Host>(
+            vector_operation,
+            temporary_storage,
+            locally_owned_array,
+            ghost_array,
+            requests);
+          return;
+        }
+
+      AssertDimension(temporary_storage.size(), n_import_indices());
+      AssertDimension(ghost_array.size(), n_ghost_indices());
+
+      const unsigned int n_import_targets = import_targets_data.size();
+      const unsigned int n_ghost_targets  = ghost_targets_data.size();
+
+      if (requests.size() > 0)
+        {
+          AssertDimension(requests.size(),
+                          2 * (n_ghost_targets + n_import_targets));
+
+          if (n_import_targets > 0)
+            AssertDimension(locally_owned_array.size(), locally_owned_size());
+
+          const auto combine = [&](Number &dst, const Number src) {
+            if (vector_operation == VectorOperation::add)
+              dst += src;
+            else if (vector_operation == VectorOperation::min)
+              dst = internal::get_min(src, dst);
+            else if (vector_operation == VectorOperation::max)
+              dst = internal::get_max(src, dst);
+            else
+              // see the function above for the tolerance
+              Assert(src == Number() ||
+                       internal::get_abs(dst - src) <=
+                         internal::get_abs(dst + src) * 100000. *
+                           std::numeric_limits<typename numbers::NumberTraits<
+                             Number>::real_type>::epsilon(),
+                     typename dealii::LinearAlgebra::distributed::Vector<
+                       Number>::ExcNonMatchingElements(src, dst, my_pid));
+          };
+
+          // wait for the data of remote processes and for the signals of
+          // the processes on the same node that their ghost data is ready.
+          // as in export_to_ghosted_array_finish(), the latter are answered
+          // with a message whose tag is derived from the tag of the signal
+          int           dummy         = 0;
+          const Number *read_position = temporary_storage.data();
+          for (unsigned int i = 0; i < n_import_targets; ++i)
+            {
+              MPI_Status status;
+              int        ierr = MPI_Wait(&requests[i], &status);
+              AssertThrowMPI(ierr);
+
+              if (import_targets_sm_ranks[i] != numbers::invalid_unsigned_int)
+                {
+                  // read the ghost data directly from the memory of the
+                  // process on the same node, whose ghost entries for this
+                  // process are contiguous
+                  const Number *ghost_data =
+                    shared_arrays[import_targets_sm_ranks[i]].data() +
+                    sm_import_ghost_starts[i];
+                  for (unsigned int c = import_indices_chunks_by_rank_data[i];
+                       c < import_indices_chunks_by_rank_data[i + 1];
+                       ++c)
+                    for (unsigned int j = import_indices_data[c].first;
+                         j < import_indices_data[c].second;
+                         ++j)
+                      combine(locally_owned_array[j], *ghost_data++);
+
+                  ierr = MPI_Isend(
+                    &dummy,
+                    0,
+                    MPI_BYTE,
+                    import_targets_data[i].first,
+                    status.MPI_TAG -
+                      Utilities::MPI::internal::Tags::partitioner_import_start +
+                      Utilities::MPI::internal::Tags::
+                        partitioner_shared_memory_import_start,
+                    communicator,
+                    &requests[n_import_targets + 2 * n_ghost_targets + i]);
+                  AssertThrowMPI(ierr);
+                }
+              else
+                {
+                  const Number *data = read_position;
+                  for (unsigned int c = import_indices_chunks_by_rank_data[i];
+                       c < import_indices_chunks_by_rank_data[i + 1];
+                       ++c)
+                    for (unsigned int j = import_indices_data[c].first;
+                         j < import_indices_data[c].second;
+                         ++j)
+                      combine(locally_owned_array[j], *data++);
+                }
+              read_position += import_targets_data[i].second;
+            }
+
+          // wait for the remaining sends and for the owners on the same node
+          // to have read our ghost data, which is cleared below
+          const int ierr =
+            MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+          AssertThrowMPI(ierr);
+        }
+
+      // clear the ghost array
+      std::fill(ghost_array.begin(), ghost_array.end(), Number());
+      requests.resize(0);
+    }
+
+
 #  endif // ifdef DEAL_II_WITH_MPI
 #endif   // ifndef DOXYGEN
 
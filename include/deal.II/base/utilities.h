@@ -18,6 +18,7 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/array_view.h>
 #include <deal.II/base/exceptions.h>
 
 #include <boost/archive/binary_iarchive.hpp>
@@ -31,6 +32,8 @@
 #include <boost/serialization/vector.hpp>
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <string>
 #include <tuple>
@@ -578,6 +581,13 @@ namespace Utilities
    *   followed by a bit-by-bit copy of the contents of the vector. A
    *   similar process is used for vectors of vectors of objects whose type
    *   `T` satisfies `std::is_trivially_copyable`.
+   * - If the object is an ArrayView of objects whose type `T` satisfies
+   *   `std::is_trivially_copyable`, then the viewed elements are packed in
+   *   the same way as a vector of such objects, so the buffer can be
+   *   unpacked into a `std::vector<T>` with the same compression flag.
+   *   Without compression, the elements are copied bit by bit, and the
+   *   buffer can also be read in place with unpack_view(). With
+   *   compression, the elements are first copied into a temporary vector.
    * - Finally, if the type `T` of the object to be packed is std::tuple<>
    *   (i.e., a tuple without any elements as indicated by the empty argument
    *   list) and if no compression is requested, then this
@@ -673,6 +683,25 @@ namespace Utilities
          const std::vector<char>::const_iterator &cend,
          const bool                               allow_compression = true);
 
+  /**
+   * Given (a fraction of) a buffer that contains a `std::vector<T>` or an
+   * `ArrayView<T>` of objects whose type `T` satisfies
+   * `std::is_trivially_copyable`, packed by pack() without compression,
+   * return a view to the elements in the buffer. In contrast to unpack(),
+   * the elements are not copied, which is useful when they are only read
+   * once, e.g., directly from a receive buffer.
+   *
+   * @note The returned view is only valid as long as the buffer is neither
+   *   destroyed nor resized. Furthermore, the elements need to be
+   *   correctly aligned within the buffer, which is the case if the packed
+   *   data starts at the beginning of a buffer or at an offset that is a
+   *   multiple of the alignment of `T`.
+   */
+  template <typename T>
+  ArrayView<const T>
+  unpack_view(const std::vector<char>::const_iterator &cbegin,
+              const std::vector<char>::const_iterator &cend);
+
   /**
    * Given a vector of characters, obtained through a call to the function
    * Utilities::pack, restore its content in an array of type T.
@@ -1143,6 +1172,58 @@ namespace Utilities
 
 
 
+    /**
+     * A structure that is used to identify whether a template argument is an
+     * ArrayView<T> of host memory, where T is a type that satisfies
+     * std::is_trivially_copyable_v<T> == true.
+     */
+    template <typename T>
+    struct IsArrayViewOfTriviallyCopyable
+    {
+      static constexpr bool value = false;
+    };
+
+
+
+    template <typename T>
+    struct IsArrayViewOfTriviallyCopyable<ArrayView<T, MemorySpace::Host>>
+    {
+      static constexpr bool value =
+        std::is_trivially_copyable_v<std::remove_cv_t<T>> &&
+        !std::is_same_v<std::remove_cv_t<T>, bool>;
+    };
+
+
+
+    /**
+     * Append the number of elements @p n_elements followed by the elements
+     * themselves bit for bit to a character array. This is the format used
+     * for vectors and ArrayView objects of trivially copyable types.
+     *
+     * The buffer is resized rather than reserved to the exact size, so that
+     * its capacity grows geometrically when many objects are appended to it.
+     */
+    template <typename T>
+    inline void
+    append_array_of_trivially_copyable_to_buffer(
+      const T                                 *data,
+      const typename std::vector<T>::size_type n_elements,
+      std::vector<char>                       &dest_buffer)
+    {
+      const std::size_t previous_size = dest_buffer.size();
+      dest_buffer.resize(previous_size + sizeof(n_elements) +
+                         n_elements * sizeof(T));
+
+      char *destination = dest_buffer.data() + previous_size;
+      std::memcpy(destination, &n_elements, sizeof(n_elements));
+      if (n_elements > 0)
+        std::memcpy(destination + sizeof(n_elements),
+                    data,
+                    n_elements * sizeof(T));
+    }
+
+
+
     /**
      * A function that is used to append the contents of a std::vector<T>
      * (where T is a type that satisfies std::is_trivially_copyable_v<T>
@@ -1170,24 +1251,23 @@ namespace Utilities
       const std::vector<T> &object,
       std::vector<char>    &dest_buffer)
     {
-      const typename std::vector<T>::size_type vector_size = object.size();
+      append_array_of_trivially_copyable_to_buffer(object.data(),
+                                                   object.size(),
+                                                   dest_buffer);
+    }
 
-      // Reserve for the buffer so that it can store the size of 'object' as
-      // well as all of its elements.
-      dest_buffer.reserve(dest_buffer.size() + sizeof(vector_size) +
-                          vector_size * sizeof(T));
 
-      // Copy the size into the vector
-      dest_buffer.insert(dest_buffer.end(),
-                         reinterpret_cast<const char *>(&vector_size),
-                         reinterpret_cast<const char *>(&vector_size + 1));
 
-      // Insert the elements at the end of the vector:
-      if (vector_size > 0)
-        dest_buffer.insert(dest_buffer.end(),
-                           reinterpret_cast<const char *>(object.data()),
-                           reinterpret_cast<const char *>(object.data() +
-                                                          vector_size));
+    template <typename T,
+              typename = std::enable_if_t<
+                IsArrayViewOfTriviallyCopyable<ArrayView<T>>::value>>
+    inline void
+    append_vector_of_trivially_copyable_to_buffer(
+      const ArrayView<T, MemorySpace::Host> &object,
+      std::vector<char>                     &dest_buffer)
+    {
+      append_array_of_trivially_copyable_to_buffer<std::remove_cv_t<T>>(
+        object.data(), object.size(), dest_buffer);
     }
 
 
@@ -1203,38 +1283,34 @@ namespace Utilities
       using size_type             = typename std::vector<T>::size_type;
       const size_type vector_size = object.size();
 
-      typename std::vector<T>::size_type aggregated_size = 0;
-      std::vector<size_type>             sizes;
-      sizes.reserve(vector_size);
+      size_type aggregated_size = 0;
+      for (const auto &a : object)
+        aggregated_size += a.size();
+
+      // Resize the buffer so that it can store the size of 'object', the
+      // sizes of the individual chunks, and all of their elements, and then
+      // copy everything in place without any intermediate storage.
+      const std::size_t previous_size = dest_buffer.size();
+      dest_buffer.resize(previous_size +
+                         sizeof(vector_size) * (1 + vector_size) +
+                         aggregated_size * sizeof(T));
+
+      char *size_destination = dest_buffer.data() + previous_size;
+      std::memcpy(size_destination, &vector_size, sizeof(vector_size));
+      size_destination += sizeof(vector_size);
+
+      char *data_destination =
+        size_destination + vector_size * sizeof(size_type);
       for (const auto &a : object)
         {
-          aggregated_size += a.size();
-          sizes.push_back(a.size());
-        }
-
-      // Reserve for the buffer so that it can store the size of 'object' as
-      // well as all of its elements.
-      dest_buffer.reserve(dest_buffer.size() +
-                          sizeof(vector_size) * (1 + vector_size) +
-                          aggregated_size * sizeof(T));
+          const size_type chunk_size = a.size();
+          std::memcpy(size_destination, &chunk_size, sizeof(chunk_size));
+          size_destination += sizeof(chunk_size);
 
-      // Copy the size into the vector
-      dest_buffer.insert(dest_buffer.end(),
-                         reinterpret_cast<const char *>(&vector_size),
-                         reinterpret_cast<const char *>(&vector_size + 1));
-
-      // Copy the sizes of the individual chunks into the vector
-      if (vector_size > 0)
-        dest_buffer.insert(dest_buffer.end(),
-                           reinterpret_cast<const char *>(sizes.data()),
-                           reinterpret_cast<const char *>(sizes.data() +
-                                                          vector_size));
-
-      // Insert the elements at the end of the vector:
-      for (const auto &a : object)
-        dest_buffer.insert(dest_buffer.end(),
-                           reinterpret_cast<const char *>(a.data()),
-                           reinterpret_cast<const char *>(a.data() + a.size()));
+          if (chunk_size > 0)
+            std::memcpy(data_destination, a.data(), chunk_size * sizeof(T));
+          data_destination += chunk_size * sizeof(T);
+        }
     }
 
 
@@ -1347,10 +1423,28 @@ namespace Utilities
     std::size_t size = 0;
 
 
+    // ArrayView objects are trivially copyable themselves, but we want to
+    // pack the elements they point to rather than the view. without
+    // compression, this is done bit by bit in the format of a vector. BOOST
+    // does not know how to serialize ArrayView objects, so the elements need
+    // to be copied into a vector if compression is requested
+    if constexpr (internal::IsArrayViewOfTriviallyCopyable<T>::value)
+      {
+        if (allow_compression)
+          return pack(std::vector<std::remove_cv_t<typename T::value_type>>(
+                        object.begin(), object.end()),
+                      dest_buffer,
+                      true);
+
+        const std::size_t previous_size = dest_buffer.size();
+        internal::append_vector_of_trivially_copyable_to_buffer(object,
+                                                                dest_buffer);
+        size = dest_buffer.size() - previous_size;
+      }
     // see if the object is small and copyable via memcpy. if so, use
     // this fast path. otherwise, we have to go through the BOOST
     // serialization machinery
-    if constexpr (std::is_trivially_copyable<T>() && sizeof(T) < 256)
+    else if constexpr (std::is_trivially_copyable<T>() && sizeof(T) < 256)
       {
         // Determine the size. There are places where we would like to use a
         // truly empty type, for which we use std::tuple<> (i.e., a tuple
@@ -1503,6 +1597,39 @@ namespace Utilities
   }
 
 
+
+  template <typename T>
+  ArrayView<const T>
+  unpack_view(const std::vector<char>::const_iterator &cbegin,
+              const std::vector<char>::const_iterator &cend)
+  {
+    static_assert(std::is_trivially_copyable_v<T> && !std::is_same_v<T, bool>,
+                  "unpack_view() can only be used for trivially copyable "
+                  "types.");
+
+    using size_type = typename std::vector<T>::size_type;
+    Assert(static_cast<std::size_t>(cend - cbegin) >= sizeof(size_type),
+           ExcMessage("The given buffer is too small."));
+
+    size_type n_elements;
+    std::memcpy(&n_elements, &*cbegin, sizeof(n_elements));
+
+    Assert(static_cast<std::size_t>(cend - cbegin) ==
+             sizeof(n_elements) + n_elements * sizeof(T),
+           ExcMessage("The given buffer has the wrong size."));
+    (void)cend;
+
+    if (n_elements == 0)
+      return ArrayView<const T>();
+
+    const char *const data = &*cbegin + sizeof(n_elements);
+    Assert(reinterpret_cast<std::uintptr_t>(data) % alignof(T) == 0,
+           ExcMessage("The elements in the given buffer are not correctly "
+                      "aligned for the requested type."));
+    return ArrayView<const T>(reinterpret_cast<const T *>(data), n_elements);
+  }
+
+
   template <typename T, int N>
   void
   unpack(const std::vector<char>::const_iterator &cbegin,
@@ -230,6 +230,24 @@ namespace parallel
          * active cell partitioning method.
          */
         construct_multigrid_hierarchy = 0x8,
+
+        /**
+         * Partition the active cells only on the first process of the
+         * communicator, instead of letting every process compute the same
+         * partition of its copy of the mesh, and broadcast the resulting
+         * subdomain ids to all other processes.
+         *
+         * Setting this flag is useful for large meshes and many processes
+         * per node, where running the partitioner on each process
+         * multiplies both its run time (as the processes compete for memory
+         * bandwidth) and its temporary memory by the number of processes.
+         * The mesh itself is still stored on every process. This flag has
+         * no effect for <code>partition_custom_signal</code>.
+         *
+         * This flag can be combined with any of the partitioning schemes
+         * above.
+         */
+        partition_on_first_process = 0x10,
       };
 
 
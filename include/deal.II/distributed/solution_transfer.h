@@ -22,6 +22,9 @@
 
 #include <deal.II/dofs/dof_handler.h>
 
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/vector.h>
+
 #include <vector>
 
 
@@ -340,6 +343,38 @@ namespace parallel
        */
       unsigned int handle;
 
+      /**
+       * Scratch storage for the local values of all vectors on a cell and
+       * its children, used by pack_callback() and unpack_callback() when
+       * several vectors are transferred without hp-capabilities. Keeping it
+       * as a member avoids allocating memory for every cell.
+       */
+      struct ScratchData
+      {
+        /**
+         * The values of all vectors on the parent cell, one vector per
+         * column.
+         */
+        FullMatrix<typename VectorType::value_type> cell_values;
+
+        /**
+         * The values of all vectors on one of the children.
+         */
+        FullMatrix<typename VectorType::value_type> child_values;
+
+        /**
+         * The values of all vectors after applying a restriction matrix.
+         */
+        FullMatrix<typename VectorType::value_type> transferred_values;
+
+        /**
+         * The values of a single vector on a cell.
+         */
+        ::dealii::Vector<typename VectorType::value_type> local_values;
+      };
+
+      ScratchData scratch_data;
+
       /**
        * A callback function used to pack the data on the current mesh into
        * objects that can later be retrieved after refinement, coarsening and
@@ -503,6 +503,44 @@ namespace parallel
     DEAL_II_DEPRECATED
     virtual void
     load(const std::string &filename, const bool autopartition) = 0;
+
+    /**
+     * Choose whether save() writes the cell-based data attached via
+     * register_data_attach(), e.g., by SolutionTransfer objects, in the
+     * background. The default is to wait until all data has been written.
+     *
+     * If enabled, save() moves the packed data into staging buffers, starts
+     * nonblocking collective MPIIO write operations, and returns as soon as
+     * the (small) description of the mesh has been written. The computation
+     * can then continue, including refining and coarsening the mesh, while
+     * the data is written. The write operations are completed by
+     * finish_asynchronous_save(), which is also called at the beginning of
+     * the next call to save() or load(), and when this object is cleared or
+     * destroyed. The checkpoint files must not be read or moved before that.
+     *
+     * On a single process, or if MPI does not support nonblocking collective
+     * file operations, all data is still written before save() returns.
+     */
+    void
+    set_asynchronous_save(const bool asynchronous_save);
+
+    /**
+     * Wait until the data written by a previous call to save() with
+     * asynchronous saves enabled has been written completely, see
+     * set_asynchronous_save(). Does nothing if no save is pending.
+     *
+     * This is a collective operation that needs to be called on all
+     * processes of the communicator of this triangulation.
+     */
+    void
+    finish_asynchronous_save();
+
+  protected:
+    /**
+     * Whether save() only starts to write the cell-based data, see
+     * set_asynchronous_save().
+     */
+    bool asynchronous_save;
   };
 
 } // namespace parallel
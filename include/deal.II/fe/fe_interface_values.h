@@ -27,6 +27,9 @@
 #include <deal.II/hp/fe_values.h>
 #include <deal.II/hp/q_collection.h>
 
+#include <algorithm>
+#include <utility>
+
 DEAL_II_NAMESPACE_OPEN
 
 #ifndef DOXYGEN
@@ -2066,6 +2069,16 @@ private:
    */
   std::vector<std::array<unsigned int, 2>> dofmap;
 
+  /**
+   * Scratch arrays for the DoF indices of the current cell and its neighbor
+   * and for the sorted union of both, used in reinit(). They are kept as
+   * members to avoid allocating memory for every face.
+   */
+  std::vector<types::global_dof_index> cell_dof_indices;
+  std::vector<types::global_dof_index> neighbor_dof_indices;
+  std::vector<std::pair<types::global_dof_index, unsigned int>>
+    sorted_dof_indices;
+
   /**
    * Pointer to internal_fe_face_values or internal_fe_subface_values,
    * respectively as determined in reinit().
@@ -2464,45 +2477,46 @@ FEInterfaceValues<dim, spacedim>::reinit(
     }
 
   // Set up dof mapping and remove duplicates (for continuous elements).
+  // This function is called once for every face during the assembly, so
+  // all arrays are members of this class that keep their memory between
+  // calls.
   {
     // Get dof indices first:
-    std::vector<types::global_dof_index> v(
-      fe_face_values->get_fe().n_dofs_per_cell());
-    cell->get_active_or_mg_dof_indices(v);
-    std::vector<types::global_dof_index> v2(
+    const unsigned int n_dofs = fe_face_values->get_fe().n_dofs_per_cell();
+    cell_dof_indices.resize(n_dofs);
+    cell->get_active_or_mg_dof_indices(cell_dof_indices);
+    neighbor_dof_indices.resize(
       fe_face_values_neighbor->get_fe().n_dofs_per_cell());
-    cell_neighbor->get_active_or_mg_dof_indices(v2);
-
-    // Fill a map from the global dof index to the left and right
-    // local index.
-    std::map<types::global_dof_index, std::pair<unsigned int, unsigned int>>
-                                          tempmap;
-    std::pair<unsigned int, unsigned int> invalid_entry(
-      numbers::invalid_unsigned_int, numbers::invalid_unsigned_int);
-
-    for (unsigned int i = 0; i < v.size(); ++i)
-      {
-        // If not already existing, add an invalid entry:
-        auto result = tempmap.insert(std::make_pair(v[i], invalid_entry));
-        result.first->second.first = i;
-      }
-
-    for (unsigned int i = 0; i < v2.size(); ++i)
-      {
-        // If not already existing, add an invalid entry:
-        auto result = tempmap.insert(std::make_pair(v2[i], invalid_entry));
-        result.first->second.second = i;
-      }
-
-    // Transfer from the map to the sorted std::vectors.
-    dofmap.resize(tempmap.size());
-    interface_dof_indices.resize(tempmap.size());
-    unsigned int idx = 0;
-    for (auto &x : tempmap)
+    cell_neighbor->get_active_or_mg_dof_indices(neighbor_dof_indices);
+
+    // Sort the global dof indices of both cells together with the local
+    // index, where the local indices of the neighbor are shifted by the
+    // number of dofs on the current cell. Duplicates, i.e., dofs shared by
+    // both cells, end up next to each other.
+    sorted_dof_indices.resize(n_dofs + neighbor_dof_indices.size());
+    for (unsigned int i = 0; i < n_dofs; ++i)
+      sorted_dof_indices[i] = {cell_dof_indices[i], i};
+    for (unsigned int i = 0; i < neighbor_dof_indices.size(); ++i)
+      sorted_dof_indices[n_dofs + i] = {neighbor_dof_indices[i], n_dofs + i};
+    std::sort(sorted_dof_indices.begin(), sorted_dof_indices.end());
+
+    // Fill the interface dofs in ascending order of the global dof index,
+    // with the left and right local index.
+    interface_dof_indices.clear();
+    dofmap.clear();
+    for (const auto &[dof_index, local_index] : sorted_dof_indices)
       {
-        interface_dof_indices[idx] = x.first;
-        dofmap[idx]                = {{x.second.first, x.second.second}};
-        ++idx;
+        if (interface_dof_indices.empty() ||
+            interface_dof_indices.back() != dof_index)
+          {
+            interface_dof_indices.push_back(dof_index);
+            dofmap.push_back(
+              {{numbers::invalid_unsigned_int, numbers::invalid_unsigned_int}});
+          }
+        if (local_index < n_dofs)
+          dofmap.back()[0] = local_index;
+        else
+          dofmap.back()[1] = local_index - n_dofs;
       }
   }
 }
@@ -365,18 +365,18 @@ operator&=(UpdateFlags &f1, const UpdateFlags f2)
  * to the previously visited cell. This information is used for reusing data
  * when calling the method FEValues::reinit() (like derivatives, which do not
  * change if one cell is just a translation of the previous). Currently, this
- * variable does only recognize a translation and an inverted translation (if
- * dim<spacedim). However, this concept makes it easy to add additional states
- * to be detected in FEValues/FEFaceValues for making use of these
- * similarities as well.
+ * variable does only recognize a translation, an inverted translation (if
+ * dim<spacedim), and a translation combined with a uniform scaling. However,
+ * this concept makes it easy to add additional states to be detected in
+ * FEValues/FEFaceValues for making use of these similarities as well.
  */
 namespace CellSimilarity
 {
   enum Similarity
   {
     /**
-     * The cells differ by something besides a translation or inverted
-     * translations.
+     * The cells differ by something besides a (scaled) translation or
+     * inverted translations.
      */
     none,
     /**
@@ -387,6 +387,15 @@ namespace CellSimilarity
      * The cells differ by an inverted translation.
      */
     inverted_translation,
+    /**
+     * The current cell is a translated and uniformly scaled copy of a cell
+     * visited before, not necessarily the previous one. The derivatives of
+     * the shape functions on the current cell are then the ones on that cell
+     * times a power of the inverse scaling factor. FEValues only uses this
+     * state for mappings and finite elements for which this is known to
+     * hold, see FEValuesBase::check_cell_similarity().
+     */
+    scaled_translation,
     /**
      * The next cell is not valid.
      */
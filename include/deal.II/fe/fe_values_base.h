@@ -1483,6 +1483,57 @@ public:
   CellSimilarity::Similarity
   get_cell_similarity() const;
 
+  /**
+   * A structure with statistics on how often reinit() could reuse the data
+   * computed on the previous cell, see get_cell_similarity_statistics().
+   */
+  struct CellSimilarityStatistics
+  {
+    /**
+     * The number of calls to reinit() on cells.
+     */
+    std::size_t n_cells = 0;
+
+    /**
+     * The number of cells that were a translation or an inverted translation
+     * of the previous cell, for which the derivatives of the shape functions
+     * were reused as they are.
+     */
+    std::size_t n_translations = 0;
+
+    /**
+     * The number of cells that were a translated and uniformly scaled copy
+     * of a cell visited before, for which the derivatives of the shape
+     * functions of that cell were reused after scaling them.
+     */
+    std::size_t n_scaled_translations = 0;
+
+    /**
+     * Return the fraction of cells for which the data of the previous cell
+     * could be reused, or zero if reinit() has not been called yet.
+     */
+    double
+    hit_rate() const;
+
+    /**
+     * Add the statistics of @p other to the current object.
+     */
+    CellSimilarityStatistics &
+    operator+=(const CellSimilarityStatistics &other);
+  };
+
+  /**
+   * Return statistics on how often the current cell was similar to the
+   * previous one in the calls to reinit() since the creation of this object,
+   * i.e., how often get_cell_similarity() returned something different from
+   * CellSimilarity::none. A low hit rate on a mesh with many similar cells
+   * may indicate that the check for cell similarity is disabled (see
+   * always_allow_check_for_cell_similarity()), or that the mesh is traversed
+   * in an order in which consecutive cells are rarely similar.
+   */
+  const CellSimilarityStatistics &
+  get_cell_similarity_statistics() const;
+
   /**
    * Determine an estimate for the memory consumption (in bytes) of this
    * object.
@@ -1764,10 +1815,73 @@ protected:
    */
   CellSimilarity::Similarity cell_similarity;
 
+  /**
+   * The ratio between the size of the current cell and the size of the cell
+   * stored in #scaled_copy_cache if #cell_similarity is
+   * CellSimilarity::scaled_translation.
+   */
+  double cell_scaling;
+
+  /**
+   * A structure that describes the last cell on which the derivatives of the
+   * shape functions were computed in full, see check_cell_similarity().
+   */
+  struct ScaledCopyCache
+  {
+    /**
+     * The vertices of the cell, or an empty vector if no cell has been
+     * stored.
+     */
+    std::vector<Point<spacedim>> vertices;
+
+    /**
+     * Whether the derivatives below hold the ones computed on the cell. They
+     * are only copied from #finite_element_output when the first scaled copy
+     * of the cell is found, since until then the output of the finite
+     * element still holds them.
+     */
+    bool derivatives_are_stored = false;
+
+    /**
+     * The gradients, Hessians, and third derivatives of the shape functions
+     * on the cell.
+     */
+    typename dealii::internal::FEValuesImplementation::
+      FiniteElementRelatedData<dim, spacedim>::GradientVector shape_gradients;
+    typename dealii::internal::FEValuesImplementation::
+      FiniteElementRelatedData<dim, spacedim>::HessianVector shape_hessians;
+    typename dealii::internal::FEValuesImplementation::
+      FiniteElementRelatedData<dim, spacedim>::ThirdDerivativeVector
+        shape_3rd_derivatives;
+  };
+
+  /**
+   * The last cell on which the derivatives of the shape functions were
+   * computed in full, along with these derivatives once they are needed.
+   */
+  ScaledCopyCache scaled_copy_cache;
+
+  /**
+   * Statistics on the cell similarities found in reinit().
+   */
+  CellSimilarityStatistics cell_similarity_statistics;
+
   /**
    * A function that checks whether the new cell is similar to the one
    * previously used. Then, a significant amount of the data can be reused,
    * e.g. the derivatives of the basis functions in real space, shape_grad.
+   *
+   * Besides translations of the previous cell, this function detects cells
+   * that are translated and uniformly scaled copies of the last cell on
+   * which the derivatives of the shape functions were computed in full,
+   * stored in #scaled_copy_cache. This cell need not be the previous one, so
+   * the derivatives are reused on all cells of the same shape regardless of
+   * their size and of the order in which the cells are visited, e.g., on all
+   * cells of an adaptively refined Cartesian mesh. This is only done if the
+   * derivatives of the shape functions can be obtained by scaling the ones
+   * of the stored cell, which is currently the case for MappingCartesian and
+   * MappingQ of degree one, combined with finite elements derived from
+   * FE_Q_Base or FE_DGQ.
    */
   void
   check_cell_similarity(
@@ -1784,6 +1898,12 @@ private:
    */
   bool check_for_cell_similarity_allowed;
 
+  /**
+   * Whether the mapping and the finite element allow to reuse the data of
+   * a cell on a scaled copy of it, see check_cell_similarity().
+   */
+  bool check_for_scaled_translation_allowed;
+
   // Make the view classes friends of this class, since they access internal
   // data.
   template <int, int>
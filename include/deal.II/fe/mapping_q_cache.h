@@ -200,6 +200,35 @@ public:
   get_vertices(const typename Triangulation<dim, spacedim>::cell_iterator &cell)
     const override;
 
+  /**
+   * Return whether the given cell has been detected to be affine by
+   * initialize(), i.e., whether its mapping support points are the image of
+   * the support points of the unit cell under an affine map. This is only
+   * detected for `dim == spacedim`.
+   */
+  bool
+  is_affine(
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell) const;
+
+  // for documentation, see the Mapping base class
+  virtual Point<dim>
+  transform_real_to_unit_cell(
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+    const Point<spacedim> &p) const override;
+
+  /**
+   * Transform the points @p real_points on @p cell to the unit cell. For
+   * cells that are affine, see is_affine(), this function applies the inverse
+   * of the affine map cached by initialize() to all points, which is exact
+   * and much cheaper than the Newton iteration that
+   * MappingQ::transform_points_real_to_unit_cell() uses for general cells.
+   */
+  virtual void
+  transform_points_real_to_unit_cell(
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+    const ArrayView<const Point<spacedim>>                     &real_points,
+    const ArrayView<Point<dim>> &unit_points) const override;
+
   /**
    * Return the memory consumption (in bytes) of the cache.
    */
@@ -224,6 +253,47 @@ private:
   std::shared_ptr<std::vector<std::vector<std::vector<Point<spacedim>>>>>
     support_point_cache;
 
+  /**
+   * The inverse of the map from the unit cell to an affine cell, in terms
+   * of the first vertex of the cell and the inverse of the (constant)
+   * Jacobian.
+   */
+  struct AffineCellData
+  {
+    /**
+     * Whether the cell is affine. The other members are only valid if this
+     * flag is set.
+     */
+    bool is_affine = false;
+
+    /**
+     * The first vertex of the cell, i.e., the image of the origin of the
+     * unit cell.
+     */
+    Point<spacedim> origin;
+
+    /**
+     * The inverse of the Jacobian of the affine map.
+     */
+    Tensor<2, spacedim> inverse_jacobian;
+
+    /**
+     * Return the memory consumption (in bytes) of this object.
+     */
+    std::size_t
+    memory_consumption() const
+    {
+      return sizeof(*this);
+    }
+  };
+
+  /**
+   * The information about affine cells, computed together with the
+   * support_point_cache in initialize() and indexed in the same way. It is
+   * shared between clones like the support_point_cache.
+   */
+  std::shared_ptr<std::vector<std::vector<AffineCellData>>> affine_cell_cache;
+
   /**
    * The connection to Triangulation::signals::any that must be reset once
    * this class goes out of scope.
@@ -90,6 +90,17 @@ namespace hp
 
 class SparsityPattern;
 
+namespace Utilities
+{
+  namespace MPI
+  {
+    namespace ConsensusAlgorithms
+    {
+      class NeighborGraphCache;
+    }
+  } // namespace MPI
+} // namespace Utilities
+
 namespace GridTools
 {
   template <int dim, int spacedim>
@@ -811,6 +822,12 @@ namespace GridTools
      * If the input argument is set to true additional data structures are
      * set up to be able to set up the communication pattern within
      * Utilities::MPI::RemotePointEvaluation::reinit().
+     *
+     * If @p consensus_cache is given, the requests to the potential owners
+     * of the points are exchanged with
+     * Utilities::MPI::ConsensusAlgorithms::neighbor_graph(), which re-uses
+     * the communication pattern of the previous call with the same cache
+     * object if the potential owners have not changed on any process.
      */
     template <int dim, int spacedim>
     DistributedComputePointLocationsInternal<dim, spacedim>
@@ -821,7 +838,9 @@ namespace GridTools
       const std::vector<bool>                               &marked_vertices,
       const double                                           tolerance,
       const bool                                             perform_handshake,
-      const bool enforce_unique_mapping = false);
+      const bool enforce_unique_mapping = false,
+      Utilities::MPI::ConsensusAlgorithms::NeighborGraphCache *consensus_cache =
+        nullptr);
 
 
     /**
@@ -389,6 +389,11 @@ namespace internal
 
     CellAttachedDataSerializer();
 
+    /**
+     * Destructor. Completes a save that is still pending.
+     */
+    ~CellAttachedDataSerializer();
+
     /**
      * Prepare data serialization by calling the pack callback functions on each
      * cell in @p cell_relations.
@@ -460,6 +465,45 @@ namespace internal
          const std::string &filename,
          const MPI_Comm    &mpi_communicator) const;
 
+    /**
+     * Start to serialize data to the file system like save(), but return as
+     * soon as the write operations have been started instead of waiting for
+     * them to complete.
+     *
+     * The packed data is moved into staging buffers, so that the buffers of
+     * this object can be cleared and reused, e.g., for a subsequent mesh
+     * refinement, while the data is written in the background via
+     * nonblocking collective MPIIO operations. The write operations are
+     * completed by save_finish(), which needs to be called on all processes
+     * in @p mpi_communicator before the files are read again. A save that is
+     * still pending from a previous call is completed first.
+     *
+     * Without MPI support or on a single process, this function simply calls
+     * save().
+     *
+     * Data has to be previously packed with pack_data().
+     */
+    void
+    save_start(const unsigned int global_first_cell,
+               const unsigned int global_num_cells,
+               const std::string &filename,
+               const MPI_Comm    &mpi_communicator);
+
+    /**
+     * Wait for the write operations started by save_start() to complete,
+     * close the files, and free the staging buffers. Does nothing if no save
+     * is pending.
+     */
+    void
+    save_finish();
+
+    /**
+     * Return whether the write operations started by save_start() have not
+     * yet been completed by save_finish().
+     */
+    bool
+    save_pending() const;
+
     /**
      * Deserialize data from file system.
      *
@@ -528,6 +572,25 @@ namespace internal
     std::vector<int>  dest_sizes_variable;
     std::vector<char> src_data_variable;
     std::vector<char> dest_data_variable;
+
+    /**
+     * Staging buffers and MPI handles of a save started by save_start() that
+     * has not been completed by save_finish() yet.
+     */
+    struct PendingSave
+    {
+      std::vector<unsigned int> sizes_fixed_cumulative;
+      std::vector<char>         data_fixed;
+      std::vector<int>          sizes_variable;
+      std::vector<char>         data_variable;
+
+#ifdef DEAL_II_WITH_MPI
+      std::vector<MPI_File>    files;
+      std::vector<MPI_Request> requests;
+#endif
+    };
+
+    PendingSave pending_save;
   };
 } // namespace internal
 
@@ -3881,12 +3944,18 @@ protected:
    * Save additional cell-attached data into the given file. The first
    * arguments are used to determine the offsets where to write buffers to.
    *
+   * If @p asynchronous is set, the write operations are only started and
+   * completed later by internal::CellAttachedDataSerializer::save_finish(),
+   * see internal::CellAttachedDataSerializer::save_start(). A save that is
+   * still pending is always completed before new data is written.
+   *
    * Called by @ref save.
    */
   void
   save_attached_data(const unsigned int global_first_cell,
                      const unsigned int global_num_cells,
-                     const std::string &filename) const;
+                     const std::string &filename,
+                     const bool         asynchronous = false) const;
 
   /**
    * Load additional cell-attached data from the given file, if any was saved.
@@ -186,6 +186,17 @@ namespace hp
     const FEValuesType &
     get_present_fe_values() const;
 
+    /**
+     * Return the sum of the statistics on cell similarities of all the
+     * FEValues objects created so far, see
+     * dealii::FEValuesBase::get_cell_similarity_statistics(). Since each
+     * combination of finite element, mapping, and quadrature uses its own
+     * FEValues object, data can only be reused between cells with the same
+     * combination of indices.
+     */
+    typename FEValuesType::CellSimilarityStatistics
+    get_cell_similarity_statistics() const;
+
   protected:
     /**
      * Select a FEValues object suitable for the given FE, quadrature, and
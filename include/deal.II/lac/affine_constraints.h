@@ -20,6 +20,7 @@
 
 #include <deal.II/base/exceptions.h>
 #include <deal.II/base/index_set.h>
+#include <deal.II/base/memory_space.h>
 #include <deal.II/base/subscriptor.h>
 #include <deal.II/base/table.h>
 #include <deal.II/base/template_constraints.h>
@@ -52,6 +53,15 @@ class SparseMatrix;
 template <typename number>
 class BlockSparseMatrix;
 
+namespace LinearAlgebra
+{
+  namespace distributed
+  {
+    template <typename Number, typename MemorySpace>
+    class Vector;
+  }
+} // namespace LinearAlgebra
+
 namespace internal
 {
   namespace AffineConstraints
@@ -1838,6 +1848,55 @@ public:
   void
   distribute(VectorType &vec) const;
 
+  /**
+   * Start the distribute() operation for a distributed vector @p vec in a
+   * way that allows to overlap the import of the values the constraints
+   * depend on with computations.
+   *
+   * The function copies the locally owned elements of @p vec into
+   * @p ghosted_vector and starts the import of the needed ghost elements
+   * into it. While the messages are in flight, it sets all locally owned
+   * constrained elements of @p vec whose constraints only depend on locally
+   * owned elements. The remaining constrained elements are set by
+   * distribute_finish(), which has to be called with the same arguments
+   * before either vector is used again. In between, other computations that
+   * do not touch the two vectors may be performed.
+   *
+   * The vector @p ghosted_vector is a temporary vector that is re-initialized
+   * if its layout does not match the elements needed by this object, which
+   * is a collective operation. When the function is called repeatedly, e.g.,
+   * in every iteration of an iterative solver, the same vector should be
+   * passed every time so that the layout, and the communication pattern
+   * derived from it, is only set up once.
+   *
+   * In contrast to distribute(), this function does not check whether there
+   * are any constraints on any process, which would require a global
+   * reduction, and the import is always started.
+   *
+   * @note The vector @p vec must not contain ghost elements, and its locally
+   * owned elements need to be the ones given to reinit(). All processes
+   * need to call this function and distribute_finish().
+   */
+  template <typename Number>
+  void
+  distribute_start(
+    LinearAlgebra::distributed::Vector<Number, MemorySpace::Host> &vec,
+    LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>
+      &ghosted_vector) const;
+
+  /**
+   * Finish the distribute() operation started by distribute_start(): Wait
+   * for the import of the ghost elements of @p ghosted_vector to complete
+   * and set the locally owned constrained elements of @p vec whose
+   * constraints depend on elements owned by other processes.
+   */
+  template <typename Number>
+  void
+  distribute_finish(
+    LinearAlgebra::distributed::Vector<Number, MemorySpace::Host> &vec,
+    LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>
+      &ghosted_vector) const;
+
   /**
    * @}
    */
@@ -2195,6 +2254,15 @@ private:
    */
   IndexSet needed_elements_for_distribute;
 
+  /**
+   * The elements of needed_elements_for_distribute that are not locally
+   * owned, i.e., the ghost elements of the vector that distribute_start()
+   * imports.
+   *
+   * This variable is set in close().
+   */
+  IndexSet ghost_elements_for_distribute;
+
   /**
    * Store whether the arrays are sorted.  If so, no new entries can be added.
    */
@@ -2324,6 +2392,8 @@ inline AffineConstraints<number>::AffineConstraints(
   , local_lines(affine_constraints.local_lines)
   , needed_elements_for_distribute(
       affine_constraints.needed_elements_for_distribute)
+  , ghost_elements_for_distribute(
+      affine_constraints.ghost_elements_for_distribute)
   , sorted(affine_constraints.sorted)
 {}
 
@@ -2768,6 +2838,7 @@ AffineConstraints<number>::copy_from(
 
   locally_owned_dofs             = other.locally_owned_dofs;
   needed_elements_for_distribute = other.needed_elements_for_distribute;
+  ghost_elements_for_distribute  = other.ghost_elements_for_distribute;
 }
 
 
@@ -1125,6 +1125,9 @@ AffineConstraints<number>::close()
                                                  additional_elements.end());
     }
 
+  ghost_elements_for_distribute = needed_elements_for_distribute;
+  ghost_elements_for_distribute.subtract_set(locally_owned_dofs);
+
   sorted = true;
 }
 
@@ -1265,6 +1268,7 @@ AffineConstraints<number>::clear()
   locally_owned_dofs             = {};
   local_lines                    = {};
   needed_elements_for_distribute = {};
+  ghost_elements_for_distribute  = {};
 
   sorted = false;
 }
@@ -2950,6 +2954,147 @@ AffineConstraints<number>::distribute(VectorType &vec) const
     }
 }
 
+
+
+namespace internal
+{
+  namespace AffineConstraints
+  {
+    /**
+     * The communication channel used by the ghost exchange of
+     * AffineConstraints::distribute_start(). Computations that are overlapped
+     * with the exchange, such as the cell loops of MatrixFree, use the first
+     * channels for their own exchanges, so use the last one.
+     */
+    constexpr unsigned int distribute_communication_channel = 199;
+  } // namespace AffineConstraints
+} // namespace internal
+
+
+
+template <typename number>
+template <typename Number>
+void
+AffineConstraints<number>::distribute_start(
+  LinearAlgebra::distributed::Vector<Number, MemorySpace::Host> &vec,
+  LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>
+    &ghosted_vector) const
+{
+  Assert(sorted == true, ExcMatrixNotClosed());
+  Assert(!vec.has_ghost_elements(), ExcGhostsPresent());
+
+  const IndexSet &owned_elements =
+    vec.get_partitioner()->locally_owned_range();
+
+  // The elements to import have been determined in close() for the locally
+  // owned elements given to reinit(). If the object has not been initialized
+  // with index sets, we need to import all elements.
+  IndexSet        all_other_elements;
+  const IndexSet *ghost_elements = &ghost_elements_for_distribute;
+  if (local_lines == IndexSet())
+    {
+      all_other_elements = complete_index_set(owned_elements.size());
+      all_other_elements.subtract_set(owned_elements);
+      ghost_elements = &all_other_elements;
+    }
+  else
+    Assert(owned_elements == locally_owned_dofs,
+           ExcMessage("The locally owned elements of the vector need to be "
+                      "the ones given to reinit()."));
+
+  // Set up the layout of the ghosted vector unless it matches already. All
+  // processes take the same decision as long as they pass the same vectors
+  // in every call, which is necessary since the setup is collective.
+  const bool layout_matches =
+    ghosted_vector.size() == vec.size() &&
+    ghosted_vector.get_partitioner()->locally_owned_range() ==
+      owned_elements &&
+    ghosted_vector.get_partitioner()->ghost_indices() == *ghost_elements;
+  Assert(Utilities::MPI::min(static_cast<unsigned int>(layout_matches),
+                             vec.get_mpi_communicator()) ==
+           Utilities::MPI::max(static_cast<unsigned int>(layout_matches),
+                               vec.get_mpi_communicator()),
+         ExcMessage("The vector passed as ghosted_vector needs to be set up "
+                    "on all processes or on none."));
+  if (layout_matches == false)
+    ghosted_vector.reinit(owned_elements,
+                          *ghost_elements,
+                          vec.get_mpi_communicator());
+
+  ghosted_vector.copy_locally_owned_data_from(vec);
+  ghosted_vector.update_ghost_values_start(
+    internal::AffineConstraints::distribute_communication_channel);
+
+  // While the ghost values are in flight, set those constrained elements
+  // whose constraints only involve locally owned elements. Since the
+  // constraints have been resolved by close(), they only depend on
+  // unconstrained elements, which distribute() does not change.
+  for (const ConstraintLine &line : lines)
+    if (owned_elements.is_element(line.index))
+      {
+        bool all_entries_owned = true;
+        for (const std::pair<size_type, number> &entry : line.entries)
+          if (owned_elements.is_element(entry.first) == false)
+            {
+              all_entries_owned = false;
+              break;
+            }
+
+        if (all_entries_owned)
+          {
+            Number new_value = line.inhomogeneity;
+            for (const std::pair<size_type, number> &entry : line.entries)
+              new_value += vec(entry.first) * entry.second;
+            AssertIsFinite(new_value);
+            vec(line.index) = new_value;
+          }
+      }
+}
+
+
+
+template <typename number>
+template <typename Number>
+void
+AffineConstraints<number>::distribute_finish(
+  LinearAlgebra::distributed::Vector<Number, MemorySpace::Host> &vec,
+  LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>
+    &ghosted_vector) const
+{
+  ghosted_vector.update_ghost_values_finish();
+
+  const IndexSet &owned_elements =
+    vec.get_partitioner()->locally_owned_range();
+
+  // Set the constrained elements skipped by distribute_start(). For those,
+  // the locally owned elements are read from the ghosted vector as well
+  // because the elements of vec might already have been overwritten.
+  for (const ConstraintLine &line : lines)
+    if (owned_elements.is_element(line.index))
+      {
+        bool all_entries_owned = true;
+        for (const std::pair<size_type, number> &entry : line.entries)
+          if (owned_elements.is_element(entry.first) == false)
+            {
+              all_entries_owned = false;
+              break;
+            }
+
+        if (all_entries_owned == false)
+          {
+            Number new_value = line.inhomogeneity;
+            for (const std::pair<size_type, number> &entry : line.entries)
+              new_value += ghosted_vector(entry.first) * entry.second;
+            AssertIsFinite(new_value);
+            vec(line.index) = new_value;
+          }
+      }
+
+  ghosted_vector.zero_out_ghost_values();
+}
+
+
+
 // Some helper definitions for the local_to_global functions.
 namespace internal
 {
@@ -0,0 +1,269 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+#ifndef dealii_inner_product_batch_h
+#define dealii_inner_product_batch_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/memory_space.h>
+#include <deal.II/base/mpi.h>
+
+#include <type_traits>
+
+DEAL_II_NAMESPACE_OPEN
+
+// Forward declarations
+#ifndef DOXYGEN
+namespace LinearAlgebra
+{
+  namespace distributed
+  {
+    template <typename Number, typename MemorySpace>
+    class Vector;
+    template <typename Number>
+    class BlockVector;
+  } // namespace distributed
+} // namespace LinearAlgebra
+#endif
+
+
+/**
+ * A class that collects several inner products of vectors and computes them
+ * with a single global reduction, see Utilities::MPI::ReductionBatch. The
+ * inner products are registered with inner_product() and add_and_dot(),
+ * which return the index under which the result can be queried once
+ * compute() (or compute_start() and compute_finish()) has been called. The
+ * indices are assigned consecutively, starting at zero:
+ * @code
+ * InnerProductBatch<VectorType> products(r);
+ * const unsigned int t_dot_r = products.inner_product(t, r);
+ * const unsigned int t_dot_t = products.inner_product(t, t);
+ * products.compute();
+ * const double omega = products[t_dot_r] / products[t_dot_t];
+ * @endcode
+ *
+ * For LinearAlgebra::distributed::Vector and
+ * LinearAlgebra::distributed::BlockVector, only the contributions of the
+ * locally owned elements are computed when an inner product is registered,
+ * and the sums over all processes are taken in compute(). This is how the
+ * iterative solvers SolverBicgstab and SolverIDR combine the inner products
+ * that are needed at the same point of the algorithm. For all other vector
+ * types, the inner products are evaluated immediately through the vector's
+ * own functions and compute() does not communicate.
+ *
+ * @ingroup Vectors
+ */
+template <typename VectorType>
+class InnerProductBatch
+{
+public:
+  /**
+   * The scalar type of the vectors and the inner products.
+   */
+  using value_type = typename VectorType::value_type;
+
+  /**
+   * Constructor. The reductions are done over the communicator of
+   * @p vector.
+   */
+  explicit InnerProductBatch(const VectorType &vector);
+
+  /**
+   * Register the inner product <tt>u*v</tt> and return its index.
+   */
+  unsigned int
+  inner_product(const VectorType &u, const VectorType &v);
+
+  /**
+   * Perform the operation <tt>u.add(a, v)</tt> and register the inner
+   * product of the result with @p w, like VectorType::add_and_dot() does.
+   * Return the index of the inner product.
+   */
+  unsigned int
+  add_and_dot(VectorType       &u,
+              const value_type  a,
+              const VectorType &v,
+              const VectorType &w);
+
+  /**
+   * Compute all registered inner products with a single reduction.
+   */
+  void
+  compute();
+
+  /**
+   * Start the computation of all registered inner products with a
+   * non-blocking reduction.
+   */
+  void
+  compute_start();
+
+  /**
+   * Finish the non-blocking reduction started by compute_start().
+   */
+  void
+  compute_finish();
+
+  /**
+   * Return the inner product with the given @p index.
+   */
+  const value_type &
+  operator[](const unsigned int index) const;
+
+private:
+  /**
+   * Whether VectorType is a LinearAlgebra::distributed::Vector on the host.
+   */
+  static constexpr bool is_distributed_vector = std::is_same_v<
+    VectorType,
+    LinearAlgebra::distributed::Vector<value_type, MemorySpace::Host>>;
+
+  /**
+   * Whether VectorType is a LinearAlgebra::distributed::BlockVector.
+   */
+  static constexpr bool is_distributed_block_vector =
+    std::is_same_v<VectorType,
+                   LinearAlgebra::distributed::BlockVector<value_type>>;
+
+  /**
+   * Return the communicator over which the local inner products of vectors
+   * like @p vector need to be summed.
+   */
+  static MPI_Comm
+  get_communicator(const VectorType &vector);
+
+  /**
+   * The local contributions and, after the reduction, the inner products.
+   */
+  Utilities::MPI::ReductionBatch<value_type> batch;
+};
+
+
+
+#ifndef DOXYGEN
+
+template <typename VectorType>
+inline InnerProductBatch<VectorType>::InnerProductBatch(
+  const VectorType &vector)
+  : batch(get_communicator(vector))
+{}
+
+
+
+template <typename VectorType>
+inline MPI_Comm
+InnerProductBatch<VectorType>::get_communicator(const VectorType &vector)
+{
+  if constexpr (is_distributed_vector)
+    return vector.get_mpi_communicator();
+  else if constexpr (is_distributed_block_vector)
+    return vector.n_blocks() > 0 ? vector.block(0).get_mpi_communicator() :
+                                   MPI_COMM_SELF;
+  else
+    {
+      (void)vector;
+      return MPI_COMM_SELF;
+    }
+}
+
+
+
+template <typename VectorType>
+inline unsigned int
+InnerProductBatch<VectorType>::inner_product(const VectorType &u,
+                                             const VectorType &v)
+{
+  if constexpr (is_distributed_vector)
+    return batch.add(u.inner_product_local(v));
+  else if constexpr (is_distributed_block_vector)
+    {
+      AssertDimension(u.n_blocks(), v.n_blocks());
+      value_type local_result = value_type();
+      for (unsigned int b = 0; b < u.n_blocks(); ++b)
+        local_result += u.block(b).inner_product_local(v.block(b));
+      return batch.add(local_result);
+    }
+  else
+    return batch.add(u * v);
+}
+
+
+
+template <typename VectorType>
+inline unsigned int
+InnerProductBatch<VectorType>::add_and_dot(VectorType       &u,
+                                           const value_type  a,
+                                           const VectorType &v,
+                                           const VectorType &w)
+{
+  if constexpr (is_distributed_vector)
+    return batch.add(u.add_and_dot_local(a, v, w));
+  else if constexpr (is_distributed_block_vector)
+    {
+      AssertDimension(u.n_blocks(), v.n_blocks());
+      AssertDimension(u.n_blocks(), w.n_blocks());
+      value_type local_result = value_type();
+      for (unsigned int b = 0; b < u.n_blocks(); ++b)
+        local_result +=
+          u.block(b).add_and_dot_local(a, v.block(b), w.block(b));
+      return batch.add(local_result);
+    }
+  else
+    return batch.add(u.add_and_dot(a, v, w));
+}
+
+
+
+template <typename VectorType>
+inline void
+InnerProductBatch<VectorType>::compute()
+{
+  batch.compute();
+}
+
+
+
+template <typename VectorType>
+inline void
+InnerProductBatch<VectorType>::compute_start()
+{
+  batch.compute_start();
+}
+
+
+
+template <typename VectorType>
+inline void
+InnerProductBatch<VectorType>::compute_finish()
+{
+  batch.compute_finish();
+}
+
+
+
+template <typename VectorType>
+inline const typename InnerProductBatch<VectorType>::value_type &
+InnerProductBatch<VectorType>::operator[](const unsigned int index) const
+{
+  return batch[index];
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -690,8 +690,8 @@ namespace LinearAlgebra
         local_result += this->block(i).inner_product_local(v.block(i));
 
       if (this->block(0).partitioner->n_mpi_processes() > 1)
-        return Utilities::MPI::sum(
-          local_result, this->block(0).partitioner->get_mpi_communicator());
+        return Utilities::MPI::node_aware_sum(
+          local_result, this->block(0).partitioner->get_node_topology());
       else
         return local_result;
     }
@@ -711,9 +711,9 @@ namespace LinearAlgebra
                           this->block(i).partitioner->locally_owned_size());
 
       if (this->block(0).partitioner->n_mpi_processes() > 1)
-        return Utilities::MPI::sum(
+        return Utilities::MPI::node_aware_sum(
                  local_result,
-                 this->block(0).partitioner->get_mpi_communicator()) /
+                 this->block(0).partitioner->get_node_topology()) /
                static_cast<real_type>(this->size());
       else
         return local_result / static_cast<real_type>(this->size());
@@ -732,8 +732,8 @@ namespace LinearAlgebra
         local_result += this->block(i).l1_norm_local();
 
       if (this->block(0).partitioner->n_mpi_processes() > 1)
-        return Utilities::MPI::sum(
-          local_result, this->block(0).partitioner->get_mpi_communicator());
+        return Utilities::MPI::node_aware_sum(
+          local_result, this->block(0).partitioner->get_node_topology());
       else
         return local_result;
     }
@@ -751,8 +751,8 @@ namespace LinearAlgebra
         local_result += this->block(i).norm_sqr_local();
 
       if (this->block(0).partitioner->n_mpi_processes() > 1)
-        return Utilities::MPI::sum(
-          local_result, this->block(0).partitioner->get_mpi_communicator());
+        return Utilities::MPI::node_aware_sum(
+          local_result, this->block(0).partitioner->get_node_topology());
       else
         return local_result;
     }
@@ -779,10 +779,10 @@ namespace LinearAlgebra
         local_result += std::pow(this->block(i).lp_norm_local(p), p);
 
       if (this->block(0).partitioner->n_mpi_processes() > 1)
-        return std::pow(Utilities::MPI::sum(
-                          local_result,
-                          this->block(0).partitioner->get_mpi_communicator()),
-                        static_cast<real_type>(1.0 / p));
+        return std::pow(
+          Utilities::MPI::node_aware_sum(
+            local_result, this->block(0).partitioner->get_node_topology()),
+          static_cast<real_type>(1.0 / p));
       else
         return std::pow(local_result, static_cast<real_type>(1.0 / p));
     }
@@ -801,8 +801,8 @@ namespace LinearAlgebra
           std::max(local_result, this->block(i).linfty_norm_local());
 
       if (this->block(0).partitioner->n_mpi_processes() > 1)
-        return Utilities::MPI::max(
-          local_result, this->block(0).partitioner->get_mpi_communicator());
+        return Utilities::MPI::node_aware_max(
+          local_result, this->block(0).partitioner->get_node_topology());
       else
         return local_result;
     }
@@ -824,8 +824,8 @@ namespace LinearAlgebra
           this->block(i).add_and_dot_local(a, v.block(i), w.block(i));
 
       if (this->block(0).partitioner->n_mpi_processes() > 1)
-        return Utilities::MPI::sum(
-          local_result, this->block(0).partitioner->get_mpi_communicator());
+        return Utilities::MPI::node_aware_sum(
+          local_result, this->block(0).partitioner->get_node_topology());
       else
         return local_result;
     }
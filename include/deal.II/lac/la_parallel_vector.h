@@ -38,6 +38,9 @@ DEAL_II_NAMESPACE_OPEN
 
 // Forward declarations
 #ifndef DOXYGEN
+template <typename VectorType>
+class InnerProductBatch;
+
 namespace LinearAlgebra
 {
   /**
@@ -245,6 +248,17 @@ namespace LinearAlgebra
      *   MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL,
      *                       &comm_sm);
      * @endcode
+     *
+     * If the same communicator has also been passed to
+     * Utilities::MPI::Partitioner::set_shared_memory_communicator() of the
+     * partitioner of the vector, update_ghost_values() and compress() copy
+     * the ghost values of the processes on the same shared-memory domain
+     * directly from their memory rather than sending MPI messages, which are
+     * only used for processes on other nodes. Since the allocation of the
+     * shared-memory window is collective and comparably expensive, this is
+     * opt-in for each vector: vectors initialized with the default
+     * `comm_sm = MPI_COMM_SELF` use private memory and MPI messages also
+     * when their partitioner has a shared-memory communicator.
      */
     template <typename Number, typename MemorySpace = MemorySpace::Host>
     class Vector : public ::dealii::ReadVector<Number>, public Subscriptor
@@ -1427,6 +1441,17 @@ namespace LinearAlgebra
       void
       clear_mpi_requests();
 
+      /**
+       * Return whether the ghost data is exchanged with the processes on the
+       * same shared-memory domain by direct memory access, which is the case
+       * if the memory of this vector has been allocated on the shared-memory
+       * communicator of the partitioner (i.e., the same communicator was
+       * passed as `comm_sm` to reinit()), see
+       * Utilities::MPI::Partitioner::set_shared_memory_communicator().
+       */
+      bool
+      use_shared_memory_exchange() const;
+
       /**
        * A helper function that is used to resize the val array.
        */
@@ -1441,6 +1466,11 @@ namespace LinearAlgebra
       // Make BlockVector type friends.
       template <typename Number2>
       friend class BlockVector;
+
+      // Make InnerProductBatch a friend, which accesses the local parts of
+      // the inner products.
+      template <typename VectorType>
+      friend class dealii::InnerProductBatch;
     };
     /** @} */
 
@@ -133,7 +133,16 @@ namespace LinearAlgebra
         {
           if (comm_shared == MPI_COMM_SELF)
             {
-              Kokkos::resize(data.values, new_alloc_size);
+              // if the vector used a shared-memory window before, Kokkos
+              // must not keep pointing into it even if the size is unchanged
+              if (data.values_sm_ptr)
+                {
+                  data.values = Kokkos::View<Number *, Kokkos::HostSpace>(
+                    "memoryspace data", new_alloc_size);
+                  data.values_sm_ptr.reset();
+                }
+              else
+                Kokkos::resize(data.values, new_alloc_size);
 
               allocated_size = new_alloc_size;
 
@@ -499,23 +508,37 @@ namespace LinearAlgebra
     Vector<Number, MemorySpaceType>::clear_mpi_requests()
     {
 #ifdef DEAL_II_WITH_MPI
+      // the shared-memory exchange might leave null requests in the lists
       for (auto &compress_request : compress_requests)
-        {
-          const int ierr = MPI_Request_free(&compress_request);
-          AssertThrowMPI(ierr);
-        }
+        if (compress_request != MPI_REQUEST_NULL)
+          {
+            const int ierr = MPI_Request_free(&compress_request);
+            AssertThrowMPI(ierr);
+          }
       compress_requests.clear();
       for (auto &update_ghost_values_request : update_ghost_values_requests)
-        {
-          const int ierr = MPI_Request_free(&update_ghost_values_request);
-          AssertThrowMPI(ierr);
-        }
+        if (update_ghost_values_request != MPI_REQUEST_NULL)
+          {
+            const int ierr = MPI_Request_free(&update_ghost_values_request);
+            AssertThrowMPI(ierr);
+          }
       update_ghost_values_requests.clear();
 #endif
     }
 
 
 
+    template <typename Number, typename MemorySpaceType>
+    bool
+    Vector<Number, MemorySpaceType>::use_shared_memory_exchange() const
+    {
+      return std::is_same_v<MemorySpaceType, MemorySpace::Host> &&
+             comm_sm != MPI_COMM_SELF &&
+             partitioner->get_shared_memory_communicator() == comm_sm;
+    }
+
+
+
     template <typename Number, typename MemorySpaceType>
     void
     Vector<Number, MemorySpaceType>::resize_val(const size_type new_alloc_size,
@@ -599,15 +622,14 @@ namespace LinearAlgebra
       clear_mpi_requests();
       Assert(v.partitioner.get() != nullptr, ExcNotInitialized());
 
-      this->comm_sm = v.comm_sm;
-
       // check whether the partitioners are
       // different (check only if the are allocated
       // differently, not if the actual data is
       // different)
-      if (partitioner.get() != v.partitioner.get())
+      if (partitioner.get() != v.partitioner.get() || comm_sm != v.comm_sm)
         {
-          partitioner = v.partitioner;
+          partitioner   = v.partitioner;
+          this->comm_sm = v.comm_sm;
           const size_type new_allocated_size =
             partitioner->locally_owned_size() + partitioner->n_ghost_indices();
           resize_val(new_allocated_size, this->comm_sm);
@@ -666,15 +688,17 @@ namespace LinearAlgebra
     {
       clear_mpi_requests();
 
-      this->comm_sm = comm_sm;
-
-      // set vector size and allocate memory
-      if (partitioner.get() != partitioner_in.get())
+      // set vector size and allocate memory; the memory also needs to be
+      // allocated anew if it is to be (or was) shared between a different
+      // set of processes
+      if (partitioner.get() != partitioner_in.get() ||
+          this->comm_sm != comm_sm)
         {
-          partitioner = partitioner_in;
+          partitioner   = partitioner_in;
+          this->comm_sm = comm_sm;
           const size_type new_allocated_size =
             partitioner->locally_owned_size() + partitioner->n_ghost_indices();
-          resize_val(new_allocated_size, comm_sm);
+          resize_val(new_allocated_size, this->comm_sm);
         }
 
       // initialize to zero
@@ -1023,15 +1047,27 @@ namespace LinearAlgebra
       else
 #  endif
         {
-          partitioner->import_from_ghosted_array_start(
-            operation,
-            communication_channel,
-            ArrayView<Number, MemorySpaceType>(
-              data.values.data() + partitioner->locally_owned_size(),
-              partitioner->n_ghost_indices()),
-            ArrayView<Number, MemorySpaceType>(import_data.values.data(),
-                                               partitioner->n_import_indices()),
-            compress_requests);
+          if (use_shared_memory_exchange())
+            partitioner->import_from_ghosted_array_start(
+              operation,
+              communication_channel,
+              data.values_sm,
+              ArrayView<Number>(data.values.data() +
+                                  partitioner->locally_owned_size(),
+                                partitioner->n_ghost_indices()),
+              ArrayView<Number>(import_data.values.data(),
+                                partitioner->n_import_indices()),
+              compress_requests);
+          else
+            partitioner->import_from_ghosted_array_start(
+              operation,
+              communication_channel,
+              ArrayView<Number, MemorySpaceType>(
+                data.values.data() + partitioner->locally_owned_size(),
+                partitioner->n_ghost_indices()),
+              ArrayView<Number, MemorySpaceType>(
+                import_data.values.data(), partitioner->n_import_indices()),
+              compress_requests);
         }
 #else
       (void)communication_channel;
@@ -1088,17 +1124,30 @@ namespace LinearAlgebra
           Assert(partitioner->n_import_indices() == 0 ||
                    import_data.values.size() != 0,
                  ExcNotInitialized());
-          partitioner
-            ->import_from_ghosted_array_finish<Number, MemorySpaceType>(
+          if (use_shared_memory_exchange())
+            partitioner->import_from_ghosted_array_finish(
               operation,
-              ArrayView<const Number, MemorySpaceType>(
-                import_data.values.data(), partitioner->n_import_indices()),
-              ArrayView<Number, MemorySpaceType>(
-                data.values.data(), partitioner->locally_owned_size()),
-              ArrayView<Number, MemorySpaceType>(
-                data.values.data() + partitioner->locally_owned_size(),
-                partitioner->n_ghost_indices()),
+              ArrayView<const Number>(import_data.values.data(),
+                                      partitioner->n_import_indices()),
+              data.values_sm,
+              ArrayView<Number>(data.values.data(),
+                                partitioner->locally_owned_size()),
+              ArrayView<Number>(data.values.data() +
+                                  partitioner->locally_owned_size(),
+                                partitioner->n_ghost_indices()),
               compress_requests);
+          else
+            partitioner
+              ->import_from_ghosted_array_finish<Number, MemorySpaceType>(
+                operation,
+                ArrayView<const Number, MemorySpaceType>(
+                  import_data.values.data(), partitioner->n_import_indices()),
+                ArrayView<Number, MemorySpaceType>(
+                  data.values.data(), partitioner->locally_owned_size()),
+                ArrayView<Number, MemorySpaceType>(
+                  data.values.data() + partitioner->locally_owned_size(),
+                  partitioner->n_ghost_indices()),
+                compress_requests);
         }
 #else
       (void)operation;
@@ -1174,16 +1223,29 @@ namespace LinearAlgebra
       else
 #  endif
         {
-          partitioner->export_to_ghosted_array_start<Number, MemorySpaceType>(
-            communication_channel,
-            ArrayView<const Number, MemorySpaceType>(
-              data.values.data(), partitioner->locally_owned_size()),
-            ArrayView<Number, MemorySpaceType>(import_data.values.data(),
-                                               partitioner->n_import_indices()),
-            ArrayView<Number, MemorySpaceType>(
-              data.values.data() + partitioner->locally_owned_size(),
-              partitioner->n_ghost_indices()),
-            update_ghost_values_requests);
+          if (use_shared_memory_exchange())
+            partitioner->export_to_ghosted_array_start(
+              communication_channel,
+              ArrayView<const Number>(data.values.data(),
+                                      partitioner->locally_owned_size()),
+              data.values_sm,
+              ArrayView<Number>(import_data.values.data(),
+                                partitioner->n_import_indices()),
+              ArrayView<Number>(data.values.data() +
+                                  partitioner->locally_owned_size(),
+                                partitioner->n_ghost_indices()),
+              update_ghost_values_requests);
+          else
+            partitioner->export_to_ghosted_array_start<Number, MemorySpaceType>(
+              communication_channel,
+              ArrayView<const Number, MemorySpaceType>(
+                data.values.data(), partitioner->locally_owned_size()),
+              ArrayView<Number, MemorySpaceType>(
+                import_data.values.data(), partitioner->n_import_indices()),
+              ArrayView<Number, MemorySpaceType>(
+                data.values.data() + partitioner->locally_owned_size(),
+                partitioner->n_ghost_indices()),
+              update_ghost_values_requests);
         }
 
 #else
@@ -1200,8 +1262,9 @@ namespace LinearAlgebra
 #ifdef DEAL_II_WITH_MPI
       // wait for both sends and receives to complete, even though only
       // receives are really necessary. this gives (much) better performance
-      AssertDimension(partitioner->ghost_targets().size() +
-                        partitioner->import_targets().size(),
+      AssertDimension((use_shared_memory_exchange() ? 2 : 1) *
+                        (partitioner->ghost_targets().size() +
+                         partitioner->import_targets().size()),
                       update_ghost_values_requests.size());
       if (update_ghost_values_requests.size() > 0)
         {
@@ -1232,11 +1295,19 @@ namespace LinearAlgebra
           else
 #  endif
             {
-              partitioner->export_to_ghosted_array_finish(
-                ArrayView<Number, MemorySpaceType>(
-                  data.values.data() + partitioner->locally_owned_size(),
-                  partitioner->n_ghost_indices()),
-                update_ghost_values_requests);
+              if (use_shared_memory_exchange())
+                partitioner->export_to_ghosted_array_finish(
+                  data.values_sm,
+                  ArrayView<Number>(data.values.data() +
+                                      partitioner->locally_owned_size(),
+                                    partitioner->n_ghost_indices()),
+                  update_ghost_values_requests);
+              else
+                partitioner->export_to_ghosted_array_finish(
+                  ArrayView<Number, MemorySpaceType>(
+                    data.values.data() + partitioner->locally_owned_size(),
+                    partitioner->n_ghost_indices()),
+                  update_ghost_values_requests);
             }
         }
 
@@ -1748,8 +1819,8 @@ namespace LinearAlgebra
     {
       Number local_result = inner_product_local(v);
       if (partitioner->n_mpi_processes() > 1)
-        return Utilities::MPI::sum(local_result,
-                                   partitioner->get_mpi_communicator());
+        return Utilities::MPI::node_aware_sum(
+          local_result, partitioner->get_node_topology());
       else
         return local_result;
     }
@@ -1800,10 +1871,10 @@ namespace LinearAlgebra
     {
       Number local_result = mean_value_local();
       if (partitioner->n_mpi_processes() > 1)
-        return Utilities::MPI::sum(local_result *
-                                     static_cast<real_type>(
-                                       partitioner->locally_owned_size()),
-                                   partitioner->get_mpi_communicator()) /
+        return Utilities::MPI::node_aware_sum(
+                 local_result *
+                   static_cast<real_type>(partitioner->locally_owned_size()),
+                 partitioner->get_node_topology()) /
                static_cast<real_type>(partitioner->size());
       else
         return local_result;
@@ -1835,8 +1906,8 @@ namespace LinearAlgebra
     {
       real_type local_result = l1_norm_local();
       if (partitioner->n_mpi_processes() > 1)
-        return Utilities::MPI::sum(local_result,
-                                   partitioner->get_mpi_communicator());
+        return Utilities::MPI::node_aware_sum(
+          local_result, partitioner->get_node_topology());
       else
         return local_result;
     }
@@ -1849,8 +1920,8 @@ namespace LinearAlgebra
     {
       real_type local_result = norm_sqr_local();
       if (partitioner->n_mpi_processes() > 1)
-        return Utilities::MPI::sum(local_result,
-                                   partitioner->get_mpi_communicator());
+        return Utilities::MPI::node_aware_sum(
+          local_result, partitioner->get_node_topology());
       else
         return local_result;
     }
@@ -1892,8 +1963,8 @@ namespace LinearAlgebra
       const real_type local_result = lp_norm_local(p);
       if (partitioner->n_mpi_processes() > 1)
         return std::pow(
-          Utilities::MPI::sum(std::pow(local_result, p),
-                              partitioner->get_mpi_communicator()),
+          Utilities::MPI::node_aware_sum(std::pow(local_result, p),
+                                         partitioner->get_node_topology()),
           static_cast<real_type>(1.0 / p));
       else
         return local_result;
@@ -1923,8 +1994,8 @@ namespace LinearAlgebra
     {
       const real_type local_result = linfty_norm_local();
       if (partitioner->n_mpi_processes() > 1)
-        return Utilities::MPI::max(local_result,
-                                   partitioner->get_mpi_communicator());
+        return Utilities::MPI::node_aware_max(
+          local_result, partitioner->get_node_topology());
       else
         return local_result;
     }
@@ -1962,8 +2033,8 @@ namespace LinearAlgebra
     {
       Number local_result = add_and_dot_local(a, v, w);
       if (partitioner->n_mpi_processes() > 1)
-        return Utilities::MPI::sum(local_result,
-                                   partitioner->get_mpi_communicator());
+        return Utilities::MPI::node_aware_sum(
+          local_result, partitioner->get_node_topology());
       else
         return local_result;
     }
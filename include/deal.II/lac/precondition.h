@@ -33,6 +33,7 @@
 #include <deal.II/lac/vector_memory.h>
 
 #include <limits>
+#include <optional>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -2068,6 +2069,42 @@ public:
      * Specifies the polynomial type to be used.
      */
     PolynomialType polynomial_type;
+
+    /**
+     * If set to a positive number, the estimate of the largest eigenvalue is
+     * updated every @p eigenvalue_update_interval applications of vmult(),
+     * Tvmult(), step(), or Tstep() by update_eigenvalue_estimates(). This
+     * allows to track the spectrum of operators that change slowly between
+     * applications, e.g., because of coefficients that depend on time or on
+     * the solution of a nonlinear problem, without calling initialize()
+     * again. The default value of zero disables the updates.
+     */
+    unsigned int eigenvalue_update_interval;
+
+    /**
+     * Number of steps of the power iteration performed in each update
+     * triggered by @p eigenvalue_update_interval. As the iteration is
+     * started from the eigenvector approximation of the previous update
+     * (or of the power iteration in the initial eigenvalue estimation), few
+     * iterations are usually enough. Since a power iteration with few steps
+     * underestimates the largest eigenvalue, an update by default never
+     * reduces the current estimate, see @p eigenvalue_update_monotone.
+     */
+    unsigned int eigenvalue_update_n_iterations;
+
+    /**
+     * If true (the default), an update of the eigenvalue estimates through
+     * update_eigenvalue_estimates() takes the maximum of the current
+     * estimate of the largest eigenvalue and the new one. This protects
+     * against the underestimation of a power iteration with few steps, in
+     * particular in the first update if the initial estimation did not use
+     * the power iteration, but the estimate then cannot follow an operator
+     * whose spectrum shrinks. If false, the new estimate replaces the
+     * current one, which tracks the spectrum in both directions and relies on
+     * the safety factor of 1.2 and enough iterations in
+     * @p eigenvalue_update_n_iterations to not underestimate it.
+     */
+    bool eigenvalue_update_monotone;
   };
 
 
@@ -2186,7 +2223,79 @@ public:
   EigenvalueInformation
   estimate_eigenvalues(const VectorType &src) const;
 
+  /**
+   * Set the estimates of the smallest and largest eigenvalue of the
+   * preconditioned matrix from outside information, instead of running the
+   * eigenvalue algorithm selected in AdditionalData. A typical source are
+   * the Ritz values of a conjugate gradient solver run on the same
+   * preconditioned matrix, which are available at no additional cost:
+   * @code
+   * SolverCG<VectorType> solver(control);
+   * solver.connect_eigenvalues_slot(
+   *   [&chebyshev](const std::vector<double> &eigenvalues) {
+   *     chebyshev.set_eigenvalue_estimates(eigenvalues.front(),
+   *                                        eigenvalues.back());
+   *   });
+   * solver.solve(matrix, solution, rhs, *additional_data.preconditioner);
+   * @endcode
+   * As for the internal estimate, the largest eigenvalue is multiplied by a
+   * safety factor of 1.2. If called before the first application of the
+   * preconditioner, the given values replace the eigenvalue computation in
+   * estimate_eigenvalues(), otherwise the coefficients of the Chebyshev
+   * polynomial are adjusted immediately.
+   */
+  EigenvalueInformation
+  set_eigenvalue_estimates(const double min_eigenvalue,
+                           const double max_eigenvalue);
+
+  /**
+   * Update the estimate of the largest eigenvalue by @p n_iterations steps
+   * of a power iteration, starting from the eigenvector approximation of
+   * the previous update. On the first call, the iteration starts from the
+   * eigenvector approximation of the initial eigenvalue estimation if the
+   * power iteration was selected there and
+   * AdditionalData::eigenvalue_update_interval is positive, and from the
+   * initial guess described in the class documentation otherwise.
+   *
+   * The new estimate is the result of the power iteration multiplied by a
+   * safety factor of 1.2. Since a power iteration with few steps only
+   * approaches the largest eigenvalue from below, and an underestimated
+   * largest eigenvalue can make the Chebyshev iteration diverge, the maximum
+   * of the current estimate and the new one is used if
+   * AdditionalData::eigenvalue_update_monotone is set, which is the default.
+   * The estimate of the smallest eigenvalue is kept. The layout of the
+   * vector @p src is used to create internal temporary vectors.
+   *
+   * This function is called automatically if
+   * AdditionalData::eigenvalue_update_interval is positive.
+   */
+  EigenvalueInformation
+  update_eigenvalue_estimates(const VectorType  &src,
+                              const unsigned int n_iterations) const;
+
 private:
+  /**
+   * Compute the parameters theta and delta of the Chebyshev polynomial (and
+   * the degree if requested) from the eigenvalue estimates in @p info.
+   */
+  void
+  set_polynomial_parameters(EigenvalueInformation &info) const;
+
+  /**
+   * Implementation of update_eigenvalue_estimates() without locking the
+   * mutex.
+   */
+  EigenvalueInformation
+  do_update_eigenvalue_estimates(const VectorType  &src,
+                                 const unsigned int n_iterations) const;
+
+  /**
+   * Check whether an automatic update of the eigenvalues is due according
+   * to AdditionalData::eigenvalue_update_interval and run it.
+   */
+  void
+  update_eigenvalues_if_requested(const VectorType &src) const;
+
   /**
    * A pointer to the underlying matrix.
    */
@@ -2233,6 +2342,38 @@ private:
    */
   bool eigenvalues_are_initialized;
 
+  /**
+   * Eigenvalue estimates handed in by set_eigenvalue_estimates() before the
+   * first application, replacing the eigenvalue algorithm.
+   */
+  std::optional<std::pair<double, double>> given_eigenvalue_estimates;
+
+  /**
+   * The current estimate of the smallest eigenvalue, kept during the
+   * updates of the largest eigenvalue.
+   */
+  mutable double min_eigenvalue_estimate;
+
+  /**
+   * The current estimate of the largest eigenvalue including the safety
+   * factor, which the updates of the largest eigenvalue do not decrease if
+   * AdditionalData::eigenvalue_update_monotone is set.
+   */
+  mutable double max_eigenvalue_estimate;
+
+  /**
+   * Eigenvector approximation of the power iteration in
+   * update_eigenvalue_estimates(), used as starting vector of the next
+   * update.
+   */
+  mutable VectorType eigenvector_estimate;
+
+  /**
+   * Number of applications of the preconditioner since the last update of
+   * the eigenvalues, see AdditionalData::eigenvalue_update_interval.
+   */
+  mutable unsigned int n_applications_since_update;
+
   /**
    * A mutex to avoid that multiple vmult() invocations by different threads
    * overwrite the temporary vectors.
@@ -3069,6 +3210,124 @@ namespace internal
         }
     }
 
+    // generic part for deal.II block vectors, expanding the loop over the
+    // (local) size of each block
+    template <typename Number, typename PreconditionerType>
+    inline void
+    vector_updates(
+      const LinearAlgebra::distributed::BlockVector<Number> &rhs,
+      const PreconditionerType                              &preconditioner,
+      const unsigned int                                     iteration_index,
+      const double                                           factor1_,
+      const double                                           factor2_,
+      LinearAlgebra::distributed::BlockVector<Number>       &solution_old,
+      LinearAlgebra::distributed::BlockVector<Number>       &temp_vector1,
+      LinearAlgebra::distributed::BlockVector<Number>       &temp_vector2,
+      LinearAlgebra::distributed::BlockVector<Number>       &solution)
+    {
+      const Number factor1        = factor1_;
+      const Number factor1_plus_1 = 1. + factor1_;
+      const Number factor2        = factor2_;
+
+      if (iteration_index == 0)
+        {
+          // compute t = P^{-1} * (b)
+          preconditioner.vmult(solution_old, rhs);
+
+          // compute x^{n+1} = f_2 * t
+          for (unsigned int b = 0; b < solution_old.n_blocks(); ++b)
+            {
+              const auto solution_old_ptr = solution_old.block(b).begin();
+
+              DEAL_II_OPENMP_SIMD_PRAGMA
+              for (unsigned int i = 0;
+                   i < solution_old.block(b).locally_owned_size();
+                   ++i)
+                solution_old_ptr[i] = solution_old_ptr[i] * factor2;
+            }
+        }
+      else
+        {
+          // compute t = P^{-1} * (b-A*x^{n})
+          temp_vector1.sadd(-1.0, 1.0, rhs);
+
+          preconditioner.vmult(iteration_index == 1 ? solution_old :
+                                                      temp_vector2,
+                               temp_vector1);
+
+          // compute x^{n+1} = x^{n} + f_1 * (x^{n}-x^{n-1}) + f_2 * t
+          for (unsigned int b = 0; b < solution_old.n_blocks(); ++b)
+            {
+              const auto solution_ptr     = solution.block(b).begin();
+              const auto solution_old_ptr = solution_old.block(b).begin();
+              const unsigned int local_size =
+                solution_old.block(b).locally_owned_size();
+
+              if (iteration_index == 1)
+                {
+                  DEAL_II_OPENMP_SIMD_PRAGMA
+                  for (unsigned int i = 0; i < local_size; ++i)
+                    solution_old_ptr[i] = factor1_plus_1 * solution_ptr[i] +
+                                          solution_old_ptr[i] * factor2;
+                }
+              else
+                {
+                  const auto temp_vector2_ptr = temp_vector2.block(b).begin();
+
+                  DEAL_II_OPENMP_SIMD_PRAGMA
+                  for (unsigned int i = 0; i < local_size; ++i)
+                    solution_old_ptr[i] = factor1_plus_1 * solution_ptr[i] -
+                                          factor1 * solution_old_ptr[i] +
+                                          temp_vector2_ptr[i] * factor2;
+                }
+            }
+        }
+
+      solution.swap(solution_old);
+    }
+
+    // selection for diagonal matrix around deal.II block vector, running the
+    // fused update of VectorUpdater on each block
+    template <typename Number>
+    inline void
+    vector_updates(
+      const LinearAlgebra::distributed::BlockVector<Number> &rhs,
+      const dealii::DiagonalMatrix<
+        LinearAlgebra::distributed::BlockVector<Number>>    &jacobi,
+      const unsigned int                                     iteration_index,
+      const double                                           factor1,
+      const double                                           factor2,
+      LinearAlgebra::distributed::BlockVector<Number>       &solution_old,
+      LinearAlgebra::distributed::BlockVector<Number>       &temp_vector1,
+      LinearAlgebra::distributed::BlockVector<Number> &,
+      LinearAlgebra::distributed::BlockVector<Number> &solution)
+    {
+      for (unsigned int b = 0; b < rhs.n_blocks(); ++b)
+        {
+          VectorUpdater<Number> upd(rhs.block(b).begin(),
+                                    jacobi.get_vector().block(b).begin(),
+                                    iteration_index,
+                                    factor1,
+                                    factor2,
+                                    solution_old.block(b).begin(),
+                                    temp_vector1.block(b).begin(),
+                                    solution.block(b).begin());
+          VectorUpdatesRange<Number>(upd, rhs.block(b).locally_owned_size());
+        }
+
+      // swap vectors x^{n+1}->x^{n}, given the updates in the function above
+      if (iteration_index == 0)
+        {
+          // nothing to do here because we can immediately write into the
+          // solution vector without remembering any of the other vectors
+        }
+      else
+        {
+          solution.swap(temp_vector1);
+          solution_old.swap(temp_vector1);
+        }
+    }
+
     // We need to have a separate declaration for static const members
 
     // general case and the case that the preconditioner can work on
@@ -3459,6 +3718,9 @@ inline PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
   , max_eigenvalue(max_eigenvalue)
   , eigenvalue_algorithm(eigenvalue_algorithm)
   , polynomial_type(polynomial_type)
+  , eigenvalue_update_interval(0)
+  , eigenvalue_update_n_iterations(2)
+  , eigenvalue_update_monotone(true)
 {}
 
 
@@ -3478,6 +3740,9 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
   preconditioner       = other_data.preconditioner;
   eigenvalue_algorithm = other_data.eigenvalue_algorithm;
   polynomial_type      = other_data.polynomial_type;
+  eigenvalue_update_interval     = other_data.eigenvalue_update_interval;
+  eigenvalue_update_n_iterations = other_data.eigenvalue_update_n_iterations;
+  eigenvalue_update_monotone     = other_data.eigenvalue_update_monotone;
   constraints.copy_from(other_data.constraints);
 
   return *this;
@@ -3491,6 +3756,9 @@ inline PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
   : theta(1.)
   , delta(1.)
   , eigenvalues_are_initialized(false)
+  , min_eigenvalue_estimate(0.)
+  , max_eigenvalue_estimate(0.)
+  , n_applications_since_update(0)
 {
   static_assert(
     std::is_same_v<size_type, typename VectorType::size_type>,
@@ -3512,6 +3780,8 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::initialize(
   internal::PreconditionChebyshevImplementation::initialize_preconditioner(
     matrix, data.preconditioner);
   eigenvalues_are_initialized = false;
+  given_eigenvalue_estimates.reset();
+  n_applications_since_update = 0;
 }
 
 
@@ -3521,6 +3791,8 @@ inline void
 PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::clear()
 {
   eigenvalues_are_initialized = false;
+  given_eigenvalue_estimates.reset();
+  n_applications_since_update = 0;
   theta = delta = 1.0;
   matrix_ptr    = nullptr;
   {
@@ -3528,6 +3800,7 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::clear()
     solution_old.reinit(empty_vector);
     temp_vector1.reinit(empty_vector);
     temp_vector2.reinit(empty_vector);
+    eigenvector_estimate.reinit(empty_vector);
   }
   data.preconditioner.reset();
 }
@@ -3550,7 +3823,12 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
   solution_old.reinit(src);
   temp_vector1.reinit(src, true);
 
-  if (data.eig_cg_n_iterations > 0)
+  if (given_eigenvalue_estimates.has_value())
+    {
+      info.min_eigenvalue_estimate = given_eigenvalue_estimates->first;
+      info.max_eigenvalue_estimate = 1.2 * given_eigenvalue_estimates->second;
+    }
+  else if (data.eig_cg_n_iterations > 0)
     {
       Assert(data.eig_cg_n_iterations > 2,
              ExcMessage(
@@ -3601,6 +3879,14 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
               temp_vector1,
               *data.preconditioner,
               data.eig_cg_n_iterations));
+
+          // keep the eigenvector approximation as starting vector of the
+          // updates of the eigenvalue estimates
+          if (data.eigenvalue_update_interval > 0)
+            {
+              eigenvector_estimate.swap(temp_vector1);
+              temp_vector1.reinit(src, true);
+            }
         }
       else
         Assert(false, ExcNotImplemented());
@@ -3623,6 +3909,45 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
       info.min_eigenvalue_estimate = data.max_eigenvalue / data.smoothing_range;
     }
 
+  set_polynomial_parameters(info);
+
+  // We do not need the second temporary vector in case we have a
+  // DiagonalMatrix as preconditioner and use deal.II's own vectors
+  using NumberType = typename VectorType::value_type;
+  if (std::is_same_v<PreconditionerType, dealii::DiagonalMatrix<VectorType>> ==
+        false ||
+      (std::is_same_v<VectorType, dealii::Vector<NumberType>> == false &&
+       ((std::is_same_v<
+           VectorType,
+           LinearAlgebra::distributed::Vector<NumberType, MemorySpace::Host>> ==
+         false) ||
+        (std::is_same_v<VectorType,
+                        LinearAlgebra::distributed::
+                          Vector<NumberType, MemorySpace::Default>> == false))))
+    temp_vector2.reinit(src, true);
+  else
+    {
+      VectorType empty_vector;
+      temp_vector2.reinit(empty_vector);
+    }
+
+  const_cast<
+    PreconditionChebyshev<MatrixType, VectorType, PreconditionerType> *>(this)
+    ->eigenvalues_are_initialized = true;
+
+  return info;
+}
+
+
+
+template <typename MatrixType, typename VectorType, typename PreconditionerType>
+inline void
+PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
+  set_polynomial_parameters(EigenvalueInformation &info) const
+{
+  min_eigenvalue_estimate = info.min_eigenvalue_estimate;
+  max_eigenvalue_estimate = info.max_eigenvalue_estimate;
+
   const double alpha = (data.smoothing_range > 1. ?
                           info.max_eigenvalue_estimate / data.smoothing_range :
                           std::min(0.9 * info.max_eigenvalue_estimate,
@@ -3659,36 +3984,112 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
   const_cast<
     PreconditionChebyshev<MatrixType, VectorType, PreconditionerType> *>(this)
     ->theta = (info.max_eigenvalue_estimate + alpha) * 0.5;
+}
 
-  // We do not need the second temporary vector in case we have a
-  // DiagonalMatrix as preconditioner and use deal.II's own vectors
-  using NumberType = typename VectorType::value_type;
-  if (std::is_same_v<PreconditionerType, dealii::DiagonalMatrix<VectorType>> ==
-        false ||
-      (std::is_same_v<VectorType, dealii::Vector<NumberType>> == false &&
-       ((std::is_same_v<
-           VectorType,
-           LinearAlgebra::distributed::Vector<NumberType, MemorySpace::Host>> ==
-         false) ||
-        (std::is_same_v<VectorType,
-                        LinearAlgebra::distributed::
-                          Vector<NumberType, MemorySpace::Default>> == false))))
-    temp_vector2.reinit(src, true);
+
+
+template <typename MatrixType, typename VectorType, typename PreconditionerType>
+inline typename PreconditionChebyshev<MatrixType,
+                                      VectorType,
+                                      PreconditionerType>::EigenvalueInformation
+PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
+  set_eigenvalue_estimates(const double min_eigenvalue,
+                           const double max_eigenvalue)
+{
+  Assert(min_eigenvalue <= max_eigenvalue,
+         ExcMessage("The smallest eigenvalue must not exceed the largest "
+                    "eigenvalue."));
+
+  std::lock_guard<std::mutex> lock(mutex);
+
+  EigenvalueInformation info{};
+  info.min_eigenvalue_estimate = min_eigenvalue;
+  info.max_eigenvalue_estimate = 1.2 * max_eigenvalue;
+
+  // before the first application, the temporary vectors are not set up yet,
+  // so we only remember the values for estimate_eigenvalues()
+  if (eigenvalues_are_initialized == false)
+    {
+      given_eigenvalue_estimates =
+        std::make_pair(min_eigenvalue, max_eigenvalue);
+      info.degree = data.degree;
+    }
   else
+    set_polynomial_parameters(info);
+
+  return info;
+}
+
+
+
+template <typename MatrixType, typename VectorType, typename PreconditionerType>
+inline typename PreconditionChebyshev<MatrixType,
+                                      VectorType,
+                                      PreconditionerType>::EigenvalueInformation
+PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
+  update_eigenvalue_estimates(const VectorType  &src,
+                              const unsigned int n_iterations) const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  if (eigenvalues_are_initialized == false)
+    estimate_eigenvalues(src);
+
+  return do_update_eigenvalue_estimates(src, n_iterations);
+}
+
+
+
+template <typename MatrixType, typename VectorType, typename PreconditionerType>
+inline typename PreconditionChebyshev<MatrixType,
+                                      VectorType,
+                                      PreconditionerType>::EigenvalueInformation
+PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
+  do_update_eigenvalue_estimates(const VectorType  &src,
+                                 const unsigned int n_iterations) const
+{
+  Assert(eigenvalues_are_initialized, ExcInternalError());
+  Assert(n_iterations > 0, ExcMessage("Need at least one iteration."));
+
+  if (eigenvector_estimate.size() != src.size())
     {
-      VectorType empty_vector;
-      temp_vector2.reinit(empty_vector);
+      eigenvector_estimate.reinit(src, true);
+      internal::PreconditionChebyshevImplementation::set_initial_guess(
+        eigenvector_estimate);
+      data.constraints.set_zero(eigenvector_estimate);
     }
 
-  const_cast<
-    PreconditionChebyshev<MatrixType, VectorType, PreconditionerType> *>(this)
-    ->eigenvalues_are_initialized = true;
+  EigenvalueInformation info{};
+  info.min_eigenvalue_estimate = min_eigenvalue_estimate;
+  info.max_eigenvalue_estimate =
+    1.2 * internal::PreconditionChebyshevImplementation::power_iteration(
+            *matrix_ptr,
+            eigenvector_estimate,
+            *data.preconditioner,
+            n_iterations);
+  if (data.eigenvalue_update_monotone)
+    info.max_eigenvalue_estimate =
+      std::max(max_eigenvalue_estimate, info.max_eigenvalue_estimate);
+
+  set_polynomial_parameters(info);
+  n_applications_since_update = 0;
 
   return info;
 }
 
 
 
+template <typename MatrixType, typename VectorType, typename PreconditionerType>
+inline void
+PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
+  update_eigenvalues_if_requested(const VectorType &src) const
+{
+  if (data.eigenvalue_update_interval > 0 &&
+      ++n_applications_since_update >= data.eigenvalue_update_interval)
+    do_update_eigenvalue_estimates(src, data.eigenvalue_update_n_iterations);
+}
+
+
+
 template <typename MatrixType, typename VectorType, typename PreconditionerType>
 inline void
 PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::vmult(
@@ -3698,6 +4099,8 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::vmult(
   std::lock_guard<std::mutex> lock(mutex);
   if (eigenvalues_are_initialized == false)
     estimate_eigenvalues(rhs);
+  else
+    update_eigenvalues_if_requested(rhs);
 
   internal::PreconditionChebyshevImplementation::vmult_and_update(
     *matrix_ptr,
@@ -3762,6 +4165,8 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::Tvmult(
   std::lock_guard<std::mutex> lock(mutex);
   if (eigenvalues_are_initialized == false)
     estimate_eigenvalues(rhs);
+  else
+    update_eigenvalues_if_requested(rhs);
 
   internal::PreconditionChebyshevImplementation::vector_updates(
     rhs,
@@ -3823,6 +4228,8 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::step(
   std::lock_guard<std::mutex> lock(mutex);
   if (eigenvalues_are_initialized == false)
     estimate_eigenvalues(rhs);
+  else
+    update_eigenvalues_if_requested(rhs);
 
   internal::PreconditionChebyshevImplementation::vmult_and_update(
     *matrix_ptr,
@@ -3885,6 +4292,8 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::Tstep(
   std::lock_guard<std::mutex> lock(mutex);
   if (eigenvalues_are_initialized == false)
     estimate_eigenvalues(rhs);
+  else
+    update_eigenvalues_if_requested(rhs);
 
   matrix_ptr->Tvmult(temp_vector1, solution);
   internal::PreconditionChebyshevImplementation::vector_updates(
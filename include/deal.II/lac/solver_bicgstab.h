@@ -23,6 +23,7 @@
 #include <deal.II/base/signaling_nan.h>
 #include <deal.II/base/subscriptor.h>
 
+#include <deal.II/lac/inner_product_batch.h>
 #include <deal.II/lac/solver.h>
 #include <deal.II/lac/solver_control.h>
 
@@ -68,6 +69,11 @@ DEAL_II_NAMESPACE_OPEN
  * to find a general good criterion, so if things do not work for you, try to
  * change this value.
  *
+ * Inner products that are needed at the same point of the algorithm are
+ * computed with a single global reduction through InnerProductBatch, which
+ * reduces the number of synchronization points per iteration for parallel
+ * vectors.
+ *
  *
  * <h3>Observing the progress of linear solver iterations</h3>
  *
@@ -320,11 +326,17 @@ SolverBicgstab<VectorType>::iterate(const MatrixType         &A,
   value_type rho   = 1.;
   value_type omega = 1.;
 
+  // The inner product <r,rbar> needed at the beginning of an iteration is
+  // computed together with the norm of the residual at the end of the
+  // previous one, in order to save a global reduction
+  value_type r_dot_rbar       = res * res;
+  bool       r_dot_rbar_valid = true;
+
   do
     {
       ++step;
 
-      const value_type rhobar = (step == 1 + last_step) ? res * res : r * rbar;
+      const value_type rhobar = r_dot_rbar_valid ? r_dot_rbar : r * rbar;
 
       if (std::fabs(rhobar) < additional_data.breakdown)
         {
@@ -370,8 +382,14 @@ SolverBicgstab<VectorType>::iterate(const MatrixType         &A,
 
       preconditioner.vmult(z, r);
       A.vmult(t, z);
-      const value_type t_dot_r   = t * r;
-      const real_type  t_squared = t * t;
+
+      // compute <t,r> and <t,t> with a single reduction
+      InnerProductBatch<VectorType> products_t(t);
+      const unsigned int t_dot_r_index   = products_t.inner_product(t, r);
+      const unsigned int t_squared_index = products_t.inner_product(t, t);
+      products_t.compute();
+      const value_type t_dot_r   = products_t[t_dot_r_index];
+      const real_type  t_squared = std::real(products_t[t_squared_index]);
       if (t_squared < additional_data.breakdown)
         {
           return IterationResult(true, state, step, res);
@@ -382,10 +400,23 @@ SolverBicgstab<VectorType>::iterate(const MatrixType         &A,
       if (additional_data.exact_residual)
         {
           r.add(-omega, t);
-          res = criterion(A, x, b, t);
+          res              = criterion(A, x, b, t);
+          r_dot_rbar_valid = false;
         }
       else
-        res = std::sqrt(real_type(r.add_and_dot(-omega, t, r)));
+        {
+          // compute the new residual norm and <r,rbar> for the next
+          // iteration with a single reduction
+          InnerProductBatch<VectorType> products_r(r);
+          const unsigned int            res_index =
+            products_r.add_and_dot(r, -omega, t, r);
+          const unsigned int r_dot_rbar_index =
+            products_r.inner_product(r, rbar);
+          products_r.compute();
+          res              = std::sqrt(real_type(products_r[res_index]));
+          r_dot_rbar       = products_r[r_dot_rbar_index];
+          r_dot_rbar_valid = true;
+        }
 
       state = this->iteration_status(step, res, x);
       print_vectors(step, x, r, y);
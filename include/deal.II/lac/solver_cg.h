@@ -763,10 +763,10 @@ namespace internal
           for (unsigned int i = 0; i < 7; ++i)
             scalar_sums[i] += vectorized_sums[i][l];
 
-        Utilities::MPI::sum(dealii::ArrayView<const Number>(scalar_sums.data(),
-                                                            7),
-                            this->r.get_mpi_communicator(),
-                            dealii::ArrayView<Number>(scalar_sums.data(), 7));
+        Utilities::MPI::node_aware_sum(
+          dealii::ArrayView<const Number>(scalar_sums.data(), 7),
+          this->r.get_partitioner()->get_node_topology(),
+          dealii::ArrayView<Number>(scalar_sums.data(), 7));
 
         this->r_dot_preconditioner_dot_r = scalar_sums[6];
 
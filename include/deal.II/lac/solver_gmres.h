@@ -37,6 +37,7 @@
 #include <cmath>
 #include <limits>
 #include <memory>
+#include <utility>
 #include <vector>
 
 DEAL_II_NAMESPACE_OPEN
@@ -912,7 +913,10 @@ namespace internal
                       block(vv, b).local_element(j);
         }
 
-      Utilities::MPI::sum(h, block(vv, 0).get_mpi_communicator(), h);
+      Utilities::MPI::node_aware_sum(
+        make_array_view(std::as_const(h)),
+        block(vv, 0).get_partitioner()->get_node_topology(),
+        make_array_view(h));
     }
 
 
@@ -1022,8 +1026,8 @@ namespace internal
             }
         }
 
-      return std::sqrt(
-        Utilities::MPI::sum(norm_vv_temp, block(vv, 0).get_mpi_communicator()));
+      return std::sqrt(Utilities::MPI::node_aware_sum(
+        norm_vv_temp, block(vv, 0).get_partitioner()->get_node_topology()));
     }
 
 
@@ -1065,8 +1069,8 @@ namespace internal
             norm += temp * temp;
           }
 
-      return std::sqrt(
-        Utilities::MPI::sum(norm, block(v, 0).get_mpi_communicator()));
+      return std::sqrt(Utilities::MPI::node_aware_sum(
+        norm, block(v, 0).get_partitioner()->get_node_topology()));
     }
 
 
@@ -25,6 +25,7 @@
 
 #include <deal.II/lac/block_vector_base.h>
 #include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/inner_product_batch.h>
 #include <deal.II/lac/solver.h>
 #include <deal.II/lac/solver_control.h>
 
@@ -114,6 +115,10 @@ namespace internal
  * iteration. If the user enables the history data, the residual at each of
  * these steps is stored and therefore there will be multiple values per
  * iteration.
+ *
+ * The <code>s</code> inner products with the shadow space as well as the
+ * other inner products that are needed at the same point of the algorithm
+ * are computed with a single global reduction through InnerProductBatch.
  */
 template <typename VectorType = Vector<double>>
 class SolverIDR : public SolverBase<VectorType>
@@ -385,8 +390,14 @@ SolverIDR<VectorType>::solve(const MatrixType         &A,
 
       for (unsigned int j = 0; j < i; ++j)
         {
+          InnerProductBatch<VectorType> products(tmp_q);
+          const unsigned int q_dot_tmp = products.inner_product(Q[j], tmp_q);
+          const unsigned int tmp_dot_tmp =
+            products.inner_product(tmp_q, tmp_q);
+          products.compute();
+
           v = Q[j];
-          v *= (v * tmp_q) / (tmp_q * tmp_q);
+          v *= products[q_dot_tmp] / products[tmp_dot_tmp];
           tmp_q.add(-1.0, v);
         }
 
@@ -405,10 +416,16 @@ SolverIDR<VectorType>::solve(const MatrixType         &A,
     {
       ++step;
 
-      // Compute phi
+      // Compute phi, with a single reduction for all inner products
       Vector<value_type> phi(s);
-      for (unsigned int i = 0; i < s; ++i)
-        phi(i) = Q[i] * r;
+      {
+        InnerProductBatch<VectorType> products(r);
+        for (unsigned int i = 0; i < s; ++i)
+          products.inner_product(Q[i], r);
+        products.compute();
+        for (unsigned int i = 0; i < s; ++i)
+          phi(i) = products[i];
+      }
 
       // Inner iteration over s
       for (unsigned int k = 0; k < s; ++k)
@@ -476,9 +493,17 @@ SolverIDR<VectorType>::solve(const MatrixType         &A,
 
           U[k].swap(uhat);
 
-          // Update kth column of M
-          for (unsigned int i = k + 1; i < s; ++i)
-            M(i, k) = Q[i] * G[k];
+          // Update kth column of M, with a single reduction for all inner
+          // products
+          if (k + 1 < s)
+            {
+              InnerProductBatch<VectorType> products(G[k]);
+              for (unsigned int i = k + 1; i < s; ++i)
+                products.inner_product(Q[i], G[k]);
+              products.compute();
+              for (unsigned int i = k + 1; i < s; ++i)
+                M(i, k) = products[i - k - 1];
+            }
 
           // Orthogonalize r to Q0,...,Qk, update x
           {
@@ -516,7 +541,13 @@ SolverIDR<VectorType>::solve(const MatrixType         &A,
       preconditioner.vmult(uhat, r);
       A.vmult(v, uhat);
 
-      omega = (v * r) / (v * v);
+      {
+        InnerProductBatch<VectorType> products(v);
+        const unsigned int            v_dot_r = products.inner_product(v, r);
+        const unsigned int            v_dot_v = products.inner_product(v, v);
+        products.compute();
+        omega = products[v_dot_r] / products[v_dot_v];
+      }
 
       res = std::sqrt(r.add_and_dot(-1.0 * omega, v, r));
       x.add(omega, uhat);
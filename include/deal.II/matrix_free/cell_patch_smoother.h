@@ -0,0 +1,682 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+#ifndef dealii_matrix_free_cell_patch_smoother_h
+#define dealii_matrix_free_cell_patch_smoother_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/ndarray.h>
+#include <deal.II/base/subscriptor.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/tensor_product_matrix.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <deal.II/numerics/tensor_product_matrix_creator.h>
+
+#include <memory>
+#include <set>
+#include <type_traits>
+
+
+DEAL_II_NAMESPACE_OPEN
+
+
+/**
+ * An additive Schwarz smoother for scalar Laplace-type problems discretized
+ * with MatrixFree, using the cells of the mesh as (non-overlapping in terms
+ * of cells) subdomains. On each cell $K$, the local problem is approximated
+ * by a separable tensor-product matrix
+ * @f[
+ *   A_K \approx \sum_{d=1}^{\text{dim}} M_{\text{dim}} \otimes \ldots
+ *   \otimes K_d \otimes \ldots \otimes M_1,
+ * @f]
+ * which is exact for the Laplacian on Cartesian cells and is inverted by the
+ * fast diagonalization method implemented in
+ * TensorProductMatrixSymmetricSumCollection. The 1d matrices are set up
+ * from the univariate shape functions stored in MatrixFree and the cell
+ * extents of each cell and its neighbors:
+ * - For continuous elements (FE_Q), the 1d matrices are the restriction of
+ *   the 1d global matrices to the unknowns of the cell, i.e., the
+ *   contributions of the neighbors to the unknowns on the shared faces are
+ *   added, see
+ *   TensorProductMatrixCreator::create_laplace_tensor_product_matrix().
+ *   The application of the smoother then sums the contributions of all
+ *   cells, weighted symmetrically by the inverse square root of the number
+ *   of cells sharing an unknown.
+ * - For discontinuous elements (FE_DGQ, FE_DGQHermite), the 1d matrices
+ *   contain the cell and face integrals of the symmetric interior penalty
+ *   method, with the penalty parameter
+ *   $\sigma = \frac{1}{2}\left(h_K^{-1} + h_{K'}^{-1}\right) \eta$ on interior
+ *   faces and $\sigma = 2 h_K^{-1}\eta$ on Dirichlet faces, using the same
+ *   conventions as in step-59. The smoother is then a block-Jacobi method.
+ *
+ * The vectorized lanes of a cell batch are set up in one go, and matrices of
+ * cell batches with the same geometry and boundary conditions are only
+ * stored once. Faces with a boundary id contained in
+ * AdditionalData::dirichlet_boundaries are treated as Dirichlet boundaries,
+ * all other boundary faces as Neumann boundaries. On general meshes, the
+ * extent of the cells in the coordinate directions is used, which makes
+ * the smoother an approximation.
+ *
+ * The class provides the initialize() and vmult() interface expected by
+ * MGSmootherPrecondition:
+ * @code
+ * using SmootherType = CellPatchSmoother<dim, double>;
+ * MGLevelObject<typename SmootherType::AdditionalData> smoother_data(
+ *   min_level, max_level);
+ * for (unsigned int level = min_level; level <= max_level; ++level)
+ *   smoother_data[level].dirichlet_boundaries = {0};
+ * MGSmootherPrecondition<LevelMatrixType, SmootherType, VectorType>
+ *   smoother;
+ * smoother.initialize(mg_matrices, smoother_data);
+ * @endcode
+ * where the level matrices need to provide a function `get_matrix_free()`
+ * as done, e.g., by MatrixFreeOperators::Base.
+ *
+ * @note The class requires LAPACK for setting up the eigendecomposition of
+ * the 1d matrices. Only the additive variant over cell patches is
+ * implemented; vertex patches would need access to unknowns of several
+ * cells, which is not provided by the cell-based data structures of
+ * MatrixFree.
+ *
+ * @ingroup matrixfree
+ * @ingroup Preconditioners
+ */
+template <int dim,
+          typename Number,
+          typename VectorizedArrayType = VectorizedArray<Number>>
+class CellPatchSmoother : public Subscriptor
+{
+public:
+  /**
+   * The vector type the smoother operates on.
+   */
+  using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+  /**
+   * The type of the underlying MatrixFree object.
+   */
+  using MatrixFreeType = MatrixFree<dim, Number, VectorizedArrayType>;
+
+  /**
+   * Collect the parameters of the smoother.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor.
+     */
+    AdditionalData(const double                        relaxation = 1.,
+                   const std::set<types::boundary_id> &dirichlet_boundaries =
+                     std::set<types::boundary_id>(),
+                   const double       penalty_factor    = -1.,
+                   const unsigned int dof_handler_index = 0,
+                   const unsigned int quad_index        = 0);
+
+    /**
+     * Relaxation factor applied to the result of the smoother.
+     */
+    double relaxation;
+
+    /**
+     * The boundary ids of the faces with Dirichlet boundary conditions.
+     */
+    std::set<types::boundary_id> dirichlet_boundaries;
+
+    /**
+     * The factor $\eta$ in the penalty parameter of the interior penalty
+     * method, only used for discontinuous elements. If negative, the value
+     * $\eta = k(k+1)$ with the polynomial degree $k$ is selected.
+     */
+    double penalty_factor;
+
+    /**
+     * The index of the DoFHandler within the MatrixFree object.
+     */
+    unsigned int dof_handler_index;
+
+    /**
+     * The index of the quadrature formula within the MatrixFree object, used
+     * to compute the 1d reference matrices.
+     */
+    unsigned int quad_index;
+  };
+
+  /**
+   * Set up the cell matrices for the MatrixFree object returned by
+   * `matrix.get_matrix_free()`. This is the interface used by
+   * MGSmootherPrecondition. If @p matrix is a shared pointer to a
+   * MatrixFree object, the second variant of this function is called.
+   */
+  template <typename MatrixType>
+  void
+  initialize(const MatrixType     &matrix,
+             const AdditionalData &additional_data = AdditionalData());
+
+  /**
+   * Set up the cell matrices for the given MatrixFree object.
+   */
+  void
+  initialize(const std::shared_ptr<const MatrixFreeType> &matrix_free,
+             const AdditionalData &additional_data = AdditionalData());
+
+  /**
+   * Release all memory.
+   */
+  void
+  clear();
+
+  /**
+   * Apply the smoother, i.e., compute $dst = \omega \sum_K R_K^T A_K^{-1} R_K
+   * src$ with the weighting described in the class documentation.
+   */
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Apply the transpose of the smoother. Since the smoother is symmetric,
+   * this is the same as vmult().
+   */
+  void
+  Tvmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Return the memory consumption of this class in bytes.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * Apply the inverse of the cell matrices on a range of cell batches.
+   */
+  void
+  local_apply(const MatrixFreeType                        &matrix_free,
+              VectorType                                  &dst,
+              const VectorType                            &src,
+              const std::pair<unsigned int, unsigned int> &cell_range) const;
+
+  /**
+   * Compute the 1d mass and derivative matrices of the symmetric interior
+   * penalty discretization on a single cell, given the 1d reference-cell
+   * matrices and the values and derivatives of the shape functions at the
+   * left and right end points of the reference interval.
+   */
+  static std::pair<std::array<FullMatrix<Number>, dim>,
+                   std::array<FullMatrix<Number>, dim>>
+  create_interior_penalty_matrices(
+    const FullMatrix<Number> &M_ref,
+    const FullMatrix<Number> &K_ref,
+    const std::array<std::vector<Number>, 2> &values_on_faces,
+    const std::array<std::vector<Number>, 2> &derivatives_on_faces,
+    const dealii::ndarray<TensorProductMatrixCreator::LaplaceBoundaryType,
+                          dim,
+                          2>                 &boundary_ids,
+    const dealii::ndarray<double, dim, 3>    &cell_extent,
+    const double                              penalty_factor);
+
+  /**
+   * The underlying MatrixFree object.
+   */
+  std::shared_ptr<const MatrixFreeType> matrix_free;
+
+  /**
+   * The parameters of the smoother.
+   */
+  AdditionalData additional_data;
+
+  /**
+   * The fast-diagonalization representation of the inverse cell matrices,
+   * one entry per cell batch.
+   */
+  std::unique_ptr<
+    TensorProductMatrixSymmetricSumCollection<dim, VectorizedArrayType>>
+    cell_matrices;
+
+  /**
+   * The inverse square root of the number of cells sharing an unknown, used
+   * to weight the contributions of the cells for continuous elements. Empty
+   * for discontinuous elements.
+   */
+  VectorType inverse_sqrt_multiplicity;
+
+  /**
+   * Temporary vector holding the weighted source vector.
+   */
+  mutable VectorType weighted_src;
+};
+
+
+
+#ifndef DOXYGEN
+
+/* ------------------------- Inline functions --------------------------- */
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline CellPatchSmoother<dim, Number, VectorizedArrayType>::AdditionalData::
+  AdditionalData(const double                        relaxation,
+                 const std::set<types::boundary_id> &dirichlet_boundaries,
+                 const double                        penalty_factor,
+                 const unsigned int                  dof_handler_index,
+                 const unsigned int                  quad_index)
+  : relaxation(relaxation)
+  , dirichlet_boundaries(dirichlet_boundaries)
+  , penalty_factor(penalty_factor)
+  , dof_handler_index(dof_handler_index)
+  , quad_index(quad_index)
+{}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+template <typename MatrixType>
+inline void
+CellPatchSmoother<dim, Number, VectorizedArrayType>::initialize(
+  const MatrixType     &matrix,
+  const AdditionalData &additional_data)
+{
+  if constexpr (std::is_convertible_v<MatrixType,
+                                      std::shared_ptr<const MatrixFreeType>>)
+    this->initialize(std::shared_ptr<const MatrixFreeType>(matrix),
+                     additional_data);
+  else
+    this->initialize(matrix.get_matrix_free(), additional_data);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline void
+CellPatchSmoother<dim, Number, VectorizedArrayType>::initialize(
+  const std::shared_ptr<const MatrixFreeType> &matrix_free_in,
+  const AdditionalData                        &additional_data_in)
+{
+  using VectorizedArrayTrait =
+    dealii::internal::VectorizedArrayTrait<VectorizedArrayType>;
+  using LaplaceBoundaryType = TensorProductMatrixCreator::LaplaceBoundaryType;
+
+  matrix_free     = matrix_free_in;
+  additional_data = additional_data_in;
+
+  Assert(matrix_free.get() != nullptr, ExcNotInitialized());
+
+  const unsigned int dof_index = additional_data.dof_handler_index;
+  const auto        &fe = matrix_free->get_dof_handler(dof_index).get_fe();
+  const auto        &shape_info =
+    matrix_free->get_shape_info(dof_index, additional_data.quad_index);
+
+  AssertThrow(
+    matrix_free->get_dof_handler(dof_index).get_fe_collection().size() == 1,
+    ExcNotImplemented());
+  AssertThrow(fe.n_components() == 1,
+              ExcMessage("CellPatchSmoother only supports scalar elements."));
+  AssertThrow(
+    shape_info.element_type <=
+      internal::MatrixFreeFunctions::tensor_symmetric_no_collocation,
+    ExcMessage("CellPatchSmoother needs a tensor-product element with the "
+               "same polynomial space in all directions."));
+
+  // compute the 1d matrices on the reference cell from the univariate shape
+  // functions used by MatrixFree, which are in lexicographic numbering
+  const auto        &shape_data = shape_info.data.front();
+  const unsigned int n_dofs_1d  = shape_data.fe_degree + 1;
+  const unsigned int n_q_1d     = shape_data.n_q_points_1d;
+  const bool         is_dg      = fe.n_dofs_per_vertex() == 0;
+
+  FullMatrix<Number> M_ref(n_dofs_1d, n_dofs_1d);
+  FullMatrix<Number> K_ref(n_dofs_1d, n_dofs_1d);
+  for (unsigned int i = 0; i < n_dofs_1d; ++i)
+    for (unsigned int j = 0; j < n_dofs_1d; ++j)
+      for (unsigned int q = 0; q < n_q_1d; ++q)
+        {
+          const Number weight = shape_data.quadrature.weight(q);
+          M_ref(i, j) +=
+            VectorizedArrayTrait::get(shape_data.shape_values[i * n_q_1d + q],
+                                      0) *
+            VectorizedArrayTrait::get(shape_data.shape_values[j * n_q_1d + q],
+                                      0) *
+            weight;
+          K_ref(i, j) +=
+            VectorizedArrayTrait::get(
+              shape_data.shape_gradients[i * n_q_1d + q], 0) *
+            VectorizedArrayTrait::get(
+              shape_data.shape_gradients[j * n_q_1d + q], 0) *
+            weight;
+        }
+
+  std::array<std::vector<Number>, 2> values_on_faces;
+  std::array<std::vector<Number>, 2> derivatives_on_faces;
+  for (unsigned int side = 0; side < 2; ++side)
+    {
+      values_on_faces[side].resize(n_dofs_1d);
+      derivatives_on_faces[side].resize(n_dofs_1d);
+      for (unsigned int i = 0; i < n_dofs_1d; ++i)
+        {
+          values_on_faces[side][i] =
+            VectorizedArrayTrait::get(shape_data.shape_data_on_face[side][i],
+                                      0);
+          derivatives_on_faces[side][i] = VectorizedArrayTrait::get(
+            shape_data.shape_data_on_face[side][n_dofs_1d + i], 0);
+        }
+    }
+
+  const double penalty_factor =
+    additional_data.penalty_factor < 0. ?
+      static_cast<double>(shape_data.fe_degree * (shape_data.fe_degree + 1)) :
+      additional_data.penalty_factor;
+
+  // set up the cell matrices, one vectorization lane at a time; unused lanes
+  // of the last cell batch get a copy of the first lane to keep the matrices
+  // invertible
+  const unsigned int n_cell_batches = matrix_free->n_cell_batches();
+
+  cell_matrices = std::make_unique<
+    TensorProductMatrixSymmetricSumCollection<dim, VectorizedArrayType>>();
+  cell_matrices->reserve(n_cell_batches);
+
+  for (unsigned int cell = 0; cell < n_cell_batches; ++cell)
+    {
+      std::array<Table<2, VectorizedArrayType>, dim> Ms;
+      std::array<Table<2, VectorizedArrayType>, dim> Ks;
+      for (unsigned int d = 0; d < dim; ++d)
+        {
+          Ms[d].reinit(n_dofs_1d, n_dofs_1d);
+          Ks[d].reinit(n_dofs_1d, n_dofs_1d);
+        }
+
+      const unsigned int n_active_lanes =
+        matrix_free->n_active_entries_per_cell_batch(cell);
+
+      for (unsigned int v = 0; v < VectorizedArrayTrait::width(); ++v)
+        {
+          const auto cell_iterator =
+            matrix_free->get_cell_iterator(cell,
+                                           std::min(v, n_active_lanes - 1),
+                                           dof_index);
+
+          dealii::ndarray<LaplaceBoundaryType, dim, 2> boundary_ids;
+          dealii::ndarray<double, dim, 3>              cell_extent = {};
+
+          for (unsigned int d = 0; d < dim; ++d)
+            {
+              cell_extent[d][1] = cell_iterator->extent_in_direction(d);
+
+              for (unsigned int side = 0; side < 2; ++side)
+                {
+                  const unsigned int face = 2 * d + side;
+                  if (cell_iterator->at_boundary(face) == false)
+                    {
+                      boundary_ids[d][side] =
+                        LaplaceBoundaryType::internal_boundary;
+                      cell_extent[d][2 * side] =
+                        cell_iterator->neighbor(face)->extent_in_direction(d);
+                    }
+                  else if (cell_iterator->has_periodic_neighbor(face))
+                    {
+                      boundary_ids[d][side] =
+                        LaplaceBoundaryType::internal_boundary;
+                      cell_extent[d][2 * side] =
+                        cell_iterator->periodic_neighbor(face)
+                          ->extent_in_direction(d);
+                    }
+                  else if (additional_data.dirichlet_boundaries.find(
+                             cell_iterator->face(face)->boundary_id()) !=
+                           additional_data.dirichlet_boundaries.end())
+                    boundary_ids[d][side] = LaplaceBoundaryType::dirichlet;
+                  else
+                    boundary_ids[d][side] = LaplaceBoundaryType::neumann;
+                }
+            }
+
+          const auto matrices =
+            is_dg ? create_interior_penalty_matrices(M_ref,
+                                                     K_ref,
+                                                     values_on_faces,
+                                                     derivatives_on_faces,
+                                                     boundary_ids,
+                                                     cell_extent,
+                                                     penalty_factor) :
+                    TensorProductMatrixCreator::
+                      create_laplace_tensor_product_matrix<dim, Number>(
+                        M_ref, K_ref, boundary_ids, cell_extent);
+
+          for (unsigned int d = 0; d < dim; ++d)
+            for (unsigned int i = 0; i < n_dofs_1d; ++i)
+              for (unsigned int j = 0; j < n_dofs_1d; ++j)
+                {
+                  VectorizedArrayTrait::get(Ms[d][i][j], v) =
+                    matrices.first[d](i, j);
+                  VectorizedArrayTrait::get(Ks[d][i][j], v) =
+                    matrices.second[d](i, j);
+                }
+        }
+
+      cell_matrices->insert(cell, Ms, Ks);
+    }
+
+  cell_matrices->finalize();
+
+  // for continuous elements, count how many cells share each unknown
+  inverse_sqrt_multiplicity.reinit(0);
+  weighted_src.reinit(0);
+  if (is_dg == false)
+    {
+      matrix_free->initialize_dof_vector(inverse_sqrt_multiplicity, dof_index);
+      matrix_free->initialize_dof_vector(weighted_src, dof_index);
+
+      int dummy = 0;
+      matrix_free->template cell_loop<VectorType, int>(
+        [&](const MatrixFreeType                       &matrix_free,
+            VectorType                                  &dst,
+            const int                                   &,
+            const std::pair<unsigned int, unsigned int> &range) {
+          FEEvaluation<dim, -1, 0, 1, Number, VectorizedArrayType> phi(
+            matrix_free, range, dof_index, additional_data.quad_index);
+          for (unsigned int cell = range.first; cell < range.second; ++cell)
+            {
+              phi.reinit(cell);
+              for (unsigned int i = 0; i < phi.dofs_per_cell; ++i)
+                phi.begin_dof_values()[i] = VectorizedArrayType(1.);
+              phi.distribute_local_to_global(dst);
+            }
+        },
+        inverse_sqrt_multiplicity,
+        dummy,
+        true);
+
+      for (Number &entry : inverse_sqrt_multiplicity)
+        entry = (entry > Number()) ? Number(1.) / std::sqrt(entry) : Number();
+    }
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline void
+CellPatchSmoother<dim, Number, VectorizedArrayType>::clear()
+{
+  cell_matrices.reset();
+  inverse_sqrt_multiplicity.reinit(0);
+  weighted_src.reinit(0);
+  matrix_free.reset();
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline void
+CellPatchSmoother<dim, Number, VectorizedArrayType>::vmult(
+  VectorType       &dst,
+  const VectorType &src) const
+{
+  Assert(cell_matrices.get() != nullptr, ExcNotInitialized());
+
+  if (inverse_sqrt_multiplicity.size() > 0)
+    {
+      weighted_src = src;
+      weighted_src.scale(inverse_sqrt_multiplicity);
+      matrix_free->cell_loop(
+        &CellPatchSmoother::local_apply, this, dst, weighted_src, true);
+      dst.scale(inverse_sqrt_multiplicity);
+    }
+  else
+    matrix_free->cell_loop(
+      &CellPatchSmoother::local_apply, this, dst, src, true);
+
+  if (additional_data.relaxation != 1.)
+    dst *= static_cast<Number>(additional_data.relaxation);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline void
+CellPatchSmoother<dim, Number, VectorizedArrayType>::Tvmult(
+  VectorType       &dst,
+  const VectorType &src) const
+{
+  vmult(dst, src);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline std::size_t
+CellPatchSmoother<dim, Number, VectorizedArrayType>::memory_consumption() const
+{
+  return (cell_matrices.get() != nullptr ?
+            cell_matrices->memory_consumption() :
+            0) +
+         inverse_sqrt_multiplicity.memory_consumption() +
+         weighted_src.memory_consumption();
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline void
+CellPatchSmoother<dim, Number, VectorizedArrayType>::local_apply(
+  const MatrixFreeType                        &matrix_free,
+  VectorType                                  &dst,
+  const VectorType                            &src,
+  const std::pair<unsigned int, unsigned int> &cell_range) const
+{
+  FEEvaluation<dim, -1, 0, 1, Number, VectorizedArrayType> phi(
+    matrix_free,
+    cell_range,
+    additional_data.dof_handler_index,
+    additional_data.quad_index);
+
+  for (unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+    {
+      phi.reinit(cell);
+      phi.read_dof_values(src);
+      cell_matrices->apply_inverse(
+        cell,
+        ArrayView<VectorizedArrayType>(phi.begin_dof_values(),
+                                       phi.dofs_per_cell),
+        ArrayView<const VectorizedArrayType>(phi.begin_dof_values(),
+                                             phi.dofs_per_cell));
+      phi.distribute_local_to_global(dst);
+    }
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline std::pair<std::array<FullMatrix<Number>, dim>,
+                 std::array<FullMatrix<Number>, dim>>
+CellPatchSmoother<dim, Number, VectorizedArrayType>::
+  create_interior_penalty_matrices(
+    const FullMatrix<Number>                 &M_ref,
+    const FullMatrix<Number>                 &K_ref,
+    const std::array<std::vector<Number>, 2> &values_on_faces,
+    const std::array<std::vector<Number>, 2> &derivatives_on_faces,
+    const dealii::ndarray<TensorProductMatrixCreator::LaplaceBoundaryType,
+                          dim,
+                          2>                 &boundary_ids,
+    const dealii::ndarray<double, dim, 3>    &cell_extent,
+    const double                              penalty_factor)
+{
+  using LaplaceBoundaryType = TensorProductMatrixCreator::LaplaceBoundaryType;
+
+  const unsigned int n_dofs_1d = M_ref.n();
+
+  std::array<FullMatrix<Number>, dim> Ms;
+  std::array<FullMatrix<Number>, dim> Ks;
+
+  for (unsigned int d = 0; d < dim; ++d)
+    {
+      const double h = cell_extent[d][1];
+
+      Ms[d].reinit(n_dofs_1d, n_dofs_1d);
+      Ks[d].reinit(n_dofs_1d, n_dofs_1d);
+      for (unsigned int i = 0; i < n_dofs_1d; ++i)
+        for (unsigned int j = 0; j < n_dofs_1d; ++j)
+          {
+            Ms[d](i, j) = M_ref(i, j) * h;
+            Ks[d](i, j) = K_ref(i, j) / h;
+          }
+
+      // add the face integrals of the cell with itself: the factor of the
+      // consistency terms is one half on interior faces and one on Dirichlet
+      // faces (where the exterior value is the mirrored interior one)
+      for (unsigned int side = 0; side < 2; ++side)
+        {
+          double factor_derivative = 0.;
+          double sigma             = 0.;
+          if (boundary_ids[d][side] == LaplaceBoundaryType::internal_boundary)
+            {
+              Assert(cell_extent[d][2 * side] > 0., ExcInternalError());
+              factor_derivative = 0.5;
+              sigma =
+                0.5 * (1. / h + 1. / cell_extent[d][2 * side]) * penalty_factor;
+            }
+          else if (boundary_ids[d][side] == LaplaceBoundaryType::dirichlet)
+            {
+              factor_derivative = 1.;
+              sigma             = 2. / h * penalty_factor;
+            }
+
+          const double normal = (side == 0) ? -1. : 1.;
+          for (unsigned int i = 0; i < n_dofs_1d; ++i)
+            for (unsigned int j = 0; j < n_dofs_1d; ++j)
+              Ks[d](i, j) +=
+                sigma * values_on_faces[side][i] * values_on_faces[side][j] -
+                factor_derivative * normal / h *
+                  (derivatives_on_faces[side][j] * values_on_faces[side][i] +
+                   derivatives_on_faces[side][i] * values_on_faces[side][j]);
+        }
+    }
+
+  return {Ms, Ks};
+}
+
+#endif // DOXYGEN
+
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -63,6 +63,11 @@ namespace CUDAWrappers
    * @tparam Number Number format, @p double or @p float. Defaults to @p
    * double.
    *
+   * If Kokkos executes the kernels on the host (with the Serial, OpenMP, or
+   * Threads backend), the sum factorization in evaluate() and integrate()
+   * uses the vector units of the CPU explicitly through
+   * Kokkos::Experimental::native_simd, see internal::apply_simd().
+   *
    * @ingroup CUDAWrappers
    */
   template <int dim,
@@ -23,6 +23,10 @@
 
 #include <deal.II/matrix_free/cuda_matrix_free.templates.h>
 
+#include <Kokkos_SIMD.hpp>
+
+#include <type_traits>
+
 DEAL_II_NAMESPACE_OPEN
 
 
@@ -236,6 +240,137 @@ namespace CUDAWrappers
 #endif
 
 
+    /**
+     * Whether the kernels are executed by a Kokkos execution space on the
+     * host and Kokkos::Experimental::native_simd provides more than one lane
+     * for the type @p Number, in which case the tensor contractions in
+     * apply() use the vector units of the host explicitly. With a scalar
+     * native_simd type, the batches of apply_simd() would only add overhead
+     * to the generic loops.
+     */
+    template <typename Number>
+    constexpr bool
+    use_host_simd()
+    {
+      if constexpr (std::is_same_v<MemorySpace::Default::kokkos_space::
+                                     execution_space::memory_space,
+                                   Kokkos::HostSpace>)
+        return Kokkos::Experimental::native_simd<Number>::size() > 1;
+      else
+        return false;
+    }
+
+
+
+    /**
+     * Helper function for values() and gradients() for the execution spaces
+     * on the host and the directions 1 and 2, for which the entries that are
+     * multiplied by the same shape function value are contiguous in the index
+     * of the lower directions. These entries are processed in batches of the
+     * width of Kokkos::Experimental::native_simd, with the last batch of each
+     * line filled up with zeros. The batches are distributed among the
+     * threads of the team in the same way for computing and writing the
+     * result, so each thread only needs to keep its own part of the result.
+     */
+    template <int dim,
+              int n_q_points_1d,
+              typename Number,
+              int  direction,
+              bool dof_to_quad,
+              bool add,
+              bool in_place,
+              typename ViewTypeIn,
+              typename ViewTypeOut>
+    DEAL_II_HOST_DEVICE void
+    apply_simd(const Kokkos::TeamPolicy<
+                 MemorySpace::Default::kokkos_space::execution_space>::
+                 member_type &team_member,
+               const Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
+                                shape_data,
+               const ViewTypeIn in,
+               ViewTypeOut      out)
+    {
+      static_assert(direction > 0 && direction < dim,
+                    "The entries are only contiguous for direction > 0.");
+
+      using simd_type = Kokkos::Experimental::native_simd<Number>;
+      const auto tag  = Kokkos::Experimental::element_aligned_tag();
+
+      constexpr int n_lanes    = simd_type::size();
+      constexpr int n_q_points = Utilities::pow(n_q_points_1d, dim);
+      constexpr int n_inner    = Utilities::pow(n_q_points_1d, direction);
+      constexpr int n_outer    = n_q_points / (n_inner * n_q_points_1d);
+      constexpr int n_batches  = (n_inner + n_lanes - 1) / n_lanes;
+
+      Number t[n_q_points];
+      Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(team_member, n_outer * n_batches),
+        [&](const int &batch) {
+          const int outer    = batch / n_batches;
+          const int inner    = (batch % n_batches) * n_lanes;
+          const int n_filled = Kokkos::min(n_lanes, n_inner - inner);
+
+          Number    buffer[n_lanes];
+          simd_type x[n_q_points_1d];
+          for (int k = 0; k < n_q_points_1d; ++k)
+            {
+              const int source_idx =
+                inner + n_inner * (k + n_q_points_1d * outer);
+              for (int l = 0; l < n_lanes; ++l)
+                buffer[l] = (l < n_filled) ? in(source_idx + l) : Number();
+              x[k].copy_from(buffer, tag);
+            }
+
+          for (int q = 0; q < n_q_points_1d; ++q)
+            {
+              // This loop simply multiplies the shape function at the
+              // quadrature point by the finite element coefficients of all
+              // lanes of the batch.
+              simd_type sum(Number(0));
+              for (int k = 0; k < n_q_points_1d; ++k)
+                {
+                  const unsigned int shape_idx =
+                    dof_to_quad ? (q + k * n_q_points_1d) :
+                                  (k + q * n_q_points_1d);
+                  sum = sum + simd_type(shape_data[shape_idx]) * x[k];
+                }
+
+              sum.copy_to(buffer, tag);
+              const int destination_idx =
+                inner + n_inner * (q + n_q_points_1d * outer);
+              for (int l = 0; l < n_filled; ++l)
+                t[destination_idx + l] = buffer[l];
+            }
+        });
+
+      if constexpr (in_place)
+        team_member.team_barrier();
+
+      Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(team_member, n_outer * n_batches),
+        [&](const int &batch) {
+          const int outer    = batch / n_batches;
+          const int inner    = (batch % n_batches) * n_lanes;
+          const int n_filled = Kokkos::min(n_lanes, n_inner - inner);
+
+          for (int q = 0; q < n_q_points_1d; ++q)
+            {
+              const int destination_idx =
+                inner + n_inner * (q + n_q_points_1d * outer);
+              for (int l = 0; l < n_filled; ++l)
+                {
+                  if constexpr (add)
+                    Kokkos::atomic_add(&out(destination_idx + l),
+                                       t[destination_idx + l]);
+                  else
+                    out(destination_idx + l) = t[destination_idx + l];
+                }
+            }
+        });
+    }
+
+
+
 
     /**
      * Helper function for values() and gradients().
@@ -258,6 +393,18 @@ namespace CUDAWrappers
           const ViewTypeIn in,
           ViewTypeOut      out)
     {
+      if constexpr (use_host_simd<Number>() && direction > 0)
+        {
+          apply_simd<dim,
+                     n_q_points_1d,
+                     Number,
+                     direction,
+                     dof_to_quad,
+                     add,
+                     in_place>(team_member, shape_data, in, out);
+          return;
+        }
+
 #if KOKKOS_VERSION >= 40000
       if constexpr (dim == 1)
         apply_1d<n_q_points_1d, Number, direction, dof_to_quad, add, in_place>(
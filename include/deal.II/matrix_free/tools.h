@@ -20,6 +20,9 @@
 
 #include <deal.II/grid/tria.h>
 
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/vector.h>
+
 #include <deal.II/matrix_free/fe_evaluation.h>
 #include <deal.II/matrix_free/matrix_free.h>
 #include <deal.II/matrix_free/vector_access_internal.h>
@@ -156,6 +159,59 @@ namespace MatrixFreeTools
     const unsigned int quad_no                  = 0,
     const unsigned int first_selected_component = 0);
 
+  /**
+   * Compute the error indicator of Kelly, Gago, Zienkiewicz, and Babuska
+   * for the finite element function @p solution, using the face data that
+   * @p matrix_free has precomputed instead of setting up FEFaceValues and
+   * FESubfaceValues objects for each face. The result is the same as the one
+   * of KellyErrorEstimator::estimate() with the default strategy
+   * KellyErrorEstimator::cell_diameter_over_24, a unit coefficient, and
+   * without Neumann boundaries: For each active cell $K$,
+   * @f[
+   *   \eta_K^2 = \frac{h_K}{24} \sum_{F \subset \partial K \setminus
+   *   \partial\Omega} \int_F \left|\left[\frac{\partial u_h}{\partial
+   *   n}\right]\right|^2 \, ds,
+   * @f]
+   * where the jump of the normal derivative is summed over the
+   * @p n_components components starting at @p first_selected_component.
+   *
+   * The integrals are computed once per face with FEFaceEvaluation in a
+   * MatrixFree::loop() over the inner face batches of @p matrix_free, which
+   * include the subfaces at hanging nodes and the faces to ghost cells, with
+   * the quadrature formula @p quad_no. This requires that @p matrix_free has
+   * been set up with (at least) `update_gradients | update_JxW_values` in
+   * MatrixFree::AdditionalData::mapping_update_flags_inner_faces. The
+   * contributions of faces that are computed on another process are
+   * exchanged via the partitioner of the global active cell indices of the
+   * triangulation.
+   *
+   * @p solution needs to be compatible with the partitioner of
+   * @p matrix_free (see MatrixFree::initialize_dof_vector()). The loop
+   * imports the ghost values needed on the faces and restores the previous
+   * ghost state of the vector at the end.
+   *
+   * The vector @p estimated_error is resized to the number of active cells
+   * of the triangulation and indexed by CellAccessor::active_cell_index(),
+   * with zero entries for cells not owned by the current process, as
+   * expected by the functions in namespace GridRefinement.
+   *
+   * @note The DoFHandler may not use hp-capabilities.
+   */
+  template <int n_components,
+            int dim,
+            typename Number,
+            typename VectorizedArrayType,
+            typename VectorType,
+            typename ErrorNumber>
+  void
+  estimate_error_kelly(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const VectorType                                   &solution,
+    Vector<ErrorNumber>                                &estimated_error,
+    const unsigned int                                  dof_no  = 0,
+    const unsigned int                                  quad_no = 0,
+    const unsigned int first_selected_component = 0);
+
 
 
   /**
@@ -1305,6 +1361,106 @@ namespace MatrixFreeTools
       first_selected_component);
   }
 
+  template <int n_components,
+            int dim,
+            typename Number,
+            typename VectorizedArrayType,
+            typename VectorType,
+            typename ErrorNumber>
+  void
+  estimate_error_kelly(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const VectorType                                   &solution,
+    Vector<ErrorNumber>                                &estimated_error,
+    const unsigned int                                  dof_no,
+    const unsigned int                                  quad_no,
+    const unsigned int first_selected_component)
+  {
+    const auto &dof_handler   = matrix_free.get_dof_handler(dof_no);
+    const auto &triangulation = dof_handler.get_triangulation();
+
+    Assert(dof_handler.has_hp_capabilities() == false, ExcNotImplemented());
+
+    // the sum of the face integrals of each cell in the numbering of
+    // matrix_free, including the ghost cells
+    constexpr unsigned int n_lanes = VectorizedArrayType::size();
+    const unsigned int     n_cell_batches =
+      matrix_free.n_cell_batches() + matrix_free.n_ghost_cell_batches();
+    Vector<Number> cell_integrals(n_cell_batches * n_lanes);
+
+    using MatrixFreeType = MatrixFree<dim, Number, VectorizedArrayType>;
+    matrix_free.template loop<Vector<Number>, VectorType>(
+      [](const auto &, auto &, const auto &, const auto &) {},
+      [&](const auto &data,
+          auto       &integrals,
+          const auto &src,
+          const auto &range) {
+        FEFaceEvaluation<dim, -1, 0, n_components, Number, VectorizedArrayType>
+          phi_m(data, range, true, dof_no, quad_no, first_selected_component);
+        FEFaceEvaluation<dim, -1, 0, n_components, Number, VectorizedArrayType>
+          phi_p(data, range, false, dof_no, quad_no, first_selected_component);
+
+        for (unsigned int face = range.first; face < range.second; ++face)
+          {
+            phi_m.reinit(face);
+            phi_m.gather_evaluate(src, EvaluationFlags::gradients);
+            phi_p.reinit(face);
+            phi_p.gather_evaluate(src, EvaluationFlags::gradients);
+
+            // both sides use the normal vector of the interior cell
+            VectorizedArrayType integral = 0.;
+            for (const unsigned int q : phi_m.quadrature_point_indices())
+              {
+                const auto jump = phi_m.get_normal_derivative(q) -
+                                  phi_p.get_normal_derivative(q);
+                integral += (jump * jump) * phi_m.JxW(q);
+              }
+
+            const auto &face_info = data.get_face_info(face);
+            for (unsigned int v = 0;
+                 v < data.n_active_entries_per_face_batch(face);
+                 ++v)
+              {
+                integrals(face_info.cells_interior[v]) += integral[v];
+                integrals(face_info.cells_exterior[v]) += integral[v];
+              }
+          }
+      },
+      [](const auto &, auto &, const auto &, const auto &) {},
+      cell_integrals,
+      solution,
+      false,
+      MatrixFreeType::DataAccessOnFaces::none,
+      MatrixFreeType::DataAccessOnFaces::gradients);
+
+    // add the integrals of faces to ghost cells to the process that owns
+    // the cell, via the global active cell indices of the triangulation
+    const auto partitioner =
+      triangulation.global_active_cell_index_partitioner().lock();
+    Assert(partitioner, ExcNotInitialized());
+    LinearAlgebra::distributed::Vector<Number> face_integrals(partitioner);
+    for (unsigned int cell = 0; cell < n_cell_batches; ++cell)
+      for (unsigned int v = 0;
+           v < matrix_free.n_active_entries_per_cell_batch(cell);
+           ++v)
+        face_integrals(matrix_free.get_cell_iterator(cell, v, dof_no)
+                         ->global_active_cell_index()) +=
+          cell_integrals(cell * n_lanes + v);
+    face_integrals.compress(VectorOperation::add);
+
+    estimated_error.reinit(triangulation.n_active_cells());
+    for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+      for (unsigned int v = 0;
+           v < matrix_free.n_active_entries_per_cell_batch(cell);
+           ++v)
+        {
+          const auto dof_cell = matrix_free.get_cell_iterator(cell, v, dof_no);
+          estimated_error(dof_cell->active_cell_index()) = std::sqrt(
+            face_integrals(dof_cell->global_active_cell_index()) *
+            dof_cell->diameter() / 24);
+        }
+  }
+
 #endif // DOXYGEN
 
 } // namespace MatrixFreeTools
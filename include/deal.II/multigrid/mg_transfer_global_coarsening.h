@@ -24,6 +24,7 @@
 
 #include <deal.II/lac/affine_constraints.h>
 #include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
 
 #include <deal.II/matrix_free/constraint_info.h>
 #include <deal.II/matrix_free/shape_info.h>
@@ -285,6 +286,42 @@ public:
   void
   restrict_and_add(VectorType &dst, const VectorType &src) const;
 
+  /**
+   * Compute the residual $r = b - A x$ of the fine-level operator @p matrix
+   * for the vector @p solution ($x$) and the right-hand side @p rhs ($b$),
+   * and restrict the residual, adding the result into @p dst.
+   *
+   * The result is the same as for the sequence
+   * @code
+   *   matrix.vmult(residual, solution);
+   *   residual.sadd(-1., 1., rhs);
+   *   transfer.restrict_and_add(dst, residual);
+   * @endcode
+   * but needs fewer sweeps through memory: If @p matrix provides a
+   * `vmult()` function taking two `std::function` objects that are called
+   * on ranges of locally owned vector entries before and after the cell
+   * loop touches them (see, e.g., the operation_before_loop and
+   * operation_after_loop arguments of MatrixFree::cell_loop()), the
+   * subtraction from the right-hand side is done while the vector entries
+   * are still in caches. Furthermore, the residual is directly written into
+   * the internal fine vector of this class if the transfer cannot work on
+   * the external vectors, avoiding the copy done in restrict_and_add().
+   *
+   * The vector @p residual is used as temporary storage for the result of
+   * the matrix-vector product and is resized to the layout of @p rhs if
+   * necessary. It contains the residual on exit if the transfer works in
+   * place on the external vectors (see
+   * enable_inplace_operations_if_possible()), otherwise its content is
+   * unspecified.
+   */
+  template <typename MatrixType>
+  void
+  restrict_residual_and_add(VectorType       &dst,
+                            const MatrixType &matrix,
+                            const VectorType &solution,
+                            const VectorType &rhs,
+                            VectorType       &residual) const;
+
   /**
    * Perform interpolation of a solution vector from the fine level to the
    * coarse level.
@@ -326,6 +363,18 @@ protected:
     LinearAlgebra::distributed::Vector<Number>       &dst,
     const LinearAlgebra::distributed::Vector<Number> &src) const = 0;
 
+  /**
+   * Perform the restriction of restrict_and_add() after the fine vector has
+   * been set up. If @p src_is_in_internal_vector is true, the fine-level
+   * data has already been written into the internal vector #vec_fine and
+   * @p src is not read; otherwise, the data is copied from @p src if the
+   * transfer cannot work on the external vectors.
+   */
+  void
+  restrict_and_add_from_fine_vector(VectorType       &dst,
+                                    const VectorType &src,
+                                    const bool src_is_in_internal_vector) const;
+
   /**
    * A wrapper around update_ghost_values() optimized in case the
    * present vector has the same parallel layout of one of the external
@@ -567,6 +616,27 @@ public:
   fast_polynomial_transfer_supported(const unsigned int fe_degree_fine,
                                      const unsigned int fe_degree_coarse);
 
+  /**
+   * Enable or disable the combination of cells with different polynomial
+   * degrees within the same batch of SIMD lanes.
+   *
+   * By default, the cells are processed separately for each pair of fine
+   * and coarse finite elements (transfer scheme). For p-multigrid on
+   * hp-meshes with many different degree pairs and few cells each, this
+   * leaves many SIMD lanes empty. If enabled, the cells of the last,
+   * partially filled batch of each transfer scheme are collected and
+   * recombined into full batches of mixed degrees. The cell-wise
+   * prolongation and restriction of these batches is done by sum
+   * factorization with the 1d transfer matrices of each lane padded by
+   * zeros to the largest degrees within the batch.
+   *
+   * The option only affects elements with tensor-product shape functions;
+   * other transfer schemes are always processed separately. It can be set
+   * before or after reinit().
+   */
+  void
+  enable_mixed_degree_batching(const bool flag = true);
+
   /**
    * Perform interpolation of a solution vector from the fine level to the
    * coarse level.
@@ -605,6 +675,22 @@ protected:
     const LinearAlgebra::distributed::Vector<Number> &src) const override;
 
 private:
+  /**
+   * Perform the prolongation for the cells in #mixed_degree_batches.
+   */
+  void
+  prolongate_and_add_mixed_degree_batches(
+    LinearAlgebra::distributed::Vector<Number>       &dst,
+    const LinearAlgebra::distributed::Vector<Number> &src) const;
+
+  /**
+   * Perform the restriction for the cells in #mixed_degree_batches.
+   */
+  void
+  restrict_and_add_mixed_degree_batches(
+    LinearAlgebra::distributed::Vector<Number>       &dst,
+    const LinearAlgebra::distributed::Vector<Number> &src) const;
+
   /**
    * A multigrid transfer scheme. A multrigrid transfer class can have different
    * transfer schemes to enable p-adaptivity (one transfer scheme per
@@ -673,6 +759,12 @@ private:
      */
     internal::MatrixFreeFunctions::ShapeInfo<VectorizedArrayType>
       shape_info_coarse;
+
+    /**
+     * Number of cells at the end of the range of cells of this scheme that
+     * are processed as part of #mixed_degree_batches instead.
+     */
+    unsigned int n_cells_in_mixed_degree_batches;
   };
 
   /**
@@ -680,6 +772,69 @@ private:
    */
   std::vector<MGTransferScheme> schemes;
 
+  /**
+   * A batch of cells from different transfer schemes, see
+   * enable_mixed_degree_batching().
+   */
+  struct MixedDegreeBatch
+  {
+    /**
+     * Number of cells in the batch.
+     */
+    unsigned int n_lanes_filled;
+
+    /**
+     * Largest "polynomial degree" on the fine side among the cells of the
+     * batch, see MGTransferScheme::degree_fine. All cells are padded to
+     * this degree.
+     */
+    unsigned int degree_fine;
+
+    /**
+     * Largest polynomial degree on the coarse side among the cells of the
+     * batch.
+     */
+    unsigned int degree_coarse;
+
+    /**
+     * Index of each cell within the cells of #constraint_info_coarse and
+     * #constraint_info_fine.
+     */
+    std::array<unsigned int, VectorizedArrayType::size()> cell_indices;
+
+    /**
+     * Transfer scheme of each cell.
+     */
+    std::array<unsigned int, VectorizedArrayType::size()> scheme_indices;
+
+    /**
+     * Position of the weights of each cell, either the offset within
+     * #weights or the offset within #weights_compressed.
+     */
+    std::array<unsigned int, VectorizedArrayType::size()> weight_offsets;
+
+    /**
+     * SIMD lane of the entries in #weights_compressed of each cell.
+     */
+    std::array<unsigned int, VectorizedArrayType::size()> weight_lanes;
+
+    /**
+     * 1d prolongation matrices of all cells, padded with zeros to the size
+     * `(degree_fine + 1) x (degree_coarse + 1)`.
+     */
+    AlignedVector<VectorizedArrayType> prolongation_matrix_1d;
+  };
+
+  /**
+   * Flag set by enable_mixed_degree_batching().
+   */
+  bool use_mixed_degree_batches = false;
+
+  /**
+   * Batches of cells with mixed polynomial degrees.
+   */
+  std::vector<MixedDegreeBatch> mixed_degree_batches;
+
   /**
    * Helper class for reading from and writing to global coarse vectors and for
    * applying constraints.
@@ -1166,6 +1321,21 @@ public:
                    VectorType        &dst,
                    const VectorType  &src) const override;
 
+  /**
+   * Compute the residual of the level operator @p matrix on level
+   * @p from_level and restrict it to the next coarser level, adding into
+   * @p dst. See MGTwoLevelTransferBase::restrict_residual_and_add() for
+   * details.
+   */
+  template <typename MatrixType>
+  void
+  restrict_residual_and_add(const unsigned int from_level,
+                            VectorType        &dst,
+                            const MatrixType  &matrix,
+                            const VectorType  &solution,
+                            const VectorType  &rhs,
+                            VectorType        &residual) const;
+
   /**
    * Initialize internal vectors and copy @p src vector
    * (associated to @p dof_handler) to the finest multigrid level.
@@ -1445,6 +1615,84 @@ using MGTransferBlockGlobalCoarsening =
 
 
 
+template <typename Number>
+template <typename MatrixType>
+void
+MGTwoLevelTransferBase<LinearAlgebra::distributed::Vector<Number>>::
+  restrict_residual_and_add(
+    LinearAlgebra::distributed::Vector<Number>       &dst,
+    const MatrixType                                 &matrix,
+    const LinearAlgebra::distributed::Vector<Number> &solution,
+    const LinearAlgebra::distributed::Vector<Number> &rhs,
+    LinearAlgebra::distributed::Vector<Number>       &residual) const
+{
+  if (residual.get_partitioner().get() != rhs.get_partitioner().get())
+    residual.reinit(rhs, true);
+
+  // write the residual into the internal vector if the restriction cannot
+  // work on the external vector, in order to avoid an additional copy
+  const bool use_src_inplace = this->vec_fine.size() == 0;
+  AssertDimension(rhs.locally_owned_size(),
+                  use_src_inplace ? residual.locally_owned_size() :
+                                    this->vec_fine.locally_owned_size());
+  Number *const residual_ptr =
+    use_src_inplace ? residual.begin() : this->vec_fine.begin();
+
+  const Number *const rhs_ptr = rhs.begin();
+  const Number *const ax_ptr  = residual.begin();
+
+  const auto compute_residual = [&](const unsigned int begin,
+                                    const unsigned int end) {
+    DEAL_II_OPENMP_SIMD_PRAGMA
+    for (unsigned int i = begin; i < end; ++i)
+      residual_ptr[i] = rhs_ptr[i] - ax_ptr[i];
+  };
+
+  if constexpr (internal::has_vmult_with_std_functions_for_precondition<
+                  MatrixType,
+                  LinearAlgebra::distributed::Vector<Number>>)
+    {
+      matrix.vmult(
+        residual,
+        solution,
+        [&](const unsigned int begin, const unsigned int end) {
+          if (end > begin)
+            std::memset(residual.begin() + begin,
+                        0,
+                        sizeof(Number) * (end - begin));
+        },
+        compute_residual);
+    }
+  else
+    {
+      matrix.vmult(residual, solution);
+      compute_residual(0, rhs.locally_owned_size());
+    }
+
+  this->restrict_and_add_from_fine_vector(dst,
+                                          residual,
+                                          use_src_inplace == false);
+}
+
+
+
+template <int dim, typename Number>
+template <typename MatrixType>
+void
+MGTransferMF<dim, Number>::restrict_residual_and_add(
+  const unsigned int from_level,
+  VectorType        &dst,
+  const MatrixType  &matrix,
+  const VectorType  &solution,
+  const VectorType  &rhs,
+  VectorType        &residual) const
+{
+  this->transfer[from_level]->restrict_residual_and_add(
+    dst, matrix, solution, rhs, residual);
+}
+
+
+
 template <int dim, typename Number>
 template <typename MGTwoLevelTransferObject>
 MGTransferMF<dim, Number>::MGTransferMF(
@@ -250,6 +250,32 @@ namespace
     {}
   };
 
+  /**
+   * Run through the degrees of freedom of a tensor-product element with
+   * @p n_dofs_1d unknowns per direction and @p n_components components in
+   * lexicographic order and call @p fu with the index in this numbering
+   * and the index within the numbering padded to @p n_dofs_1d_padded
+   * unknowns per direction.
+   */
+  template <int dim, typename Fu>
+  void
+  loop_over_padded_dofs(const unsigned int n_components,
+                        const unsigned int n_dofs_1d,
+                        const unsigned int n_dofs_1d_padded,
+                        const Fu          &fu)
+  {
+    const unsigned int n_scalar_dofs_padded =
+      Utilities::pow(n_dofs_1d_padded, dim);
+
+    for (unsigned int c = 0, m = 0; c < n_components; ++c)
+      for (unsigned int k = 0; k < (dim > 2 ? n_dofs_1d : 1); ++k)
+        for (unsigned int j = 0; j < (dim > 1 ? n_dofs_1d : 1); ++j)
+          for (unsigned int i = 0; i < n_dofs_1d; ++i, ++m)
+            fu(m,
+               c * n_scalar_dofs_padded +
+                 (k * n_dofs_1d_padded + j) * n_dofs_1d_padded + i);
+  }
+
 } // namespace
 
 
@@ -1715,6 +1741,173 @@ namespace internal
 
 
   public:
+    /**
+     * Collect the cells of the partially filled batches of the transfer
+     * schemes into batches with mixed polynomial degrees.
+     */
+    template <int dim, typename Number>
+    static void
+    setup_mixed_degree_batches(
+      MGTwoLevelTransfer<dim, LinearAlgebra::distributed::Vector<Number>>
+        &transfer)
+    {
+      const unsigned int n_lanes = VectorizedArray<Number>::size();
+
+      transfer.mixed_degree_batches.clear();
+      for (auto &scheme : transfer.schemes)
+        scheme.n_cells_in_mixed_degree_batches = 0;
+
+      if (transfer.use_mixed_degree_batches == false || n_lanes == 1)
+        return;
+
+      // ... collect the cells of the last batch of each scheme, together
+      // with the position of their weights (as in setup_weights())
+      struct CellInfo
+      {
+        unsigned int cell_index;
+        unsigned int scheme_index;
+        unsigned int weight_offset;
+        unsigned int weight_lane;
+      };
+
+      std::vector<CellInfo> cells;
+      std::vector<bool>     scheme_has_cells(transfer.schemes.size(), false);
+      unsigned int          n_schemes_with_cells = 0;
+      unsigned int          cell_counter         = 0;
+      unsigned int          weight_offset        = 0;
+      unsigned int          batch_counter        = 0;
+
+      for (unsigned int s = 0; s < transfer.schemes.size(); ++s)
+        {
+          const auto &scheme = transfer.schemes[s];
+
+          const unsigned int n_remaining = scheme.n_coarse_cells % n_lanes;
+          const unsigned int n_full_cells = scheme.n_coarse_cells - n_remaining;
+
+          cell_counter += n_full_cells;
+          weight_offset += n_full_cells * scheme.n_dofs_per_cell_fine;
+          batch_counter += n_full_cells / n_lanes;
+
+          if (n_remaining == 0)
+            continue;
+
+          // only tensor-product elements with a 1d transfer matrix or
+          // identical elements can be padded
+          const bool needs_interpolation =
+            (scheme.prolongation_matrix.empty() &&
+             scheme.prolongation_matrix_1d.empty()) == false;
+          const bool is_tensor_product =
+            scheme.prolongation_matrix.empty() &&
+            scheme.n_dofs_per_cell_fine > 0 &&
+            scheme.n_dofs_per_cell_fine ==
+              transfer.n_components *
+                Utilities::pow(scheme.degree_fine + 1, dim) &&
+            scheme.n_dofs_per_cell_coarse ==
+              transfer.n_components *
+                Utilities::pow(scheme.degree_coarse + 1, dim) &&
+            (needs_interpolation || scheme.degree_fine == scheme.degree_coarse);
+
+          if (is_tensor_product)
+            {
+              scheme_has_cells[s] = true;
+              ++n_schemes_with_cells;
+
+              for (unsigned int v = 0; v < n_remaining; ++v)
+                cells.push_back(
+                  {cell_counter + v,
+                   s,
+                   transfer.weights_compressed.empty() ?
+                     weight_offset + v * scheme.n_dofs_per_cell_fine :
+                     batch_counter * Utilities::pow(3, dim),
+                   v});
+            }
+
+          cell_counter += n_remaining;
+          weight_offset += n_remaining * scheme.n_dofs_per_cell_fine;
+          ++batch_counter;
+        }
+
+      // nothing to gain if the cells come from a single scheme
+      if (n_schemes_with_cells < 2)
+        return;
+
+      for (unsigned int s = 0; s < transfer.schemes.size(); ++s)
+        if (scheme_has_cells[s])
+          transfer.schemes[s].n_cells_in_mixed_degree_batches =
+            transfer.schemes[s].n_coarse_cells % n_lanes;
+
+      // ... group cells of similar degrees to keep the padding small
+      std::stable_sort(cells.begin(),
+                       cells.end(),
+                       [&](const CellInfo &a, const CellInfo &b) {
+                         const auto &scheme_a =
+                           transfer.schemes[a.scheme_index];
+                         const auto &scheme_b =
+                           transfer.schemes[b.scheme_index];
+                         return std::make_pair(scheme_a.degree_fine,
+                                               scheme_a.degree_coarse) >
+                                std::make_pair(scheme_b.degree_fine,
+                                               scheme_b.degree_coarse);
+                       });
+
+      // ... create batches and pad the 1d prolongation matrices
+      for (unsigned int i = 0; i < cells.size(); i += n_lanes)
+        {
+          typename MGTwoLevelTransfer<
+            dim,
+            LinearAlgebra::distributed::Vector<Number>>::MixedDegreeBatch
+            batch;
+
+          batch.n_lanes_filled = std::min<unsigned int>(n_lanes,
+                                                        cells.size() - i);
+          batch.degree_fine    = 0;
+          batch.degree_coarse  = 0;
+          batch.cell_indices.fill(numbers::invalid_unsigned_int);
+          batch.scheme_indices.fill(numbers::invalid_unsigned_int);
+          batch.weight_offsets.fill(numbers::invalid_unsigned_int);
+          batch.weight_lanes.fill(numbers::invalid_unsigned_int);
+
+          for (unsigned int v = 0; v < batch.n_lanes_filled; ++v)
+            {
+              const auto &cell   = cells[i + v];
+              const auto &scheme = transfer.schemes[cell.scheme_index];
+
+              batch.cell_indices[v]   = cell.cell_index;
+              batch.scheme_indices[v] = cell.scheme_index;
+              batch.weight_offsets[v] = cell.weight_offset;
+              batch.weight_lanes[v]   = cell.weight_lane;
+              batch.degree_fine =
+                std::max(batch.degree_fine, scheme.degree_fine);
+              batch.degree_coarse =
+                std::max(batch.degree_coarse, scheme.degree_coarse);
+            }
+
+          const unsigned int n_dofs_1d_fine   = batch.degree_fine + 1;
+          const unsigned int n_dofs_1d_coarse = batch.degree_coarse + 1;
+
+          batch.prolongation_matrix_1d.resize_fast(n_dofs_1d_fine *
+                                                   n_dofs_1d_coarse);
+          batch.prolongation_matrix_1d.fill(VectorizedArray<Number>());
+
+          for (unsigned int v = 0; v < batch.n_lanes_filled; ++v)
+            {
+              const auto &scheme = transfer.schemes[batch.scheme_indices[v]];
+
+              for (unsigned int i = 0; i <= scheme.degree_coarse; ++i)
+                for (unsigned int j = 0; j <= scheme.degree_fine; ++j)
+                  batch.prolongation_matrix_1d[i * n_dofs_1d_fine + j][v] =
+                    scheme.prolongation_matrix_1d.empty() ?
+                      Number(i == j) :
+                      scheme.prolongation_matrix_1d
+                        [i * (scheme.degree_fine + 1) + j][0];
+            }
+
+          transfer.mixed_degree_batches.push_back(std::move(batch));
+        }
+    }
+
+
+
     template <int dim, typename Number>
     static std::shared_ptr<const Utilities::MPI::Partitioner>
     create_coarse_partitioner(
@@ -2240,6 +2433,9 @@ namespace internal
 
       // ------------------------------- weights -------------------------------
       setup_weights(constraints_fine, transfer, is_feq);
+
+      // -------------------------- mixed-degree batches -----------------------
+      setup_mixed_degree_batches(transfer);
     }
 
 
@@ -2704,6 +2900,9 @@ namespace internal
 
       // ------------------------------- weights -------------------------------
       setup_weights(constraints_fine, transfer, is_feq);
+
+      // -------------------------- mixed-degree batches -----------------------
+      setup_mixed_degree_batches(transfer);
     }
   };
 
@@ -3189,12 +3388,13 @@ MGTwoLevelTransfer<dim, LinearAlgebra::distributed::Vector<Number>>::
       const unsigned int n_scalar_dofs_coarse =
         scheme.n_dofs_per_cell_coarse / n_components;
 
-      for (unsigned int cell = 0; cell < scheme.n_coarse_cells; cell += n_lanes)
+      const unsigned int n_cells =
+        scheme.n_coarse_cells - scheme.n_cells_in_mixed_degree_batches;
+
+      for (unsigned int cell = 0; cell < n_cells; cell += n_lanes)
         {
           const unsigned int n_lanes_filled =
-            (cell + n_lanes > scheme.n_coarse_cells) ?
-              (scheme.n_coarse_cells - cell) :
-              n_lanes;
+            (cell + n_lanes > n_cells) ? (n_cells - cell) : n_lanes;
 
           // read from src vector (similar to FEEvaluation::read_dof_values())
           internal::VectorReader<Number, VectorizedArrayType> reader;
@@ -3264,7 +3464,23 @@ MGTwoLevelTransfer<dim, LinearAlgebra::distributed::Vector<Number>>::
 
           cell_counter += n_lanes_filled;
         }
+
+      // skip the cells processed in mixed_degree_batches
+      if (scheme.n_cells_in_mixed_degree_batches > 0)
+        {
+          cell_counter += scheme.n_cells_in_mixed_degree_batches;
+
+          if (this->fine_element_is_continuous &&
+              this->weights_compressed.size() > 0)
+            weights_compressed += Utilities::pow(3, dim);
+          else if (this->fine_element_is_continuous)
+            weights += scheme.n_cells_in_mixed_degree_batches *
+                       scheme.n_dofs_per_cell_fine;
+        }
     }
+
+  if (mixed_degree_batches.empty() == false)
+    this->prolongate_and_add_mixed_degree_batches(dst, src);
 }
 
 
@@ -3274,11 +3490,26 @@ void
 MGTwoLevelTransferBase<LinearAlgebra::distributed::Vector<Number>>::
   restrict_and_add(LinearAlgebra::distributed::Vector<Number>       &dst,
                    const LinearAlgebra::distributed::Vector<Number> &src) const
+{
+  this->restrict_and_add_from_fine_vector(dst, src, false);
+}
+
+
+
+template <typename Number>
+void
+MGTwoLevelTransferBase<LinearAlgebra::distributed::Vector<Number>>::
+  restrict_and_add_from_fine_vector(
+    LinearAlgebra::distributed::Vector<Number>       &dst,
+    const LinearAlgebra::distributed::Vector<Number> &src,
+    const bool src_is_in_internal_vector) const
 {
   const bool        use_src_inplace = this->vec_fine.size() == 0;
   const auto *const vec_fine_ptr    = use_src_inplace ? &src : &this->vec_fine;
   Assert(vec_fine_ptr->get_partitioner().get() == this->partitioner_fine.get(),
          ExcInternalError());
+  Assert(use_src_inplace == false || src_is_in_internal_vector == false,
+         ExcInternalError());
 
   const bool  use_dst_inplace = this->vec_coarse.size() == 0;
   auto *const vec_coarse_ptr  = use_dst_inplace ? &dst : &this->vec_coarse;
@@ -3288,7 +3519,7 @@ MGTwoLevelTransferBase<LinearAlgebra::distributed::Vector<Number>>::
 
   const bool src_ghosts_have_been_set = src.has_ghost_elements();
 
-  if (use_src_inplace == false)
+  if (use_src_inplace == false && src_is_in_internal_vector == false)
     this->vec_fine.copy_locally_owned_data_from(src);
 
   if ((use_src_inplace == false) ||
@@ -3368,12 +3599,13 @@ MGTwoLevelTransfer<dim, LinearAlgebra::distributed::Vector<Number>>::
       const unsigned int n_scalar_dofs_coarse =
         scheme.n_dofs_per_cell_coarse / n_components;
 
-      for (unsigned int cell = 0; cell < scheme.n_coarse_cells; cell += n_lanes)
+      const unsigned int n_cells =
+        scheme.n_coarse_cells - scheme.n_cells_in_mixed_degree_batches;
+
+      for (unsigned int cell = 0; cell < n_cells; cell += n_lanes)
         {
           const unsigned int n_lanes_filled =
-            (cell + n_lanes > scheme.n_coarse_cells) ?
-              (scheme.n_coarse_cells - cell) :
-              n_lanes;
+            (cell + n_lanes > n_cells) ? (n_cells - cell) : n_lanes;
 
           // read from source vector
           internal::VectorReader<Number, VectorizedArrayType> reader;
@@ -3444,6 +3676,258 @@ MGTwoLevelTransfer<dim, LinearAlgebra::distributed::Vector<Number>>::
 
           cell_counter += n_lanes_filled;
         }
+
+      // skip the cells processed in mixed_degree_batches
+      if (scheme.n_cells_in_mixed_degree_batches > 0)
+        {
+          cell_counter += scheme.n_cells_in_mixed_degree_batches;
+
+          if (this->fine_element_is_continuous &&
+              this->weights_compressed.size() > 0)
+            weights_compressed += Utilities::pow(3, dim);
+          else if (this->fine_element_is_continuous)
+            weights += scheme.n_cells_in_mixed_degree_batches *
+                       scheme.n_dofs_per_cell_fine;
+        }
+    }
+
+  if (mixed_degree_batches.empty() == false)
+    this->restrict_and_add_mixed_degree_batches(dst, src);
+}
+
+
+
+template <int dim, typename Number>
+void
+MGTwoLevelTransfer<dim, LinearAlgebra::distributed::Vector<Number>>::
+  prolongate_and_add_mixed_degree_batches(
+    LinearAlgebra::distributed::Vector<Number>       &dst,
+    const LinearAlgebra::distributed::Vector<Number> &src) const
+{
+  AlignedVector<VectorizedArrayType> evaluation_data_fine;
+  AlignedVector<VectorizedArrayType> evaluation_data_coarse;
+  AlignedVector<VectorizedArrayType> cell_data;
+
+  std::array<VectorizedArrayType, Utilities::pow(3, dim)> lane_weights;
+
+  for (const auto &batch : mixed_degree_batches)
+    {
+      const unsigned int n_scalar_dofs_fine =
+        Utilities::pow(batch.degree_fine + 1, dim);
+      const unsigned int n_scalar_dofs_coarse =
+        Utilities::pow(batch.degree_coarse + 1, dim);
+
+      const unsigned int max_n_dofs_per_cell =
+        n_components * std::max(n_scalar_dofs_fine, n_scalar_dofs_coarse);
+      evaluation_data_fine.resize_fast(max_n_dofs_per_cell);
+      evaluation_data_coarse.resize_fast(max_n_dofs_per_cell);
+      cell_data.resize_fast(max_n_dofs_per_cell);
+      evaluation_data_coarse.fill(VectorizedArrayType());
+
+      // read the coarse cells one by one and insert them into the padded
+      // layout of their lane
+      for (unsigned int v = 0; v < batch.n_lanes_filled; ++v)
+        {
+          const auto &scheme = schemes[batch.scheme_indices[v]];
+
+          internal::VectorReader<Number, VectorizedArrayType> reader;
+          constraint_info_coarse.read_write_operation(
+            reader,
+            src,
+            cell_data.data(),
+            batch.cell_indices[v],
+            1,
+            scheme.n_dofs_per_cell_coarse,
+            true);
+          constraint_info_coarse.apply_hanging_node_constraints(
+            batch.cell_indices[v], 1, false, cell_data);
+
+          loop_over_padded_dofs<dim>(n_components,
+                                     scheme.degree_coarse + 1,
+                                     batch.degree_coarse + 1,
+                                     [&](const unsigned int i,
+                                         const unsigned int i_padded) {
+                                       evaluation_data_coarse[i_padded][v] =
+                                         cell_data[i][0];
+                                     });
+        }
+
+      // ---------------------------- coarse -------------------------------
+      CellTransferFactory cell_transfer(batch.degree_fine, batch.degree_coarse);
+
+      for (int c = n_components - 1; c >= 0; --c)
+        {
+          CellProlongator<dim, VectorizedArrayType> cell_prolongator(
+            batch.prolongation_matrix_1d,
+            batch.prolongation_matrix_1d,
+            evaluation_data_coarse.begin() + c * n_scalar_dofs_coarse,
+            evaluation_data_fine.begin() + c * n_scalar_dofs_fine);
+          cell_transfer.run(cell_prolongator);
+        }
+      // ------------------------------ fine -------------------------------
+
+      // extract the fine cells, weight, and add into dst vector
+      for (unsigned int v = 0; v < batch.n_lanes_filled; ++v)
+        {
+          const auto &scheme = schemes[batch.scheme_indices[v]];
+
+          loop_over_padded_dofs<dim>(n_components,
+                                     scheme.degree_fine + 1,
+                                     batch.degree_fine + 1,
+                                     [&](const unsigned int i,
+                                         const unsigned int i_padded) {
+                                       cell_data[i][0] =
+                                         evaluation_data_fine[i_padded][v];
+                                     });
+
+          if (this->fine_element_is_continuous &&
+              this->weights_compressed.size() > 0)
+            {
+              for (unsigned int j = 0; j < lane_weights.size(); ++j)
+                lane_weights[j] =
+                  weights_compressed[batch.weight_offsets[v] + j]
+                                    [batch.weight_lanes[v]];
+              internal::
+                weight_fe_q_dofs_by_entity<dim, -1, VectorizedArrayType>(
+                  lane_weights.data(),
+                  n_components,
+                  scheme.degree_fine + 1,
+                  cell_data.begin());
+            }
+          else if (this->fine_element_is_continuous)
+            {
+              for (unsigned int i = 0; i < scheme.n_dofs_per_cell_fine; ++i)
+                cell_data[i][0] *= weights[batch.weight_offsets[v] + i];
+            }
+
+          internal::VectorDistributorLocalToGlobal<Number, VectorizedArrayType>
+            writer;
+          constraint_info_fine.read_write_operation(writer,
+                                                    dst,
+                                                    cell_data.data(),
+                                                    batch.cell_indices[v],
+                                                    1,
+                                                    scheme.n_dofs_per_cell_fine,
+                                                    false);
+        }
+    }
+}
+
+
+
+template <int dim, typename Number>
+void
+MGTwoLevelTransfer<dim, LinearAlgebra::distributed::Vector<Number>>::
+  restrict_and_add_mixed_degree_batches(
+    LinearAlgebra::distributed::Vector<Number>       &dst,
+    const LinearAlgebra::distributed::Vector<Number> &src) const
+{
+  AlignedVector<VectorizedArrayType> evaluation_data_fine;
+  AlignedVector<VectorizedArrayType> evaluation_data_coarse;
+  AlignedVector<VectorizedArrayType> cell_data;
+
+  std::array<VectorizedArrayType, Utilities::pow(3, dim)> lane_weights;
+
+  for (const auto &batch : mixed_degree_batches)
+    {
+      const unsigned int n_scalar_dofs_fine =
+        Utilities::pow(batch.degree_fine + 1, dim);
+      const unsigned int n_scalar_dofs_coarse =
+        Utilities::pow(batch.degree_coarse + 1, dim);
+
+      const unsigned int max_n_dofs_per_cell =
+        n_components * std::max(n_scalar_dofs_fine, n_scalar_dofs_coarse);
+      evaluation_data_fine.resize_fast(max_n_dofs_per_cell);
+      evaluation_data_coarse.resize_fast(max_n_dofs_per_cell);
+      cell_data.resize_fast(max_n_dofs_per_cell);
+      evaluation_data_fine.fill(VectorizedArrayType());
+
+      // read the fine cells one by one, weight, and insert them into the
+      // padded layout of their lane
+      for (unsigned int v = 0; v < batch.n_lanes_filled; ++v)
+        {
+          const auto &scheme = schemes[batch.scheme_indices[v]];
+
+          internal::VectorReader<Number, VectorizedArrayType> reader;
+          constraint_info_fine.read_write_operation(reader,
+                                                    src,
+                                                    cell_data.data(),
+                                                    batch.cell_indices[v],
+                                                    1,
+                                                    scheme.n_dofs_per_cell_fine,
+                                                    false);
+
+          if (this->fine_element_is_continuous &&
+              this->weights_compressed.size() > 0)
+            {
+              for (unsigned int j = 0; j < lane_weights.size(); ++j)
+                lane_weights[j] =
+                  weights_compressed[batch.weight_offsets[v] + j]
+                                    [batch.weight_lanes[v]];
+              internal::
+                weight_fe_q_dofs_by_entity<dim, -1, VectorizedArrayType>(
+                  lane_weights.data(),
+                  n_components,
+                  scheme.degree_fine + 1,
+                  cell_data.begin());
+            }
+          else if (this->fine_element_is_continuous)
+            {
+              for (unsigned int i = 0; i < scheme.n_dofs_per_cell_fine; ++i)
+                cell_data[i][0] *= weights[batch.weight_offsets[v] + i];
+            }
+
+          loop_over_padded_dofs<dim>(n_components,
+                                     scheme.degree_fine + 1,
+                                     batch.degree_fine + 1,
+                                     [&](const unsigned int i,
+                                         const unsigned int i_padded) {
+                                       evaluation_data_fine[i_padded][v] =
+                                         cell_data[i][0];
+                                     });
+        }
+
+      // ------------------------------ fine -------------------------------
+      CellTransferFactory cell_transfer(batch.degree_fine, batch.degree_coarse);
+
+      for (int c = n_components - 1; c >= 0; --c)
+        {
+          CellRestrictor<dim, VectorizedArrayType> cell_restrictor(
+            batch.prolongation_matrix_1d,
+            batch.prolongation_matrix_1d,
+            evaluation_data_fine.begin() + c * n_scalar_dofs_fine,
+            evaluation_data_coarse.begin() + c * n_scalar_dofs_coarse);
+          cell_transfer.run(cell_restrictor);
+        }
+      // ----------------------------- coarse ------------------------------
+
+      // extract the coarse cells and write into dst vector
+      for (unsigned int v = 0; v < batch.n_lanes_filled; ++v)
+        {
+          const auto &scheme = schemes[batch.scheme_indices[v]];
+
+          loop_over_padded_dofs<dim>(n_components,
+                                     scheme.degree_coarse + 1,
+                                     batch.degree_coarse + 1,
+                                     [&](const unsigned int i,
+                                         const unsigned int i_padded) {
+                                       cell_data[i][0] =
+                                         evaluation_data_coarse[i_padded][v];
+                                     });
+
+          internal::VectorDistributorLocalToGlobal<Number, VectorizedArrayType>
+            writer;
+          constraint_info_coarse.apply_hanging_node_constraints(
+            batch.cell_indices[v], 1, true, cell_data);
+          constraint_info_coarse.read_write_operation(
+            writer,
+            dst,
+            cell_data.data(),
+            batch.cell_indices[v],
+            1,
+            scheme.n_dofs_per_cell_coarse,
+            true);
+        }
     }
 }
 
@@ -3868,6 +4352,19 @@ MGTwoLevelTransfer<dim, LinearAlgebra::distributed::Vector<Number>>::
 
 
 
+template <int dim, typename Number>
+void
+MGTwoLevelTransfer<dim, LinearAlgebra::distributed::Vector<Number>>::
+  enable_mixed_degree_batching(const bool flag)
+{
+  use_mixed_degree_batches = flag;
+
+  internal::MGTwoLevelTransferImplementation::setup_mixed_degree_batches(
+    *this);
+}
+
+
+
 template <int dim, typename Number>
 std::size_t
 MGTwoLevelTransfer<dim, LinearAlgebra::distributed::Vector<Number>>::
@@ -3883,6 +4380,9 @@ MGTwoLevelTransfer<dim, LinearAlgebra::distributed::Vector<Number>>::
       size += scheme.restriction_matrix_1d.memory_consumption();
     }
 
+  for (const auto &batch : mixed_degree_batches)
+    size += batch.prolongation_matrix_1d.memory_consumption();
+
   size += this->partitioner_fine->memory_consumption();
   size += this->partitioner_coarse->memory_consumption();
   size += this->vec_fine.memory_consumption();
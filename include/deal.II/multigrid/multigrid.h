@@ -151,7 +151,8 @@ namespace mg
  * The function which starts a multigrid cycle on the finest level is cycle().
  * Depending on the cycle type chosen with the constructor (see enum Cycle),
  * this function triggers one of the cycles level_v_step() or level_step(),
- * where the latter one can do different types of cycles.
+ * where the latter one can do different types of cycles, or the additive
+ * cycle additive_step().
  *
  * Using this class, it is expected that the right hand side has been
  * converted from a vector living on the locally finest level to a multilevel
@@ -173,7 +174,10 @@ public:
     /// The W-cycle
     w_cycle,
     /// The F-cycle
-    f_cycle
+    f_cycle,
+    /// The additive cycle (BPX-type), where all levels are smoothed
+    /// independently, see additive_step()
+    additive
   };
 
   using vector_type       = VectorType;
@@ -307,6 +311,31 @@ public:
    */
   void set_cycle(Cycle);
 
+  /**
+   * Select whether the level operations of the additive cycle (see
+   * Cycle::additive) should be run concurrently. If enabled, the smoother
+   * on each level, as well as the coarse solver, is spawned as a separate
+   * task via Threads::new_task() as soon as the defect on that level is
+   * available. The restriction to the next coarser level and the
+   * prolongation of the coarser corrections then proceed in parallel to
+   * the smoothing on the finer levels, which overlaps the communication
+   * in the transfer with the computations of the smoothers. The default is
+   * to run all operations one after the other.
+   *
+   * @note Enabling this option requires that the smoother, the coarse
+   * solver and the transfer can be invoked concurrently on different
+   * levels. In particular, the level operators must not share any scratch
+   * data between levels. In parallel computations, all MPI communication
+   * of the level operations then happens from different threads, which
+   * requires an MPI library initialized with MPI_THREAD_MULTIPLE and
+   * communication patterns that cannot be mixed up between levels (e.g.,
+   * different communicators on each level). Furthermore, functions
+   * connected to the signals of this class are called from different
+   * threads and must be thread-safe.
+   */
+  void
+  set_concurrent_level_operations(const bool flag);
+
   /**
    * Connect a function to mg::Signals::pre_smoother_step.
    */
@@ -381,11 +410,38 @@ private:
   void
   level_step(const unsigned int level, Cycle cycle);
 
+  /**
+   * The additive multigrid method. As opposed to the multiplicative cycles
+   * level_v_step() and level_step(), the smoother on each level is applied
+   * to the restricted defect of the finest level rather than to the
+   * residual after the coarse-grid correction, i.e., the preconditioner is
+   * the sum of the level contributions $\sum_\ell P_\ell S_\ell R_\ell$.
+   * As a consequence, the smoothers on all levels and the coarse solver
+   * are independent of each other and can run concurrently, see
+   * set_concurrent_level_operations(). Only the pre-smoother is used. The
+   * resulting operator is symmetric if the smoothers and the coarse solver
+   * are symmetric and the prolongation is the transpose of the
+   * restriction, which makes this cycle usable as a preconditioner in
+   * SolverCG.
+   *
+   * The additive cycle is not available with edge matrices, i.e., it
+   * requires that the operators on each level cover the whole domain as
+   * done in global-coarsening multigrid.
+   */
+  void
+  additive_step();
+
   /**
    * Cycle type performed by the method cycle().
    */
   Cycle cycle_type;
 
+  /**
+   * Flag indicating whether the level operations of the additive cycle are
+   * run concurrently, see set_concurrent_level_operations().
+   */
+  bool concurrent_level_operations;
+
   /**
    * Level for coarse grid solution.
    */
@@ -663,6 +719,7 @@ Multigrid<VectorType>::Multigrid(const MGMatrixBase<VectorType>     &matrix,
                                  const unsigned int                max_level,
                                  Cycle                             cycle)
   : cycle_type(cycle)
+  , concurrent_level_operations(false)
   , matrix(&matrix, typeid(*this).name())
   , coarse(&coarse, typeid(*this).name())
   , transfer(&transfer, typeid(*this).name())
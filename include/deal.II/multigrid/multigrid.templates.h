@@ -20,6 +20,7 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/logstream.h>
+#include <deal.II/base/thread_management.h>
 
 #include <deal.II/multigrid/multigrid.h>
 
@@ -74,6 +75,15 @@ Multigrid<VectorType>::set_cycle(typename Multigrid<VectorType>::Cycle c)
 
 
 
+template <typename VectorType>
+void
+Multigrid<VectorType>::set_concurrent_level_operations(const bool flag)
+{
+  concurrent_level_operations = flag;
+}
+
+
+
 template <typename VectorType>
 void
 Multigrid<VectorType>::set_edge_matrices(
@@ -265,6 +275,74 @@ Multigrid<VectorType>::level_step(const unsigned int level, Cycle cycle)
 
 
 
+template <typename VectorType>
+void
+Multigrid<VectorType>::additive_step()
+{
+  Assert(edge_out == nullptr && edge_in == nullptr && edge_down == nullptr &&
+           edge_up == nullptr,
+         ExcMessage("The additive multigrid cycle does not support edge "
+                    "matrices."));
+
+  const auto smooth_on_level = [this](const unsigned int level) {
+    if (level == minlevel)
+      {
+        this->signals.coarse_solve(true, level);
+        (*coarse)(level, solution[level], defect[level]);
+        this->signals.coarse_solve(false, level);
+      }
+    else
+      {
+        this->signals.pre_smoother_step(true, level);
+        pre_smooth->apply(level, solution[level], defect[level]);
+        this->signals.pre_smoother_step(false, level);
+      }
+  };
+
+  // Walk down the levels and restrict the defect. If the level operations
+  // run concurrently, the smoother on a level is started as soon as its
+  // defect is complete, and the restriction works on a copy of the defect
+  // (the transfer and the smoother might both need to update the ghost
+  // entries of the source vector)
+  std::vector<Threads::Task<void>> level_tasks(maxlevel - minlevel + 1);
+  for (unsigned int level = maxlevel; level > minlevel; --level)
+    {
+      if (concurrent_level_operations)
+        {
+          t[level] = defect[level];
+          level_tasks[level - minlevel] =
+            Threads::new_task(smooth_on_level, level);
+        }
+      else
+        smooth_on_level(level);
+
+      this->signals.restriction(true, level);
+      transfer->restrict_and_add(level,
+                                 defect[level - 1],
+                                 concurrent_level_operations ? t[level] :
+                                                               defect[level]);
+      this->signals.restriction(false, level);
+    }
+
+  // the coarse solver runs on the present thread, in parallel to the
+  // smoothers on the finer levels that might still be active
+  smooth_on_level(minlevel);
+
+  // Sum up the level contributions from the coarsest to the finest level,
+  // waiting for the smoother on each level only once its result is needed
+  for (unsigned int level = minlevel + 1; level <= maxlevel; ++level)
+    {
+      if (level_tasks[level - minlevel].joinable())
+        level_tasks[level - minlevel].join();
+
+      this->signals.prolongation(true, level);
+      transfer->prolongate_and_add(level, solution[level], solution[level - 1]);
+      this->signals.prolongation(false, level);
+    }
+}
+
+
+
 template <typename VectorType>
 void
 Multigrid<VectorType>::cycle()
@@ -276,7 +354,7 @@ Multigrid<VectorType>::cycle()
       solution.resize(minlevel, maxlevel);
       t.resize(minlevel, maxlevel);
     }
-  if (cycle_type != v_cycle &&
+  if ((cycle_type == w_cycle || cycle_type == f_cycle) &&
       (defect2.min_level() != minlevel || defect2.max_level() != maxlevel))
     defect2.resize(minlevel, maxlevel);
 
@@ -287,12 +365,14 @@ Multigrid<VectorType>::cycle()
       // method of the smoother -> do not force them to be zeroed out here
       solution[level].reinit(defect[level], level > minlevel);
       t[level].reinit(defect[level], level > minlevel);
-      if (cycle_type != v_cycle)
+      if (cycle_type == w_cycle || cycle_type == f_cycle)
         defect2[level].reinit(defect[level]);
     }
 
   if (cycle_type == v_cycle)
     level_v_step(maxlevel);
+  else if (cycle_type == additive)
+    additive_step();
   else
     level_step(maxlevel, cycle_type);
 }
@@ -20,11 +20,14 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/bounding_box.h>
+
 #include <deal.II/grid/filtered_iterator.h>
 
 #include <deal.II/numerics/data_out_dof_data.h>
 
 #include <memory>
+#include <optional>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -409,6 +412,44 @@ public:
   void
   set_cell_selection(const FilteredIterator<cell_iterator> &filtered_iterator);
 
+  /**
+   * Select a reduced set of cells for output, in order to generate output
+   * that is much smaller than output on all active cells, e.g., for
+   * monitoring long-running computations. This function is built on
+   * set_cell_selection() and replaces the selection previously set.
+   *
+   * @param[in] max_level All active cells on levels finer than this level
+   *   are collapsed into their ancestor on level @p max_level, i.e., output
+   *   is generated on that (non-active) ancestor, with the solution
+   *   interpolated from its children as explained in the documentation of
+   *   this class. Active cells on level @p max_level or coarser are output
+   *   as usual. The default value of numbers::invalid_unsigned_int does
+   *   not collapse any cells. Each level of collapsed cells reduces the size
+   *   of the output by a factor of about $2^{dim}$ for a given number of
+   *   subdivisions.
+   * @param[in] region If given, only cells whose bounding box intersects
+   *   this box are selected, i.e., output is restricted to a region of
+   *   interest.
+   *
+   * On parallel triangulations, an ancestor cell is only selected if all of
+   * its active descendants are locally owned, so that the ancestor is output
+   * by exactly one process. If this is not the case, the locally owned
+   * active descendants of this ancestor are output instead.
+   *
+   * @note Since cell data can not be interpolated to coarser cells, this
+   *   function can only be used with collapsed cells if no cell data has
+   *   been added. Likewise, it does not support DoFHandler objects with
+   *   hp-capabilities if cells are collapsed.
+   *
+   * @note The size of the output can be reduced further by writing the data
+   *   with fewer significant bits, see
+   *   DataOutBase::VtkFlags::n_significant_bits.
+   */
+  void
+  set_cell_selection(
+    const unsigned int                          max_level,
+    const std::optional<BoundingBox<spacedim>> &region = {});
+
   /**
    * Return the two function objects that are in use for determining the first
    * and the next cell as set by set_cell_selection().
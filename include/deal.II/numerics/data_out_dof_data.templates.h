@@ -571,6 +571,18 @@ namespace internal
                   else
                     x_fe_values[dataset]->reinit(dh_cell);
                 }
+              else if (dof_data[dataset]->dof_handler != nullptr)
+                {
+                  // on cells with children, the values of the solution are
+                  // interpolated from the children, which needs an iterator
+                  // into the DoFHandler rather than the Triangulation
+                  const typename DoFHandler<dim, spacedim>::cell_iterator
+                    dh_cell(&cell->get_triangulation(),
+                            cell->level(),
+                            cell->index(),
+                            dof_data[dataset]->dof_handler);
+                  x_fe_values[dataset]->reinit(dh_cell);
+                }
               else
                 x_fe_values[dataset]->reinit(cell);
             }
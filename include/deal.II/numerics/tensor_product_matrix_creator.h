@@ -72,6 +72,23 @@ namespace TensorProductMatrixCreator
     const dealii::ndarray<double, dim, 3>              &cell_extent,
     const unsigned int                                  n_overlap = 1);
 
+  /**
+   * Same as above but with the 1d reference-cell
+   * @ref GlossMassMatrix "mass matrix" @p M_ref and derivative matrix
+   * @p K_ref, in lexicographic numbering of the unknowns, given directly.
+   * This is useful if the matrices need to be created for many cells, as
+   * the reference matrices need to be computed only once.
+   */
+  template <int dim, typename Number>
+  std::pair<std::array<FullMatrix<Number>, dim>,
+            std::array<FullMatrix<Number>, dim>>
+  create_laplace_tensor_product_matrix(
+    const FullMatrix<Number>                           &M_ref,
+    const FullMatrix<Number>                           &K_ref,
+    const dealii::ndarray<LaplaceBoundaryType, dim, 2> &boundary_ids,
+    const dealii::ndarray<double, dim, 3>              &cell_extent,
+    const unsigned int                                  n_overlap = 1);
+
   /**
    * Same as above but the boundary IDs are extracted from the given @p cell
    * and are mapped to the boundary type via the sets @p dirichlet_boundaries and @p neumann_boundaries.
@@ -192,9 +209,29 @@ namespace TensorProductMatrixCreator
     const auto &is_dg =
       std::get<2>(create_reference_mass_and_stiffness_matrices);
 
+    AssertThrow(is_dg == false, ExcNotImplemented());
+
+    return create_laplace_tensor_product_matrix<dim, Number>(
+      M_ref, K_ref, boundary_ids, cell_extent, n_overlap);
+  }
+
+
+
+  template <int dim, typename Number>
+  std::pair<std::array<FullMatrix<Number>, dim>,
+            std::array<FullMatrix<Number>, dim>>
+  create_laplace_tensor_product_matrix(
+    const FullMatrix<Number>                           &M_ref,
+    const FullMatrix<Number>                           &K_ref,
+    const dealii::ndarray<LaplaceBoundaryType, dim, 2> &boundary_ids,
+    const dealii::ndarray<double, dim, 3>              &cell_extent,
+    const unsigned int                                  n_overlap)
+  {
     AssertIndexRange(n_overlap, M_ref.n());
     AssertIndexRange(0, n_overlap);
-    AssertThrow(is_dg == false, ExcNotImplemented());
+    AssertDimension(M_ref.m(), M_ref.n());
+    AssertDimension(K_ref.m(), M_ref.m());
+    AssertDimension(K_ref.n(), M_ref.n());
 
     // 2) loop over all dimensions and create 1d mass and stiffness
     // matrices so that boundary conditions and overlap are considered
@@ -30,6 +30,8 @@
 
 #include <deal.II/matrix_free/fe_point_evaluation.h>
 
+#include <deal.II/non_matching/mapping_info.h>
+
 DEAL_II_NAMESPACE_OPEN
 
 namespace VectorTools
@@ -280,6 +282,133 @@ namespace VectorTools
 
 
 
+  /**
+   * A class for the repeated evaluation of finite element solutions at a
+   * fixed set of (arbitrary and even remote) points, as needed, e.g., for
+   * probes that monitor a solution in every time step.
+   *
+   * In contrast to point_values() and point_gradients() called with a
+   * Utilities::MPI::RemotePointEvaluation object, which only caches the
+   * location of the points, this class additionally precomputes the mapping
+   * data at the reference points in a NonMatching::MappingInfo object. The
+   * evaluation of a solution vector then neither searches for the points
+   * nor evaluates the mapping, and only consists of the interpolation of the
+   * solution within the cells and the communication of the results.
+   *
+   * @code
+   * VectorTools::PointEvaluationCache<dim> cache;
+   * cache.reinit(probe_points, triangulation, mapping);
+   *
+   * for (unsigned int step = 0; step < n_steps; ++step)
+   *   {
+   *     // solve for the solution in this time step: not shown
+   *
+   *     const auto values = cache.point_values<1>(dof_handler, solution);
+   *     const auto gradients =
+   *       cache.point_gradients<1>(dof_handler, solution);
+   *   }
+   * @endcode
+   *
+   * @note Refinement/coarsening/repartitioning as well as a change of the
+   *   mapping invalidate the cache, and reinit() has to be called again.
+   */
+  template <int dim, int spacedim = dim>
+  class PointEvaluationCache
+  {
+  public:
+    /**
+     * Constructor. The arguments are passed on to the underlying
+     * Utilities::MPI::RemotePointEvaluation object, see there for a
+     * description.
+     */
+    PointEvaluationCache(const double tolerance              = 1e-6,
+                         const bool   enforce_unique_mapping = false);
+
+    /**
+     * Locate the points @p evaluation_points in @p triangulation and
+     * precompute the data of @p mapping at the corresponding reference
+     * points. The argument @p update_flags determines which quantities can
+     * be evaluated later on: update_values is needed for point_values() and
+     * update_gradients for point_gradients().
+     *
+     * @warning This is a collective call that needs to be executed by all
+     *   processors in the communicator.
+     */
+    void
+    reinit(const std::vector<Point<spacedim>> &evaluation_points,
+           const Triangulation<dim, spacedim> &triangulation,
+           const Mapping<dim, spacedim>       &mapping,
+           const UpdateFlags update_flags = update_values | update_gradients);
+
+    /**
+     * Return the underlying Utilities::MPI::RemotePointEvaluation object,
+     * e.g., to check whether all points have been found.
+     */
+    const Utilities::MPI::RemotePointEvaluation<dim, spacedim> &
+    get_remote_point_evaluation() const;
+
+    /**
+     * Evaluate the values of @p vector, which is defined on @p dof_handler,
+     * at the points passed to reinit(). The arguments @p flags and
+     * @p first_selected_component have the same meaning as in the function
+     * VectorTools::point_values().
+     *
+     * @warning This is a collective call that needs to be executed by all
+     *   processors in the communicator.
+     */
+    template <int n_components, typename VectorType>
+    std::vector<
+      typename FEPointEvaluation<n_components, dim, spacedim>::value_type>
+    point_values(const DoFHandler<dim, spacedim>       &dof_handler,
+                 const VectorType                      &vector,
+                 const EvaluationFlags::EvaluationFlags flags =
+                   EvaluationFlags::avg,
+                 const unsigned int first_selected_component = 0);
+
+    /**
+     * Same as point_values() but for the gradients.
+     *
+     * @warning This is a collective call that needs to be executed by all
+     *   processors in the communicator.
+     */
+    template <int n_components, typename VectorType>
+    std::vector<
+      typename FEPointEvaluation<n_components, dim, spacedim>::gradient_type>
+    point_gradients(const DoFHandler<dim, spacedim>       &dof_handler,
+                    const VectorType                      &vector,
+                    const EvaluationFlags::EvaluationFlags flags =
+                      EvaluationFlags::avg,
+                    const unsigned int first_selected_component = 0);
+
+  private:
+    /**
+     * Evaluate @p vector at the points and return the quantity selected by
+     * @p process_quadrature_point.
+     */
+    template <int n_components, typename VectorType, typename value_type>
+    std::vector<value_type>
+    evaluate(const DoFHandler<dim, spacedim>       &dof_handler,
+             const VectorType                      &vector,
+             const EvaluationFlags::EvaluationFlags flags,
+             const unsigned int                     first_selected_component,
+             const dealii::EvaluationFlags::EvaluationFlags evaluation_flags,
+             const std::function<value_type(
+               const FEPointEvaluation<n_components, dim, spacedim> &,
+               const unsigned int)> &process_quadrature_point);
+
+    /**
+     * The object locating the points and communicating the results.
+     */
+    Utilities::MPI::RemotePointEvaluation<dim, spacedim>
+      remote_point_evaluation;
+
+    /**
+     * The mapping data at the reference points of the cells listed in the
+     * cell data of remote_point_evaluation, in the same order.
+     */
+    std::unique_ptr<NonMatching::MappingInfo<dim, spacedim>> mapping_info;
+  };
+
   // inlined functions
 
 
@@ -641,6 +770,51 @@ namespace VectorTools
 
 
 
+    /**
+     * Turn the results computed by Utilities::MPI::RemotePointEvaluation into
+     * one result per point. If the map between points and cells is not
+     * unique, the results of points found in several cells are reduced
+     * according to @p flags.
+     */
+    template <int dim, int spacedim, typename value_type>
+    std::vector<value_type>
+    reduce_results(
+      const Utilities::MPI::RemotePointEvaluation<dim, spacedim> &cache,
+      const EvaluationFlags::EvaluationFlags                      flags,
+      std::vector<value_type> &evaluation_point_results)
+    {
+      if (cache.is_map_unique())
+        {
+          // each point has exactly one result (unique map)
+          return std::move(evaluation_point_results);
+        }
+      else
+        {
+          // map is not unique (multiple or no results): postprocessing is
+          // needed
+          std::vector<value_type> unique_evaluation_point_results(
+            cache.get_point_ptrs().size() - 1);
+
+          const auto &ptr = cache.get_point_ptrs();
+
+          for (unsigned int i = 0; i < ptr.size() - 1; ++i)
+            {
+              const auto n_entries = ptr[i + 1] - ptr[i];
+              if (n_entries == 0)
+                continue;
+
+              unique_evaluation_point_results[i] =
+                reduce(flags,
+                       ArrayView<const value_type>(
+                         evaluation_point_results.data() + ptr[i], n_entries));
+            }
+
+          return unique_evaluation_point_results;
+        }
+    }
+
+
+
     template <int n_components,
               int dim,
               int spacedim,
@@ -679,7 +853,7 @@ namespace VectorTools
           "a scenario not supported!"));
 
       // evaluate values at points if possible
-      const auto evaluation_point_results = [&]() {
+      auto evaluation_point_results = [&]() {
         // helper function for accessing the global vector and interpolating
         // the results onto the points
         const auto evaluation_function = [&](auto       &values,
@@ -718,34 +892,7 @@ namespace VectorTools
         return evaluation_point_results;
       }();
 
-      if (cache.is_map_unique())
-        {
-          // each point has exactly one result (unique map)
-          return evaluation_point_results;
-        }
-      else
-        {
-          // map is not unique (multiple or no results): postprocessing is
-          // needed
-          std::vector<value_type> unique_evaluation_point_results(
-            cache.get_point_ptrs().size() - 1);
-
-          const auto &ptr = cache.get_point_ptrs();
-
-          for (unsigned int i = 0; i < ptr.size() - 1; ++i)
-            {
-              const auto n_entries = ptr[i + 1] - ptr[i];
-              if (n_entries == 0)
-                continue;
-
-              unique_evaluation_point_results[i] =
-                reduce(flags,
-                       ArrayView<const value_type>(
-                         evaluation_point_results.data() + ptr[i], n_entries));
-            }
-
-          return unique_evaluation_point_results;
-        }
+      return reduce_results(cache, flags, evaluation_point_results);
     }
   } // namespace internal
 
@@ -841,6 +988,193 @@ namespace VectorTools
       });
   }
 
+
+
+  template <int dim, int spacedim>
+  PointEvaluationCache<dim, spacedim>::PointEvaluationCache(
+    const double tolerance,
+    const bool   enforce_unique_mapping)
+    : remote_point_evaluation(tolerance, enforce_unique_mapping)
+  {}
+
+
+
+  template <int dim, int spacedim>
+  void
+  PointEvaluationCache<dim, spacedim>::reinit(
+    const std::vector<Point<spacedim>> &evaluation_points,
+    const Triangulation<dim, spacedim> &triangulation,
+    const Mapping<dim, spacedim>       &mapping,
+    const UpdateFlags                   update_flags)
+  {
+    remote_point_evaluation.reinit(evaluation_points, triangulation, mapping);
+
+    // precompute the mapping data at the reference points of all cells
+    // that hold points, in the order in which the cells are visited by
+    // Utilities::MPI::RemotePointEvaluation::evaluate_and_process()
+    const auto &cell_data = remote_point_evaluation.get_cell_data();
+
+    std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+                                         cells;
+    std::vector<std::vector<Point<dim>>> unit_points;
+    cells.reserve(cell_data.cells.size());
+    unit_points.reserve(cell_data.cells.size());
+    for (const auto cell : cell_data.cell_indices())
+      {
+        cells.push_back(cell_data.get_active_cell_iterator(cell));
+        const ArrayView<const Point<dim>> points =
+          cell_data.get_unit_points(cell);
+        unit_points.emplace_back(points.begin(), points.end());
+      }
+
+    mapping_info =
+      std::make_unique<NonMatching::MappingInfo<dim, spacedim>>(mapping,
+                                                                update_flags);
+    mapping_info->reinit_cells(cells, unit_points);
+  }
+
+
+
+  template <int dim, int spacedim>
+  const Utilities::MPI::RemotePointEvaluation<dim, spacedim> &
+  PointEvaluationCache<dim, spacedim>::get_remote_point_evaluation() const
+  {
+    return remote_point_evaluation;
+  }
+
+
+
+  template <int dim, int spacedim>
+  template <int n_components, typename VectorType>
+  std::vector<
+    typename FEPointEvaluation<n_components, dim, spacedim>::value_type>
+  PointEvaluationCache<dim, spacedim>::point_values(
+    const DoFHandler<dim, spacedim>       &dof_handler,
+    const VectorType                      &vector,
+    const EvaluationFlags::EvaluationFlags flags,
+    const unsigned int                     first_selected_component)
+  {
+    Assert(mapping_info != nullptr &&
+             (mapping_info->get_update_flags() & update_values),
+           ExcMessage("The cache has not been set up for the evaluation of "
+                      "values. Call reinit() with update_values."));
+
+    return evaluate<
+      n_components,
+      VectorType,
+      typename FEPointEvaluation<n_components, dim, spacedim>::value_type>(
+      dof_handler,
+      vector,
+      flags,
+      first_selected_component,
+      dealii::EvaluationFlags::values,
+      [](const auto &evaluator, const unsigned int q) {
+        return evaluator.get_value(q);
+      });
+  }
+
+
+
+  template <int dim, int spacedim>
+  template <int n_components, typename VectorType>
+  std::vector<
+    typename FEPointEvaluation<n_components, dim, spacedim>::gradient_type>
+  PointEvaluationCache<dim, spacedim>::point_gradients(
+    const DoFHandler<dim, spacedim>       &dof_handler,
+    const VectorType                      &vector,
+    const EvaluationFlags::EvaluationFlags flags,
+    const unsigned int                     first_selected_component)
+  {
+    Assert(mapping_info != nullptr &&
+             (mapping_info->get_update_flags() & update_gradients),
+           ExcMessage("The cache has not been set up for the evaluation of "
+                      "gradients. Call reinit() with update_gradients."));
+
+    return evaluate<
+      n_components,
+      VectorType,
+      typename FEPointEvaluation<n_components, dim, spacedim>::gradient_type>(
+      dof_handler,
+      vector,
+      flags,
+      first_selected_component,
+      dealii::EvaluationFlags::gradients,
+      [](const auto &evaluator, const unsigned int q) {
+        return evaluator.get_gradient(q);
+      });
+  }
+
+
+
+  template <int dim, int spacedim>
+  template <int n_components, typename VectorType, typename value_type>
+  std::vector<value_type>
+  PointEvaluationCache<dim, spacedim>::evaluate(
+    const DoFHandler<dim, spacedim>               &dof_handler,
+    const VectorType                              &vector,
+    const EvaluationFlags::EvaluationFlags         flags,
+    const unsigned int                             first_selected_component,
+    const dealii::EvaluationFlags::EvaluationFlags evaluation_flags,
+    const std::function<
+      value_type(const FEPointEvaluation<n_components, dim, spacedim> &,
+                 const unsigned int)> &process_quadrature_point)
+  {
+    Assert(
+      &dof_handler.get_triangulation() ==
+        &remote_point_evaluation.get_triangulation(),
+      ExcMessage(
+        "The provided PointEvaluationCache and DoFHandler object have been "
+        "set up with different Triangulation objects, a scenario not "
+        "supported!"));
+
+    using EvaluatorType = FEPointEvaluation<n_components, dim, spacedim>;
+
+    std::vector<double>                         solution_values;
+    std::vector<std::unique_ptr<EvaluatorType>> evaluators(
+      dof_handler.get_fe_collection().size());
+
+    const auto evaluation_function =
+      [&](const ArrayView<value_type> &values,
+          const typename Utilities::MPI::RemotePointEvaluation<dim, spacedim>::
+            CellData &cell_data) {
+        for (const auto cell_index : cell_data.cell_indices())
+          {
+            const auto cell =
+              cell_data.get_active_cell_iterator(cell_index)
+                ->as_dof_handler_iterator(dof_handler);
+
+            solution_values.resize(cell->get_fe().n_dofs_per_cell());
+            cell->get_dof_values(vector,
+                                 solution_values.begin(),
+                                 solution_values.end());
+
+            auto &evaluator = evaluators[cell->active_fe_index()];
+            if (evaluator == nullptr)
+              evaluator =
+                std::make_unique<EvaluatorType>(*mapping_info,
+                                                cell->get_fe(),
+                                                first_selected_component);
+
+            evaluator->reinit(cell_index);
+            evaluator->evaluate(solution_values, evaluation_flags);
+
+            const ArrayView<value_type> cell_values =
+              cell_data.get_data_view(cell_index, values);
+            for (unsigned int q = 0; q < cell_values.size(); ++q)
+              cell_values[q] = process_quadrature_point(*evaluator, q);
+          }
+      };
+
+    std::vector<value_type> evaluation_point_results;
+    std::vector<value_type> buffer;
+    remote_point_evaluation.template evaluate_and_process<value_type>(
+      evaluation_point_results, buffer, evaluation_function);
+
+    return internal::reduce_results(remote_point_evaluation,
+                                    flags,
+                                    evaluation_point_results);
+  }
+
 #endif
 } // namespace VectorTools
 
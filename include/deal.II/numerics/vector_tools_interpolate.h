@@ -65,6 +65,10 @@ namespace VectorTools
    * with the hanging nodes from space @p dof afterwards, to make the result
    * continuous again.
    *
+   * If the library is configured to use multithreading, this function works
+   * in parallel. In that case, @p function is evaluated on several cells
+   * concurrently and must therefore be safe to call from several threads.
+   *
    * See the general documentation of this namespace for further information.
    *
    * @dealiiConceptRequires{concepts::is_writable_dealii_vector_type<VectorType>}
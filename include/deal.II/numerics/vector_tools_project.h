@@ -103,7 +103,11 @@ namespace VectorTools
    * for the mass operator. In the case of hypercube cells, a
    * QGauss(fe_degree+2) object is used for the mass operator. You should
    * therefore make sure that the given quadrature formula is sufficiently
-   * accurate for creating the right-hand side.
+   * accurate for creating the right-hand side. For discontinuous elements of
+   * type FE_DGQ (or derived classes) without constraints on meshes of affine
+   * cells, the @ref GlossMassMatrix "mass matrix" is block-diagonal and gets
+   * inverted cell by cell with MatrixFreeOperators::CellwiseInverseMassMatrix
+   * instead of solving a linear system.
    *
    * Otherwise, only serial Triangulations are supported and the @ref GlossMassMatrix "mass matrix"
    * is assembled using MatrixTools::create_mass_matrix. The given
@@ -184,6 +184,20 @@ namespace VectorTools
       AssertDimension(dof.get_fe(0).n_components(), function.n_components);
       AssertDimension(dof.get_fe(0).n_components(), components);
 
+      // For discontinuous tensor-product elements without constraints, the
+      // mass matrix is block-diagonal and can be inverted cell by cell with
+      // MatrixFreeOperators::CellwiseInverseMassMatrix, which needs a Gauss
+      // quadrature with as many points as there are degrees of freedom per
+      // component. This is exact if the Jacobian is constant on all cells
+      // and avoids the iterative solver altogether.
+      bool use_cellwise_inverse =
+        Utilities::MPI::min(
+          int(dof.get_triangulation().all_reference_cells_are_hyper_cube() &&
+              dynamic_cast<const FE_DGQ<dim, spacedim> *>(
+                &dof.get_fe().base_element(0)) != nullptr &&
+              constraints.n_constraints() == 0),
+          dof.get_communicator()) == 1;
+
       Quadrature<dim> quadrature_mf;
 
       if (dof.get_fe(0).reference_cell() ==
@@ -196,7 +210,10 @@ namespace VectorTools
         // quadrature rule (which is guaranteed to be tabulated).
         quadrature_mf = quadrature;
 
-      // set up mass matrix and right hand side
+      // set up mass matrix and right hand side. If the cellwise inverse is
+      // possible, add the Gauss quadrature it needs as a second quadrature
+      // formula, such that the iterative solver can still be used with the
+      // same object if some cells turn out not to be affine
       typename MatrixFree<dim, Number>::AdditionalData additional_data;
       additional_data.tasks_parallel_scheme =
         MatrixFree<dim, Number>::AdditionalData::partition_color;
@@ -204,8 +221,69 @@ namespace VectorTools
         (update_values | update_JxW_values);
       std::shared_ptr<MatrixFree<dim, Number>> matrix_free(
         new MatrixFree<dim, Number>());
-      matrix_free->reinit(
-        mapping, dof, constraints, quadrature_mf, additional_data);
+      std::vector<Quadrature<dim>> quadratures(1, quadrature_mf);
+      if (use_cellwise_inverse)
+        quadratures.push_back(QGauss<dim>(dof.get_fe().degree + 1));
+      matrix_free->reinit(mapping,
+                          std::vector<const DoFHandler<dim, spacedim> *>{&dof},
+                          std::vector<const AffineConstraints<Number> *>{
+                            &constraints},
+                          quadratures,
+                          additional_data);
+
+      if (use_cellwise_inverse)
+        {
+          bool all_cells_affine = true;
+          for (unsigned int cell = 0; cell < matrix_free->n_cell_batches();
+               ++cell)
+            if (matrix_free->get_mapping_info().get_cell_type(cell) >
+                dealii::internal::MatrixFreeFunctions::affine)
+              {
+                all_cells_affine = false;
+                break;
+              }
+          use_cellwise_inverse =
+            Utilities::MPI::min(int(all_cells_affine),
+                                dof.get_communicator()) == 1;
+        }
+
+      LinearAlgebra::distributed::Vector<Number> rhs, inhomogeneities;
+      matrix_free->initialize_dof_vector(work_result);
+      matrix_free->initialize_dof_vector(rhs);
+      matrix_free->initialize_dof_vector(inhomogeneities);
+
+      if (use_cellwise_inverse)
+        {
+          create_right_hand_side(
+            mapping, dof, quadrature, function, rhs, constraints);
+
+          matrix_free->template cell_loop<
+            LinearAlgebra::distributed::Vector<Number>,
+            LinearAlgebra::distributed::Vector<Number>>(
+            [](const MatrixFree<dim, Number>                    &data,
+               LinearAlgebra::distributed::Vector<Number>       &dst,
+               const LinearAlgebra::distributed::Vector<Number> &src,
+               const std::pair<unsigned int, unsigned int>      &cell_range) {
+              FEEvaluation<dim, -1, 0, components, Number> phi(data, 0, 1);
+              MatrixFreeOperators::
+                CellwiseInverseMassMatrix<dim, -1, components, Number>
+                  inverse_mass(phi);
+              for (unsigned int cell = cell_range.first;
+                   cell < cell_range.second;
+                   ++cell)
+                {
+                  phi.reinit(cell);
+                  phi.read_dof_values(src);
+                  inverse_mass.apply(phi.begin_dof_values(),
+                                     phi.begin_dof_values());
+                  phi.set_dof_values(dst);
+                }
+            },
+            work_result,
+            rhs);
+          return;
+        }
+
       using MatrixType = MatrixFreeOperators::MassOperator<
         dim,
         -1,
@@ -273,10 +351,6 @@ namespace VectorTools
       else
         mass_matrix.compute_diagonal();
 
-      LinearAlgebra::distributed::Vector<Number> rhs, inhomogeneities;
-      matrix_free->initialize_dof_vector(work_result);
-      matrix_free->initialize_dof_vector(rhs);
-      matrix_free->initialize_dof_vector(inhomogeneities);
       constraints.distribute(inhomogeneities);
       inhomogeneities *= -1.;
 
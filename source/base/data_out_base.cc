@@ -230,6 +230,44 @@ namespace
   }
 
 
+  /**
+   * Round all elements of the given array to the given number of significant
+   * bits (including the implicit leading bit of the mantissa), to nearest. A
+   * value of 24 leaves the array unchanged. Infinite values and NaNs are not
+   * modified, and values that would overflow are truncated instead.
+   */
+  void
+  round_to_significant_bits(std::vector<float> &data,
+                            const unsigned int  n_significant_bits)
+  {
+    AssertIndexRange(n_significant_bits - 1, 24);
+    if (n_significant_bits >= 24)
+      return;
+
+    static_assert(sizeof(float) == sizeof(std::uint32_t),
+                  "This function assumes 32-bit floating point numbers.");
+    const unsigned int  n_dropped_bits = 24 - n_significant_bits;
+    const std::uint32_t dropped_mask =
+      (std::uint32_t(1) << n_dropped_bits) - 1;
+    const std::uint32_t exponent_mask = 0x7f800000;
+
+    for (float &value : data)
+      {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(float));
+        if ((bits & exponent_mask) == exponent_mask)
+          continue;
+
+        std::uint32_t rounded =
+          (bits + (std::uint32_t(1) << (n_dropped_bits - 1))) & ~dropped_mask;
+        if ((rounded & exponent_mask) == exponent_mask)
+          rounded = bits & ~dropped_mask;
+        std::memcpy(&value, &rounded, sizeof(float));
+      }
+  }
+
+
+
   /**
    * The header in binary format that the parallel intermediate files
    * start with.
@@ -2425,14 +2463,18 @@ namespace DataOutBase
                      const bool             print_date_and_time,
                      const CompressionLevel compression_level,
                      const bool             write_higher_order_cells,
-                     const std::map<std::string, std::string> &physical_units)
+                     const std::map<std::string, std::string> &physical_units,
+                     const unsigned int n_significant_bits)
     : time(time)
     , cycle(cycle)
     , print_date_and_time(print_date_and_time)
     , compression_level(compression_level)
     , write_higher_order_cells(write_higher_order_cells)
     , physical_units(physical_units)
-  {}
+    , n_significant_bits(n_significant_bits)
+  {
+    AssertIndexRange(n_significant_bits - 1, 24);
+  }
 
 
 
@@ -5985,6 +6027,7 @@ namespace DataOutBase
               }
           } // loop over nodes
 
+        round_to_significant_bits(data, flags.n_significant_bits);
         o << vtu_stringize_array(data,
                                  flags.compression_level,
                                  output_precision);
@@ -6012,8 +6055,9 @@ namespace DataOutBase
 
         o << ">\n";
 
-        const std::vector<float> data(data_vectors[data_set].begin(),
-                                      data_vectors[data_set].end());
+        std::vector<float> data(data_vectors[data_set].begin(),
+                                data_vectors[data_set].end());
+        round_to_significant_bits(data, flags.n_significant_bits);
         o << vtu_stringize_array(data,
                                  flags.compression_level,
                                  output_precision);
@@ -7965,6 +8009,21 @@ DataOutInterface<dim, spacedim>::write_deal_II_intermediate_in_parallel(
 
 
 
+namespace
+{
+  /**
+   * Return the name of the group in an HDF5 file that holds the data of the
+   * given time step, see DataOutBase::write_hdf5_time_step().
+   */
+  std::string
+  get_hdf5_time_step_group_name(const unsigned int time_step)
+  {
+    return "step_" + Utilities::int_to_string(time_step, 6);
+  }
+} // namespace
+
+
+
 template <int dim, int spacedim>
 XDMFEntry
 DataOutInterface<dim, spacedim>::create_xdmf_entry(
@@ -8118,6 +8177,23 @@ DataOutInterface<dim, spacedim>::create_xdmf_entry(
 #endif
 }
 
+template <int dim, int spacedim>
+XDMFEntry
+DataOutInterface<dim, spacedim>::create_xdmf_time_step_entry(
+  const DataOutBase::DataOutFilter &data_filter,
+  const std::string                &h5_filename,
+  const unsigned int                time_step,
+  const double                      cur_time,
+  const MPI_Comm                    comm) const
+{
+  XDMFEntry entry =
+    create_xdmf_entry(data_filter, h5_filename, h5_filename, cur_time, comm);
+  entry.set_solution_group(get_hdf5_time_step_group_name(time_step));
+  return entry;
+}
+
+
+
 template <int dim, int spacedim>
 void
 DataOutInterface<dim, spacedim>::write_xdmf_file(
@@ -8179,7 +8255,63 @@ namespace
 {
 #ifdef DEAL_II_WITH_HDF5
   /**
-   * Helper function to actually perform the HDF5 output.
+   * Return the dimensions of the chunks in which a two-dimensional data set
+   * of the given dimensions is stored. Chunks consist of complete rows and
+   * hold at most about one megabyte, so that the size of a chunk stays well
+   * below the limit imposed by HDF5 also for very large data sets, and so
+   * that each process only touches few chunks when writing its part of the
+   * data collectively.
+   */
+  std::array<hsize_t, 2>
+  get_chunk_dimensions(const hsize_t dimensions[2])
+  {
+    const hsize_t max_chunk_size = hsize_t(1) << 17;
+    const hsize_t n_rows =
+      std::max<hsize_t>(1,
+                        std::min<hsize_t>(dimensions[0],
+                                          max_chunk_size /
+                                            std::max<hsize_t>(1,
+                                                              dimensions[1])));
+    return {{n_rows, dimensions[1]}};
+  }
+
+
+
+  /**
+   * Set the layout of a two-dimensional data set of the given dimensions in
+   * the data set creation property list @p dataset_property_list: the data
+   * set is stored in chunks, which are compressed if deal.II was configured
+   * with zlib. Empty data sets are stored contiguously, since HDF5 does not
+   * allow chunks that are larger than the data set.
+   */
+  void
+  set_dataset_layout(const hid_t                         dataset_property_list,
+                     const hsize_t                       dimensions[2],
+                     const DataOutBase::CompressionLevel compression_level)
+  {
+    if (dimensions[0] == 0 || dimensions[1] == 0)
+      return;
+
+    herr_t status = H5Pset_chunk(dataset_property_list,
+                                 2,
+                                 get_chunk_dimensions(dimensions).data());
+    AssertThrow(status >= 0, ExcIO());
+#  ifdef DEAL_II_WITH_ZLIB
+    status = H5Pset_deflate(dataset_property_list,
+                            get_zlib_compression_level(compression_level));
+    AssertThrow(status >= 0, ExcIO());
+#  else
+    (void)compression_level;
+#  endif
+  }
+
+
+
+  /**
+   * Helper function to actually perform the HDF5 output. If @p solution_group
+   * is not empty, the data sets are written into a group of this name. In
+   * that case, the solution file is opened and extended instead of being
+   * created if @p write_mesh_file is false.
    */
   template <int dim, int spacedim>
   void
@@ -8189,6 +8321,7 @@ namespace
                 const bool                        write_mesh_file,
                 const std::string                &mesh_filename,
                 const std::string                &solution_filename,
+                const std::string                &solution_group,
                 const MPI_Comm                    comm)
   {
     hid_t h5_mesh_file_id = -1, h5_solution_file_id, file_plist_id, plist_id;
@@ -8292,11 +8425,9 @@ namespace
                                  H5P_DEFAULT);
 #  else
         node_dataset_id = H5Pcreate(H5P_DATASET_CREATE);
-#    ifdef DEAL_II_WITH_ZLIB
-        H5Pset_deflate(node_dataset_id,
-                       get_zlib_compression_level(flags.compression_level));
-        H5Pset_chunk(node_dataset_id, 2, node_ds_dim);
-#    endif
+        set_dataset_layout(node_dataset_id,
+                           node_ds_dim,
+                           flags.compression_level);
         node_dataset = H5Dcreate(h5_mesh_file_id,
                                  "nodes",
                                  H5T_NATIVE_DOUBLE,
@@ -8315,11 +8446,9 @@ namespace
                                  H5P_DEFAULT);
 #  else
         node_dataset_id = H5Pcreate(H5P_DATASET_CREATE);
-#    ifdef DEAL_II_WITH_ZLIB
-        H5Pset_deflate(node_dataset_id,
-                       get_zlib_compression_level(flags.compression_level));
-        H5Pset_chunk(node_dataset_id, 2, cell_ds_dim);
-#    endif
+        set_dataset_layout(node_dataset_id,
+                           cell_ds_dim,
+                           flags.compression_level);
         cell_dataset = H5Dcreate(h5_mesh_file_id,
                                  "cells",
                                  H5T_NATIVE_UINT,
@@ -8422,6 +8551,14 @@ namespace
       {
         h5_solution_file_id = h5_mesh_file_id;
       }
+    else if (!solution_group.empty())
+      {
+        // The data is added to an existing file, which already holds the
+        // mesh and the data sets written previously
+        h5_solution_file_id =
+          H5Fopen(solution_filename.c_str(), H5F_ACC_RDWR, file_plist_id);
+        AssertThrow(h5_solution_file_id >= 0, ExcIO());
+      }
     else
       {
         // Otherwise we need to open a new file
@@ -8432,6 +8569,27 @@ namespace
         AssertThrow(h5_solution_file_id >= 0, ExcIO());
       }
 
+    // Create the group the data sets are written to, if requested
+    hid_t h5_solution_group_id = h5_solution_file_id;
+    if (!solution_group.empty())
+      {
+#  if H5Gcreate_vers == 1
+        h5_solution_group_id =
+          H5Gcreate(h5_solution_file_id, solution_group.c_str(), 0);
+#  else
+        h5_solution_group_id = H5Gcreate(h5_solution_file_id,
+                                         solution_group.c_str(),
+                                         H5P_DEFAULT,
+                                         H5P_DEFAULT,
+                                         H5P_DEFAULT);
+#  endif
+        AssertThrow(h5_solution_group_id >= 0,
+                    ExcMessage("The group <" + solution_group +
+                               "> could not be created in the HDF5 file <" +
+                               solution_filename +
+                               ">. Maybe it has been written before?"));
+      }
+
     // when writing, first write out all vector data, then handle the scalar
     // data sets that have been left over
     unsigned int i;
@@ -8450,19 +8608,17 @@ namespace
         AssertThrow(pt_data_dataspace >= 0, ExcIO());
 
 #  if H5Gcreate_vers == 1
-        pt_data_dataset = H5Dcreate(h5_solution_file_id,
+        pt_data_dataset = H5Dcreate(h5_solution_group_id,
                                     vector_name.c_str(),
                                     H5T_NATIVE_DOUBLE,
                                     pt_data_dataspace,
                                     H5P_DEFAULT);
 #  else
         node_dataset_id = H5Pcreate(H5P_DATASET_CREATE);
-#    ifdef DEAL_II_WITH_ZLIB
-        H5Pset_deflate(node_dataset_id,
-                       get_zlib_compression_level(flags.compression_level));
-        H5Pset_chunk(node_dataset_id, 2, node_ds_dim);
-#    endif
-        pt_data_dataset = H5Dcreate(h5_solution_file_id,
+        set_dataset_layout(node_dataset_id,
+                           node_ds_dim,
+                           flags.compression_level);
+        pt_data_dataset = H5Dcreate(h5_solution_group_id,
                                     vector_name.c_str(),
                                     H5T_NATIVE_DOUBLE,
                                     pt_data_dataspace,
@@ -8513,6 +8669,13 @@ namespace
         AssertThrow(status >= 0, ExcIO());
       }
 
+    // Close the group
+    if (!solution_group.empty())
+      {
+        status = H5Gclose(h5_solution_group_id);
+        AssertThrow(status >= 0, ExcIO());
+      }
+
     // Close the file property list
     status = H5Pclose(file_plist_id);
     AssertThrow(status >= 0, ExcIO());
@@ -8526,6 +8689,97 @@ namespace
     AssertThrow(status >= 0, ExcIO());
   }
 #endif
+
+
+
+  /**
+   * Write the data in @p data_filter to HDF5 file(s) on all processes that
+   * have patches. See do_write_hdf5() for the meaning of the arguments.
+   */
+  template <int dim, int spacedim>
+  void
+  write_hdf5_in_group(
+    const std::vector<DataOutBase::Patch<dim, spacedim>> &patches,
+    const DataOutBase::DataOutFilter                     &data_filter,
+    const DataOutBase::Hdf5Flags                         &flags,
+    const bool                                            write_mesh_file,
+    const std::string                                    &mesh_filename,
+    const std::string                                    &solution_filename,
+    const std::string                                    &solution_group,
+    const MPI_Comm                                        comm)
+  {
+    AssertThrow(
+      spacedim >= 2,
+      ExcMessage(
+        "DataOutBase was asked to write HDF5 output for a space dimension of "
+        "1. HDF5 only supports datasets that live in 2 or 3 dimensions."));
+
+#ifndef DEAL_II_WITH_HDF5
+    // throw an exception, but first make sure the compiler does not warn
+    // about the now unused function arguments
+    (void)patches;
+    (void)data_filter;
+    (void)flags;
+    (void)write_mesh_file;
+    (void)mesh_filename;
+    (void)solution_filename;
+    (void)solution_group;
+    (void)comm;
+    AssertThrow(false, ExcNeedsHDF5());
+#else
+
+    const unsigned int n_ranks = Utilities::MPI::n_mpi_processes(comm);
+    (void)n_ranks;
+
+    // If HDF5 is not parallel and we're using multiple processes, abort:
+#  ifndef H5_HAVE_PARALLEL
+    AssertThrow(
+      n_ranks <= 1,
+      ExcMessage(
+        "Serial HDF5 output on multiple processes is not yet supported."));
+#  endif
+
+    // Verify that there are indeed patches to be written out. most of
+    // the times, people just forget to call build_patches when there
+    // are no patches, so a warning is in order. That said, the
+    // assertion is disabled if we run with more than one MPI rank,
+    // since then it can happen that, on coarse meshes, a processor
+    // simply has no cells it actually owns, and in that case it is
+    // legit if there are no patches.
+    Assert((patches.size() > 0) || (n_ranks > 1),
+           DataOutBase::ExcNoPatches());
+
+    // The HDF5 routines perform a bunch of collective calls that expect all
+    // ranks to participate. One ranks without any patches we are missing
+    // critical information, so rather than broadcasting that information,
+    // just create a new communicator that only contains ranks with cells and
+    // use that to perform the write operations:
+    const bool have_patches = (patches.size() > 0);
+    MPI_Comm   split_comm;
+    {
+      const int key   = Utilities::MPI::this_mpi_process(comm);
+      const int color = (have_patches ? 1 : 0);
+      const int ierr  = MPI_Comm_split(comm, color, key, &split_comm);
+      AssertThrowMPI(ierr);
+    }
+
+    if (have_patches)
+      {
+        do_write_hdf5<dim, spacedim>(patches,
+                                     data_filter,
+                                     flags,
+                                     write_mesh_file,
+                                     mesh_filename,
+                                     solution_filename,
+                                     solution_group,
+                                     split_comm);
+      }
+
+    const int ierr = MPI_Comm_free(&split_comm);
+    AssertThrowMPI(ierr);
+
+#endif
+  }
 } // namespace
 
 
@@ -8686,6 +8940,20 @@ DataOutInterface<dim, spacedim>::write_hdf5_parallel(
 
 
 
+template <int dim, int spacedim>
+void
+DataOutInterface<dim, spacedim>::write_hdf5_time_step(
+  const DataOutBase::DataOutFilter &data_filter,
+  const std::string                &filename,
+  const unsigned int                time_step,
+  const MPI_Comm                    comm) const
+{
+  DataOutBase::write_hdf5_time_step(
+    get_patches(), data_filter, hdf5_flags, filename, time_step, comm);
+}
+
+
+
 template <int dim, int spacedim>
 void
 DataOutBase::write_hdf5_parallel(
@@ -8712,74 +8980,36 @@ DataOutBase::write_hdf5_parallel(
   const std::string                       &solution_filename,
   const MPI_Comm                           comm)
 {
-  AssertThrow(
-    spacedim >= 2,
-    ExcMessage(
-      "DataOutBase was asked to write HDF5 output for a space dimension of 1. "
-      "HDF5 only supports datasets that live in 2 or 3 dimensions."));
-
-#ifndef DEAL_II_WITH_HDF5
-  // throw an exception, but first make sure the compiler does not warn about
-  // the now unused function arguments
-  (void)patches;
-  (void)data_filter;
-  (void)flags;
-  (void)write_mesh_file;
-  (void)mesh_filename;
-  (void)solution_filename;
-  (void)comm;
-  AssertThrow(false, ExcNeedsHDF5());
-#else
-
-  const unsigned int n_ranks = Utilities::MPI::n_mpi_processes(comm);
-  (void)n_ranks;
-
-  // If HDF5 is not parallel and we're using multiple processes, abort:
-#  ifndef H5_HAVE_PARALLEL
-  AssertThrow(
-    n_ranks <= 1,
-    ExcMessage(
-      "Serial HDF5 output on multiple processes is not yet supported."));
-#  endif
-
-  // Verify that there are indeed patches to be written out. most of
-  // the times, people just forget to call build_patches when there
-  // are no patches, so a warning is in order. That said, the
-  // assertion is disabled if we run with more than one MPI rank,
-  // since then it can happen that, on coarse meshes, a processor
-  // simply has no cells it actually owns, and in that case it is
-  // legit if there are no patches.
-  Assert((patches.size() > 0) || (n_ranks > 1), ExcNoPatches());
-
-  // The HDF5 routines perform a bunch of collective calls that expect all
-  // ranks to participate. One ranks without any patches we are missing
-  // critical information, so rather than broadcasting that information, just
-  // create a new communicator that only contains ranks with cells and
-  // use that to perform the write operations:
-  const bool have_patches = (patches.size() > 0);
-  MPI_Comm   split_comm;
-  {
-    const int key   = Utilities::MPI::this_mpi_process(comm);
-    const int color = (have_patches ? 1 : 0);
-    const int ierr  = MPI_Comm_split(comm, color, key, &split_comm);
-    AssertThrowMPI(ierr);
-  }
+  write_hdf5_in_group(patches,
+                      data_filter,
+                      flags,
+                      write_mesh_file,
+                      mesh_filename,
+                      solution_filename,
+                      "",
+                      comm);
+}
 
-  if (have_patches)
-    {
-      do_write_hdf5<dim, spacedim>(patches,
-                                   data_filter,
-                                   flags,
-                                   write_mesh_file,
-                                   mesh_filename,
-                                   solution_filename,
-                                   split_comm);
-    }
 
-  const int ierr = MPI_Comm_free(&split_comm);
-  AssertThrowMPI(ierr);
 
-#endif
+template <int dim, int spacedim>
+void
+DataOutBase::write_hdf5_time_step(
+  const std::vector<Patch<dim, spacedim>> &patches,
+  const DataOutBase::DataOutFilter        &data_filter,
+  const DataOutBase::Hdf5Flags            &flags,
+  const std::string                       &filename,
+  const unsigned int                       time_step,
+  const MPI_Comm                           comm)
+{
+  write_hdf5_in_group(patches,
+                      data_filter,
+                      flags,
+                      time_step == 0,
+                      filename,
+                      filename,
+                      get_hdf5_time_step_group_name(time_step),
+                      comm);
 }
 
 
@@ -9536,6 +9766,14 @@ XDMFEntry::add_attribute(const std::string &attr_name,
 
 
 
+void
+XDMFEntry::set_solution_group(const std::string &group_name)
+{
+  h5_sol_group = group_name;
+}
+
+
+
 namespace
 {
   /**
@@ -9667,8 +9905,10 @@ XDMFEntry::get_xdmf_content(const unsigned int indent_level) const
       ss << indent(indent_level + 2) << "<DataItem Dimensions=\"" << num_nodes
          << " " << (attribute_dim.second > 1 ? 3 : 1)
          << "\" NumberType=\"Float\" Precision=\"8\" Format=\"HDF\">\n";
-      ss << indent(indent_level + 3) << h5_sol_filename << ":/"
-         << attribute_dim.first << '\n';
+      ss << indent(indent_level + 3) << h5_sol_filename << ":/";
+      if (!h5_sol_group.empty())
+        ss << h5_sol_group << '/';
+      ss << attribute_dim.first << '\n';
       ss << indent(indent_level + 2) << "</DataItem>\n";
       ss << indent(indent_level + 1) << "</Attribute>\n";
     }
@@ -16,9 +16,11 @@
 #include <deal.II/base/index_set.h>
 #include <deal.II/base/memory_consumption.h>
 #include <deal.II/base/mpi.h>
+#include <deal.II/base/parallel.h>
 
 #include <deal.II/lac/exceptions.h>
 
+#include <bitset>
 #include <vector>
 
 #ifdef DEAL_II_WITH_TRILINOS
@@ -36,6 +38,57 @@ DEAL_II_NAMESPACE_OPEN
 
 
 
+namespace
+{
+  /**
+   * Split the given (sorted) @p ranges of an index set into chunks, let
+   * @p process_chunk compute the ranges of the result of a set operation
+   * that stem from each chunk, and return the concatenation of these ranges.
+   * The chunks are processed in parallel if there are more than one, which
+   * is the case for index sets with many ranges.
+   */
+  template <typename RangeType, typename Function>
+  std::vector<RangeType>
+  process_ranges_in_chunks(const std::vector<RangeType> &ranges,
+                           const Function               &process_chunk)
+  {
+    constexpr std::size_t n_ranges_per_chunk = 4096;
+    const std::size_t     n_chunks =
+      (ranges.size() + n_ranges_per_chunk - 1) / n_ranges_per_chunk;
+
+    if (n_chunks <= 1)
+      {
+        std::vector<RangeType> result;
+        process_chunk(ranges.begin(), ranges.end(), result);
+        return result;
+      }
+
+    std::vector<std::vector<RangeType>> chunk_results(n_chunks);
+    parallel::apply_to_subranges(
+      std::size_t(0),
+      n_chunks,
+      [&](const std::size_t chunk_begin, const std::size_t chunk_end) {
+        for (std::size_t c = chunk_begin; c < chunk_end; ++c)
+          process_chunk(ranges.begin() + c * n_ranges_per_chunk,
+                        ranges.begin() + std::min((c + 1) * n_ranges_per_chunk,
+                                                  ranges.size()),
+                        chunk_results[c]);
+      },
+      1);
+
+    std::size_t n_result_ranges = 0;
+    for (const auto &chunk_result : chunk_results)
+      n_result_ranges += chunk_result.size();
+    std::vector<RangeType> result;
+    result.reserve(n_result_ranges);
+    for (const auto &chunk_result : chunk_results)
+      result.insert(result.end(), chunk_result.begin(), chunk_result.end());
+    return result;
+  }
+} // namespace
+
+
+
 #ifdef DEAL_II_WITH_TRILINOS
 
 #  ifdef DEAL_II_TRILINOS_WITH_TPETRA
@@ -191,6 +244,11 @@ IndexSet::do_compress() const
             largest_range      = i - ranges.begin();
           }
       }
+    setup_bitmap();
+
+    // only mark the set as compressed once the bitmap is complete, since
+    // other threads may query the set without taking the mutex as soon as
+    // they see this flag
     is_compressed = true;
 
     // check that next_index is correct. needs to be after the previous
@@ -218,6 +276,70 @@ IndexSet::do_compress() const
 
 
 
+void
+IndexSet::setup_bitmap() const
+{
+  clear_bitmap();
+
+  // only set up a bitmap for sets with many ranges, and only if it does not
+  // need more memory than the ranges themselves, i.e., if the ranges and the
+  // gaps between them are short
+  if (ranges.size() < 16)
+    return;
+  const size_type start =
+    ranges.front().begin / bits_per_word * bits_per_word;
+  const size_type n_words =
+    (ranges.back().end - start + bits_per_word - 1) / bits_per_word;
+  if (n_words * (sizeof(std::uint64_t) + sizeof(size_type)) >
+      ranges.size() * sizeof(Range))
+    return;
+
+  bitmap_start = start;
+  bitmap.resize(n_words, 0);
+  for (const Range &range : ranges)
+    {
+      // set the bits of the range, filling entire words at once
+      size_type i = range.begin - start;
+      while (i < range.end - start)
+        {
+          const unsigned int bit = i % bits_per_word;
+          const size_type    n_bits =
+            std::min<size_type>(bits_per_word - bit, range.end - start - i);
+          if (n_bits == bits_per_word)
+            bitmap[i / bits_per_word] = ~std::uint64_t(0);
+          else
+            bitmap[i / bits_per_word] |= ((std::uint64_t(1) << n_bits) - 1)
+                                         << bit;
+          i += n_bits;
+        }
+    }
+
+  bitmap_n_preceding.resize(n_words);
+  size_type n_preceding = 0;
+  for (size_type w = 0; w < n_words; ++w)
+    {
+      bitmap_n_preceding[w] = n_preceding;
+      n_preceding += std::bitset<bits_per_word>(bitmap[w]).count();
+    }
+  Assert(n_preceding == ranges.back().nth_index_in_set +
+                          (ranges.back().end - ranges.back().begin),
+         ExcInternalError());
+}
+
+
+
+void
+IndexSet::clear_bitmap() const
+{
+  bitmap.clear();
+  bitmap.shrink_to_fit();
+  bitmap_n_preceding.clear();
+  bitmap_n_preceding.shrink_to_fit();
+  bitmap_start = 0;
+}
+
+
+
 #ifndef DOXYGEN
 IndexSet
 IndexSet::operator&(const IndexSet &is) const
@@ -227,39 +349,57 @@ IndexSet::operator&(const IndexSet &is) const
   compress();
   is.compress();
 
-  std::vector<Range>::const_iterator r1 = ranges.begin(),
-                                     r2 = is.ranges.begin();
-  IndexSet result(size());
-
-  while ((r1 != ranges.end()) && (r2 != is.ranges.end()))
-    {
-      // if r1 and r2 do not overlap at all, then move the pointer that sits
-      // to the left of the other up by one
-      if (r1->end <= r2->begin)
-        ++r1;
-      else if (r2->end <= r1->begin)
-        ++r2;
-      else
+  // intersect chunks of the ranges of this set with the ranges of the other
+  // set independently
+  const auto intersect =
+    [&](const std::vector<Range>::const_iterator &chunk_begin,
+        const std::vector<Range>::const_iterator &chunk_end,
+        std::vector<Range>                       &result_ranges) {
+      if (chunk_begin == chunk_end)
+        return;
+
+      // start with the first range of the other set that ends after the
+      // beginning of the chunk
+      std::vector<Range>::const_iterator r1 = chunk_begin,
+                                         r2 = Utilities::lower_bound(
+                                           is.ranges.begin(),
+                                           is.ranges.end(),
+                                           Range(r1->begin, r1->begin + 1),
+                                           Range::end_compare);
+
+      while ((r1 != chunk_end) && (r2 != is.ranges.end()))
         {
-          // the ranges must overlap somehow
-          Assert(((r1->begin <= r2->begin) && (r1->end > r2->begin)) ||
-                   ((r2->begin <= r1->begin) && (r2->end > r1->begin)),
-                 ExcInternalError());
-
-          // add the overlapping range to the result
-          result.add_range(std::max(r1->begin, r2->begin),
-                           std::min(r1->end, r2->end));
-
-          // now move that iterator that ends earlier one up. note that it has
-          // to be this one because a subsequent range may still have a chance
-          // of overlapping with the range that ends later
-          if (r1->end <= r2->end)
+          // if r1 and r2 do not overlap at all, then move the pointer that
+          // sits to the left of the other up by one
+          if (r1->end <= r2->begin)
             ++r1;
-          else
+          else if (r2->end <= r1->begin)
             ++r2;
+          else
+            {
+              // the ranges must overlap somehow
+              Assert(((r1->begin <= r2->begin) && (r1->end > r2->begin)) ||
+                       ((r2->begin <= r1->begin) && (r2->end > r1->begin)),
+                     ExcInternalError());
+
+              // add the overlapping range to the result
+              result_ranges.emplace_back(std::max(r1->begin, r2->begin),
+                                         std::min(r1->end, r2->end));
+
+              // now move that iterator that ends earlier one up. note that it
+              // has to be this one because a subsequent range may still have
+              // a chance of overlapping with the range that ends later
+              if (r1->end <= r2->end)
+                ++r1;
+              else
+                ++r2;
+            }
         }
-    }
+    };
 
+  IndexSet result(size());
+  result.ranges        = process_ranges_in_chunks(ranges, intersect);
+  result.is_compressed = false;
   result.compress();
   return result;
 }
@@ -472,65 +612,58 @@ IndexSet::subtract_set(const IndexSet &other)
 {
   compress();
   other.compress();
-  is_compressed = false;
-
-
-  // we save all new ranges to our IndexSet in an temporary vector and
-  // add all of them in one go at the end.
-  std::vector<Range> new_ranges;
-
-  std::vector<Range>::iterator own_it   = ranges.begin();
-  std::vector<Range>::iterator other_it = other.ranges.begin();
-
-  while (own_it != ranges.end() && other_it != other.ranges.end())
-    {
-      // advance own iterator until we get an overlap
-      if (own_it->end <= other_it->begin)
-        {
-          new_ranges.push_back(*own_it);
-          ++own_it;
-          continue;
-        }
-      // we are done with other_it, so advance
-      if (own_it->begin >= other_it->end)
-        {
-          ++other_it;
-          continue;
-        }
 
-      // Now own_it and other_it overlap.  First save the part of own_it that
-      // is before other_it (if not empty).
-      if (own_it->begin < other_it->begin)
-        {
-          Range r(own_it->begin, other_it->begin);
-          r.nth_index_in_set = 0; // fix warning of unused variable
-          new_ranges.push_back(r);
-        }
-      // change own_it to the sub range behind other_it. Do not delete own_it
-      // in any case. As removal would invalidate iterators, we just shrink
-      // the range to an empty one.
-      own_it->begin = other_it->end;
-      if (own_it->begin > own_it->end)
+  // remove the ranges of the other set from chunks of the ranges of this set
+  // independently
+  const auto subtract =
+    [&](const std::vector<Range>::const_iterator &chunk_begin,
+        const std::vector<Range>::const_iterator &chunk_end,
+        std::vector<Range>                       &result_ranges) {
+      if (chunk_begin == chunk_end)
+        return;
+
+      // start with the first range of the other set that ends after the
+      // beginning of the chunk
+      std::vector<Range>::const_iterator other_it =
+        Utilities::lower_bound(other.ranges.begin(),
+                               other.ranges.end(),
+                               Range(chunk_begin->begin,
+                                     chunk_begin->begin + 1),
+                               Range::end_compare);
+
+      for (std::vector<Range>::const_iterator own_it = chunk_begin;
+           own_it != chunk_end;
+           ++own_it)
         {
-          own_it->begin = own_it->end;
-          ++own_it;
+          // skip the ranges of the other set that end before the current
+          // range
+          while (other_it != other.ranges.end() &&
+                 other_it->end <= own_it->begin)
+            ++other_it;
+
+          // save the parts of the current range between the overlapping
+          // ranges of the other set
+          size_type begin = own_it->begin;
+          while (other_it != other.ranges.end() &&
+                 other_it->begin < own_it->end)
+            {
+              if (begin < other_it->begin)
+                result_ranges.emplace_back(begin, other_it->begin);
+              begin = std::max(begin, other_it->end);
+
+              // a range of the other set that extends beyond the current
+              // range may also overlap with the next one
+              if (other_it->end > own_it->end)
+                break;
+              ++other_it;
+            }
+          if (begin < own_it->end)
+            result_ranges.emplace_back(begin, own_it->end);
         }
+    };
 
-      // continue without advancing iterators, the right one will be advanced
-      // next.
-    }
-
-  // make sure to take over the remaining ranges
-  for (; own_it != ranges.end(); ++own_it)
-    new_ranges.push_back(*own_it);
-
-  ranges.clear();
-
-  // done, now add the temporary ranges
-  const std::vector<Range>::iterator end = new_ranges.end();
-  for (std::vector<Range>::iterator it = new_ranges.begin(); it != end; ++it)
-    add_range(it->begin, it->end);
-
+  ranges        = process_ranges_in_chunks(ranges, subtract);
+  is_compressed = false;
   compress();
 }
 
@@ -561,6 +694,9 @@ IndexSet::pop_back()
   if (ranges.back().begin == ranges.back().end)
     ranges.pop_back();
 
+  // the ranges stay compressed, but the bitmap would be out of date
+  clear_bitmap();
+
   return index;
 }
 
@@ -660,38 +796,42 @@ IndexSet::add_indices(const IndexSet &other, const size_type offset)
   compress();
   other.compress();
 
-  std::vector<Range>::const_iterator r1 = ranges.begin(),
-                                     r2 = other.ranges.begin();
-
-  std::vector<Range> new_ranges;
-  // just get the start and end of the ranges right in this method, everything
-  // else will be done in compress()
-  while (r1 != ranges.end() || r2 != other.ranges.end())
-    {
-      // the two ranges do not overlap or we are at the end of one of the
-      // ranges
-      if (r2 == other.ranges.end() ||
-          (r1 != ranges.end() && r1->end < (r2->begin + offset)))
-        {
-          new_ranges.push_back(*r1);
-          ++r1;
-        }
-      else if (r1 == ranges.end() || (r2->end + offset) < r1->begin)
-        {
-          new_ranges.emplace_back(r2->begin + offset, r2->end + offset);
-          ++r2;
-        }
-      else
-        {
-          // ok, we do overlap, so just take the combination of the current
-          // range (do not bother to merge with subsequent ranges)
-          Range next(std::min(r1->begin, r2->begin + offset),
-                     std::max(r1->end, r2->end + offset));
-          new_ranges.push_back(next);
-          ++r1;
-          ++r2;
-        }
-    }
+  // merge chunks of the ranges of this set with the (shifted) ranges of the
+  // other set that fall into the part of the index space between the first
+  // range of the chunk and the first range of the next chunk. just get the
+  // start and end of the ranges right here, everything else will be done in
+  // compress()
+  const auto merge =
+    [&](const std::vector<Range>::const_iterator &chunk_begin,
+        const std::vector<Range>::const_iterator &chunk_end,
+        std::vector<Range>                       &result_ranges) {
+      const size_type index_begin =
+        (chunk_begin == ranges.begin()) ? 0 : chunk_begin->begin;
+      const size_type index_end =
+        (chunk_end == ranges.end()) ? numbers::invalid_dof_index :
+                                      chunk_end->begin;
+
+      std::vector<Range> other_ranges;
+      for (auto r = std::partition_point(other.ranges.begin(),
+                                         other.ranges.end(),
+                                         [&](const Range &range) {
+                                           return range.end + offset <=
+                                                  index_begin;
+                                         });
+           r != other.ranges.end() && r->begin + offset < index_end;
+           ++r)
+        other_ranges.emplace_back(std::max(r->begin + offset, index_begin),
+                                  std::min(r->end + offset, index_end));
+
+      result_ranges.resize((chunk_end - chunk_begin) + other_ranges.size());
+      std::merge(chunk_begin,
+                 chunk_end,
+                 other_ranges.begin(),
+                 other_ranges.end(),
+                 result_ranges.begin());
+    };
+
+  std::vector<Range> new_ranges = process_ranges_in_chunks(ranges, merge);
   ranges.swap(new_ranges);
 
   is_compressed = false;
@@ -798,6 +938,15 @@ IndexSet::block_read(std::istream &in)
 bool
 IndexSet::is_element_binary_search(const size_type index) const
 {
+  if (bitmap.empty() == false)
+    {
+      if (index < bitmap_start)
+        return false;
+      const size_type word = (index - bitmap_start) / bits_per_word;
+      const size_type bit  = (index - bitmap_start) % bits_per_word;
+      return word < bitmap.size() && ((bitmap[word] >> bit) & 1U) != 0;
+    }
+
   // get the element after which we would have to insert a range that
   // consists of all elements from this element to the end of the index
   // range plus one. after this call we know that if p!=end() then
@@ -851,6 +1000,22 @@ IndexSet::nth_index_in_set_binary_search(const size_type n) const
 IndexSet::size_type
 IndexSet::index_within_set_binary_search(const size_type n) const
 {
+  if (bitmap.empty() == false)
+    {
+      if (n < bitmap_start)
+        return numbers::invalid_dof_index;
+      const size_type word = (n - bitmap_start) / bits_per_word;
+      const size_type bit  = (n - bitmap_start) % bits_per_word;
+      if (word >= bitmap.size() || ((bitmap[word] >> bit) & 1U) == 0)
+        return numbers::invalid_dof_index;
+
+      // count the elements before n within its word
+      const std::uint64_t preceding_bits =
+        bitmap[word] & ((std::uint64_t(1) << bit) - 1);
+      return bitmap_n_preceding[word] +
+             std::bitset<bits_per_word>(preceding_bits).count();
+    }
+
   // we could try to use the main range for splitting up the search range, but
   // since we only come here when the largest range did not contain the index,
   // there is little gain from doing a first step manually.
@@ -870,6 +1035,57 @@ IndexSet::index_within_set_binary_search(const size_type n) const
 
 
 
+void
+IndexSet::index_within_set(const std::vector<size_type> &global_indices,
+                           std::vector<size_type>       &local_indices) const
+{
+  // to make this call thread-safe, compress() must not be called through this
+  // function
+  Assert(is_compressed == true, ExcMessage("IndexSet must be compressed."));
+  local_indices.resize(global_indices.size());
+
+  // with a bitmap, each query takes constant time anyway
+  if (bitmap.empty() == false)
+    {
+      for (std::size_t i = 0; i < global_indices.size(); ++i)
+        local_indices[i] = index_within_set(global_indices[i]);
+      return;
+    }
+
+  // keep track of the first range that ends after the current index. for
+  // sorted indices, this is either the range found for the previous index or
+  // the next one, unless there is a gap in the indices, so that we only need
+  // to resort to a binary search for gaps and for unsorted indices
+  std::vector<Range>::const_iterator p = ranges.begin();
+  for (std::size_t i = 0; i < global_indices.size(); ++i)
+    {
+      const size_type n = global_indices[i];
+      AssertIndexRange(n, size());
+
+      if (p != ranges.end() && p->end <= n)
+        {
+          ++p;
+          if (p != ranges.end() && p->end <= n)
+            p = Utilities::lower_bound(p,
+                                       ranges.cend(),
+                                       Range(n, n + 1),
+                                       Range::end_compare);
+        }
+      else if (p != ranges.begin() && (p - 1)->end > n)
+        p = Utilities::lower_bound(ranges.cbegin(),
+                                   p,
+                                   Range(n, n + 1),
+                                   Range::end_compare);
+
+      if (p != ranges.end() && p->begin <= n)
+        local_indices[i] = (n - p->begin) + p->nth_index_in_set;
+      else
+        local_indices[i] = numbers::invalid_dof_index;
+    }
+}
+
+
+
 IndexSet::ElementIterator
 IndexSet::at(const size_type global_index) const
 {
@@ -1194,6 +1410,8 @@ IndexSet::memory_consumption() const
   return (MemoryConsumption::memory_consumption(ranges) +
           MemoryConsumption::memory_consumption(is_compressed) +
           MemoryConsumption::memory_consumption(index_space_size) +
+          MemoryConsumption::memory_consumption(bitmap) +
+          MemoryConsumption::memory_consumption(bitmap_n_preceding) +
           sizeof(compress_mutex));
 }
 
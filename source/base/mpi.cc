@@ -36,6 +36,8 @@
 
 #include <iostream>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <numeric>
 #include <set>
 #include <vector>
@@ -230,6 +232,105 @@ namespace Utilities
 
 
 
+    namespace
+    {
+      /**
+       * The MPI attribute key under which get_node_topology() caches the
+       * NodeTopology of a communicator.
+       */
+      int node_topology_keyval = MPI_KEYVAL_INVALID;
+
+      /**
+       * Callback invoked by MPI when a communicator with a cached
+       * NodeTopology is freed.
+       */
+      int
+      delete_node_topology(MPI_Comm /*communicator*/,
+                           int /*keyval*/,
+                           void *attribute_value,
+                           void * /*extra_state*/)
+      {
+        NodeTopology *topology = static_cast<NodeTopology *>(attribute_value);
+        if (topology->leader_communicator != MPI_COMM_NULL)
+          MPI_Comm_free(&topology->leader_communicator);
+        MPI_Comm_free(&topology->node_communicator);
+        delete topology;
+        return MPI_SUCCESS;
+      }
+    } // namespace
+
+
+
+    const NodeTopology &
+    get_node_topology(const MPI_Comm mpi_communicator)
+    {
+      if (job_supports_mpi() == false)
+        {
+          static const NodeTopology serial_topology{
+            MPI_COMM_SELF, MPI_COMM_SELF, MPI_COMM_SELF, 1, false};
+          return serial_topology;
+        }
+
+      static std::mutex           mutex;
+      std::lock_guard<std::mutex> lock(mutex);
+
+      int ierr;
+      if (node_topology_keyval == MPI_KEYVAL_INVALID)
+        {
+          ierr = MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN,
+                                        &delete_node_topology,
+                                        &node_topology_keyval,
+                                        nullptr);
+          AssertThrowMPI(ierr);
+        }
+
+      void *attribute_value = nullptr;
+      int   flag            = 0;
+      ierr                  = MPI_Comm_get_attr(mpi_communicator,
+                               node_topology_keyval,
+                               &attribute_value,
+                               &flag);
+      AssertThrowMPI(ierr);
+      if (flag != 0)
+        return *static_cast<const NodeTopology *>(attribute_value);
+
+      // set up the sub-communicators: the processes within a node, and the
+      // first process of each node
+      const int rank     = this_mpi_process(mpi_communicator);
+      auto      topology = std::make_unique<NodeTopology>();
+
+      topology->communicator = mpi_communicator;
+
+      ierr = MPI_Comm_split_type(mpi_communicator,
+                                 MPI_COMM_TYPE_SHARED,
+                                 rank,
+                                 MPI_INFO_NULL,
+                                 &topology->node_communicator);
+      AssertThrowMPI(ierr);
+
+      const bool is_leader =
+        this_mpi_process(topology->node_communicator) == 0;
+      ierr = MPI_Comm_split(mpi_communicator,
+                            is_leader ? 0 : MPI_UNDEFINED,
+                            rank,
+                            &topology->leader_communicator);
+      AssertThrowMPI(ierr);
+
+      topology->n_nodes = sum(is_leader ? 1U : 0U, mpi_communicator);
+      topology->use_hierarchical_reductions =
+        topology->n_nodes > 1 &&
+        topology->n_nodes < n_mpi_processes(mpi_communicator);
+
+      ierr = MPI_Comm_set_attr(mpi_communicator,
+                               node_topology_keyval,
+                               topology.get());
+      AssertThrowMPI(ierr);
+
+      return *topology.release();
+    }
+
+
+
     std::vector<IndexSet>
     create_ascending_partitioning(
       const MPI_Comm                comm,
@@ -716,6 +817,18 @@ namespace Utilities
 
 
 
+    const NodeTopology &
+    get_node_topology(const MPI_Comm /*mpi_communicator*/)
+    {
+      static const NodeTopology serial_topology{MPI_COMM_SELF,
+                                                MPI_COMM_SELF,
+                                                1,
+                                                false};
+      return serial_topology;
+    }
+
+
+
     void
     min_max_avg(const ArrayView<const double> &my_values,
                 const ArrayView<MinMaxAvg>    &result,
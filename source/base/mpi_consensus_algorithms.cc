@@ -0,0 +1,270 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/mpi_consensus_algorithms.h>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+namespace Utilities
+{
+  namespace MPI
+  {
+    namespace ConsensusAlgorithms
+    {
+      double
+      NeighborGraphCache::Statistics::estimated_time_saved() const
+      {
+        if (n_setups == 0 || n_reuses == 0)
+          return 0.;
+
+        return n_reuses * (setup_time / n_setups - reuse_time / n_reuses);
+      }
+
+
+
+      NeighborGraphCache::NeighborGraphCache()
+        : communicator(MPI_COMM_NULL)
+        , graph_communicator(MPI_COMM_NULL)
+      {}
+
+
+
+      NeighborGraphCache::~NeighborGraphCache()
+      {
+        clear();
+      }
+
+
+
+      bool
+      NeighborGraphCache::is_up_to_date(
+        const std::vector<unsigned int> &targets,
+        const MPI_Comm                   comm) const
+      {
+        std::vector<unsigned int> sorted_targets = targets;
+        std::sort(sorted_targets.begin(), sorted_targets.end());
+
+        const unsigned int pattern_changed =
+          (graph_communicator == MPI_COMM_NULL || comm != communicator ||
+           sorted_targets != this->targets) ?
+            1 :
+            0;
+
+        // The graph communicator can only be used if all processes agree
+        // to use it.
+        return Utilities::MPI::max(pattern_changed, comm) == 0;
+      }
+
+
+
+      void
+      NeighborGraphCache::reinit(const std::vector<unsigned int> &targets,
+                                 const std::vector<unsigned int> &sources,
+                                 const MPI_Comm                   comm)
+      {
+        clear();
+
+        communicator = comm;
+
+        this->targets = targets;
+        std::sort(this->targets.begin(), this->targets.end());
+        this->sources = sources;
+        std::sort(this->sources.begin(), this->sources.end());
+
+        std::set_union(this->targets.begin(),
+                       this->targets.end(),
+                       this->sources.begin(),
+                       this->sources.end(),
+                       std::back_inserter(neighbors));
+
+#ifdef DEAL_II_WITH_MPI
+        // Use the same list of neighbors for incoming and outgoing edges, so
+        // that the buffers of the neighborhood collectives are in the same
+        // order for sending and receiving. Do not let MPI reorder the ranks,
+        // since the ranks returned to the user refer to the original
+        // communicator.
+        const std::vector<int> neighbor_ranks(neighbors.begin(),
+                                              neighbors.end());
+        const int              ierr =
+          MPI_Dist_graph_create_adjacent(comm,
+                                         neighbor_ranks.size(),
+                                         neighbor_ranks.data(),
+                                         MPI_UNWEIGHTED,
+                                         neighbor_ranks.size(),
+                                         neighbor_ranks.data(),
+                                         MPI_UNWEIGHTED,
+                                         MPI_INFO_NULL,
+                                         0,
+                                         &graph_communicator);
+        AssertThrowMPI(ierr);
+#else
+        Assert(false, ExcNeedsMPI());
+#endif
+      }
+
+
+
+      void
+      NeighborGraphCache::clear()
+      {
+#ifdef DEAL_II_WITH_MPI
+        if (graph_communicator != MPI_COMM_NULL)
+          {
+            // The object might be destroyed after MPI has been finalized, in
+            // which case the communicator does not exist any more.
+            int       finalized = 0;
+            const int ierr      = MPI_Finalized(&finalized);
+            AssertThrowMPI(ierr);
+            if (finalized == 0)
+              Utilities::MPI::free_communicator(graph_communicator);
+          }
+#endif
+
+        communicator       = MPI_COMM_NULL;
+        graph_communicator = MPI_COMM_NULL;
+        targets.clear();
+        sources.clear();
+        neighbors.clear();
+      }
+
+
+
+      const std::vector<unsigned int> &
+      NeighborGraphCache::get_targets() const
+      {
+        return targets;
+      }
+
+
+
+      const std::vector<unsigned int> &
+      NeighborGraphCache::get_sources() const
+      {
+        return sources;
+      }
+
+
+
+      const std::vector<unsigned int> &
+      NeighborGraphCache::get_neighbors() const
+      {
+        return neighbors;
+      }
+
+
+
+      unsigned int
+      NeighborGraphCache::neighbor_index(const unsigned int rank) const
+      {
+        const auto position =
+          std::lower_bound(neighbors.begin(), neighbors.end(), rank);
+        Assert(position != neighbors.end() && *position == rank,
+               ExcMessage("The rank " + std::to_string(rank) +
+                          " is not a neighbor of this process."));
+        return std::distance(neighbors.begin(), position);
+      }
+
+
+
+      std::vector<std::vector<char>>
+      NeighborGraphCache::exchange(
+        const std::vector<std::vector<char>> &send_buffers) const
+      {
+        AssertDimension(send_buffers.size(), neighbors.size());
+
+#ifdef DEAL_II_WITH_MPI
+        Assert(graph_communicator != MPI_COMM_NULL,
+               ExcMessage("The communication pattern has not been set up."));
+
+        const unsigned int n_neighbors = neighbors.size();
+
+        // first exchange the sizes of the messages...
+        std::vector<int> send_counts(n_neighbors);
+        std::vector<int> send_offsets(n_neighbors + 1, 0);
+        for (unsigned int i = 0; i < n_neighbors; ++i)
+          {
+            Assert(send_offsets[i] + send_buffers[i].size() <=
+                     static_cast<std::size_t>(std::numeric_limits<int>::max()),
+                   ExcMessage("The messages sent by this process exceed the "
+                              "maximal size of a neighborhood collective."));
+            send_counts[i]      = send_buffers[i].size();
+            send_offsets[i + 1] = send_offsets[i] + send_counts[i];
+          }
+
+        std::vector<int> recv_counts(n_neighbors);
+        int              ierr = MPI_Neighbor_alltoall(send_counts.data(),
+                                         1,
+                                         MPI_INT,
+                                         recv_counts.data(),
+                                         1,
+                                         MPI_INT,
+                                         graph_communicator);
+        AssertThrowMPI(ierr);
+
+        std::vector<int> recv_offsets(n_neighbors + 1, 0);
+        for (unsigned int i = 0; i < n_neighbors; ++i)
+          recv_offsets[i + 1] = recv_offsets[i] + recv_counts[i];
+
+        // ...then the messages themselves in contiguous buffers
+        std::vector<char> send_data(send_offsets.back());
+        for (unsigned int i = 0; i < n_neighbors; ++i)
+          std::copy(send_buffers[i].begin(),
+                    send_buffers[i].end(),
+                    send_data.begin() + send_offsets[i]);
+
+        std::vector<char> recv_data(recv_offsets.back());
+        ierr = MPI_Neighbor_alltoallv(send_data.data(),
+                                      send_counts.data(),
+                                      send_offsets.data(),
+                                      MPI_CHAR,
+                                      recv_data.data(),
+                                      recv_counts.data(),
+                                      recv_offsets.data(),
+                                      MPI_CHAR,
+                                      graph_communicator);
+        AssertThrowMPI(ierr);
+
+        std::vector<std::vector<char>> recv_buffers(n_neighbors);
+        for (unsigned int i = 0; i < n_neighbors; ++i)
+          recv_buffers[i].assign(recv_data.begin() + recv_offsets[i],
+                                 recv_data.begin() + recv_offsets[i + 1]);
+
+        return recv_buffers;
+#else
+        Assert(false, ExcNeedsMPI());
+        return send_buffers;
+#endif
+      }
+
+
+
+      const NeighborGraphCache::Statistics &
+      NeighborGraphCache::get_statistics() const
+      {
+        return statistics;
+      }
+    } // namespace ConsensusAlgorithms
+  }   // namespace MPI
+} // namespace Utilities
+
+DEAL_II_NAMESPACE_CLOSE
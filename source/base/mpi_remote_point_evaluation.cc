@@ -45,6 +45,8 @@ namespace Utilities
       , enforce_unique_mapping(enforce_unique_mapping)
       , rtree_level(rtree_level)
       , marked_vertices(marked_vertices)
+      , consensus_cache(
+          std::make_unique<ConsensusAlgorithms::NeighborGraphCache>())
       , ready_flag(false)
     {}
 
@@ -100,7 +102,8 @@ namespace Utilities
           marked_vertices ? marked_vertices() : std::vector<bool>(),
           tolerance,
           true,
-          enforce_unique_mapping);
+          enforce_unique_mapping,
+          consensus_cache.get());
 
       this->reinit(data, tria, mapping);
 #endif
@@ -330,6 +333,15 @@ namespace Utilities
       return ready_flag;
     }
 
+
+
+    template <int dim, int spacedim>
+    const ConsensusAlgorithms::NeighborGraphCache &
+    RemotePointEvaluation<dim, spacedim>::get_consensus_cache() const
+    {
+      return *consensus_cache;
+    }
+
   } // end of namespace MPI
 } // end of namespace Utilities
 
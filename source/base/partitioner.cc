@@ -38,7 +38,9 @@ namespace Utilities
       , my_pid(0)
       , n_procs(1)
       , communicator(MPI_COMM_SELF)
+      , node_topology(nullptr)
       , have_ghost_indices(false)
+      , communicator_sm(MPI_COMM_SELF)
     {}
 
 
@@ -54,7 +56,9 @@ namespace Utilities
       , my_pid(0)
       , n_procs(1)
       , communicator(MPI_COMM_SELF)
+      , node_topology(nullptr)
       , have_ghost_indices(false)
+      , communicator_sm(MPI_COMM_SELF)
     {
       locally_owned_range_data.add_range(0, size);
       locally_owned_range_data.compress();
@@ -76,7 +80,9 @@ namespace Utilities
       , my_pid(Utilities::MPI::this_mpi_process(communicator))
       , n_procs(Utilities::MPI::n_mpi_processes(communicator))
       , communicator(communicator)
+      , node_topology(&Utilities::MPI::get_node_topology(communicator))
       , have_ghost_indices(true)
+      , communicator_sm(MPI_COMM_SELF)
     {
       types::global_dof_index prefix_sum = 0;
 
@@ -110,7 +116,9 @@ namespace Utilities
       , my_pid(0)
       , n_procs(1)
       , communicator(communicator_in)
+      , node_topology(nullptr)
       , have_ghost_indices(false)
+      , communicator_sm(MPI_COMM_SELF)
     {
       set_owned_indices(locally_owned_indices);
       set_ghost_indices(ghost_indices_in);
@@ -128,7 +136,9 @@ namespace Utilities
       , my_pid(0)
       , n_procs(1)
       , communicator(communicator_in)
+      , node_topology(nullptr)
       , have_ghost_indices(false)
+      , communicator_sm(MPI_COMM_SELF)
     {
       set_owned_indices(locally_owned_indices);
     }
@@ -151,8 +161,9 @@ namespace Utilities
     void
     Partitioner::set_owned_indices(const IndexSet &locally_owned_indices)
     {
-      my_pid  = Utilities::MPI::this_mpi_process(communicator);
-      n_procs = Utilities::MPI::n_mpi_processes(communicator);
+      my_pid        = Utilities::MPI::this_mpi_process(communicator);
+      n_procs       = Utilities::MPI::n_mpi_processes(communicator);
+      node_topology = &Utilities::MPI::get_node_topology(communicator);
 
       // set the local range
       Assert(locally_owned_indices.is_contiguous() == true,
@@ -193,6 +204,9 @@ namespace Utilities
              ExcDimensionMismatch(ghost_indices_in.size(),
                                   locally_owned_range_data.size()));
 
+      // the shared-memory data structures refer to the old ghost indices
+      set_shared_memory_communicator(MPI_COMM_SELF);
+
       ghost_indices_data = ghost_indices_in;
       if (ghost_indices_data.size() != locally_owned_range_data.size())
         ghost_indices_data.set_size(locally_owned_range_data.size());
@@ -465,6 +479,143 @@ namespace Utilities
 
 
 
+    void
+    Partitioner::set_shared_memory_communicator(const MPI_Comm communicator_sm)
+    {
+      this->communicator_sm = communicator_sm;
+      ghost_targets_sm_ranks.clear();
+      import_targets_sm_ranks.clear();
+      sm_ghost_indices_data.clear();
+      sm_import_ghost_starts.clear();
+
+#  ifdef DEAL_II_WITH_MPI
+      if (communicator_sm == MPI_COMM_SELF)
+        return;
+
+      AssertThrow(n_ghost_indices_in_larger_set == n_ghost_indices(),
+                  ExcNotImplemented());
+
+      // translate the ranks of the communication partners into ranks within
+      // the shared-memory communicator
+      const std::vector<unsigned int> sm_ranks =
+        Utilities::MPI::mpi_processes_within_communicator(communicator,
+                                                          communicator_sm);
+      const auto get_sm_rank = [&sm_ranks](const unsigned int rank) {
+        const auto ptr = std::find(sm_ranks.begin(), sm_ranks.end(), rank);
+        return ptr == sm_ranks.end() ?
+                 numbers::invalid_unsigned_int :
+                 static_cast<unsigned int>(ptr - sm_ranks.begin());
+      };
+
+      ghost_targets_sm_ranks.reserve(ghost_targets_data.size());
+      for (const auto &target : ghost_targets_data)
+        ghost_targets_sm_ranks.push_back(get_sm_rank(target.first));
+
+      import_targets_sm_ranks.reserve(import_targets_data.size());
+      for (const auto &target : import_targets_data)
+        import_targets_sm_ranks.push_back(get_sm_rank(target.first));
+
+      // exchange the positions of the data in the arrays of the processes on
+      // the same node: the owner sends the position of the requested entries
+      // in its locally owned array, whereas the process holding the ghosts
+      // sends the position of the first ghost entry of that owner in its
+      // array (the ghost entries of one owner are contiguous)
+      std::vector<unsigned int> my_ghost_starts;
+      std::vector<unsigned int> my_import_indices;
+      unsigned int              n_sm_ghost_indices = 0;
+      for (unsigned int i = 0, offset = locally_owned_size();
+           i < ghost_targets_data.size();
+           offset += ghost_targets_data[i].second, ++i)
+        if (ghost_targets_sm_ranks[i] != numbers::invalid_unsigned_int)
+          {
+            my_ghost_starts.push_back(offset);
+            n_sm_ghost_indices += ghost_targets_data[i].second;
+          }
+      for (unsigned int i = 0; i < import_targets_data.size(); ++i)
+        if (import_targets_sm_ranks[i] != numbers::invalid_unsigned_int)
+          for (unsigned int c = import_indices_chunks_by_rank_data[i];
+               c < import_indices_chunks_by_rank_data[i + 1];
+               ++c)
+            for (unsigned int j = import_indices_data[c].first;
+                 j < import_indices_data[c].second;
+                 ++j)
+              my_import_indices.push_back(j);
+
+      sm_ghost_indices_data.resize(n_sm_ghost_indices);
+      sm_import_ghost_starts.resize(import_targets_data.size(),
+                                    numbers::invalid_unsigned_int);
+
+      const int tag_starts = internal::Tags::partitioner_shared_memory_setup_0;
+      const int tag_indices =
+        internal::Tags::partitioner_shared_memory_setup_1;
+
+      std::vector<MPI_Request> requests;
+      requests.reserve(2 * (ghost_targets_data.size() +
+                            import_targets_data.size()));
+
+      for (unsigned int i = 0, k = 0, offset = 0;
+           i < ghost_targets_data.size();
+           ++i)
+        if (ghost_targets_sm_ranks[i] != numbers::invalid_unsigned_int)
+          {
+            requests.emplace_back();
+            int ierr = MPI_Isend(my_ghost_starts.data() + k,
+                                 1,
+                                 MPI_UNSIGNED,
+                                 ghost_targets_data[i].first,
+                                 tag_starts,
+                                 communicator,
+                                 &requests.back());
+            AssertThrowMPI(ierr);
+
+            requests.emplace_back();
+            ierr = MPI_Irecv(sm_ghost_indices_data.data() + offset,
+                             ghost_targets_data[i].second,
+                             MPI_UNSIGNED,
+                             ghost_targets_data[i].first,
+                             tag_indices,
+                             communicator,
+                             &requests.back());
+            AssertThrowMPI(ierr);
+
+            ++k;
+            offset += ghost_targets_data[i].second;
+          }
+
+      for (unsigned int i = 0, offset = 0; i < import_targets_data.size(); ++i)
+        if (import_targets_sm_ranks[i] != numbers::invalid_unsigned_int)
+          {
+            requests.emplace_back();
+            int ierr = MPI_Isend(my_import_indices.data() + offset,
+                                 import_targets_data[i].second,
+                                 MPI_UNSIGNED,
+                                 import_targets_data[i].first,
+                                 tag_indices,
+                                 communicator,
+                                 &requests.back());
+            AssertThrowMPI(ierr);
+
+            requests.emplace_back();
+            ierr = MPI_Irecv(sm_import_ghost_starts.data() + i,
+                             1,
+                             MPI_UNSIGNED,
+                             import_targets_data[i].first,
+                             tag_starts,
+                             communicator,
+                             &requests.back());
+            AssertThrowMPI(ierr);
+
+            offset += import_targets_data[i].second;
+          }
+
+      const int ierr =
+        MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+      AssertThrowMPI(ierr);
+#  endif
+    }
+
+
+
     bool
     Partitioner::is_compatible(const Partitioner &part) const
     {
@@ -528,6 +679,11 @@ namespace Utilities
       memory += MemoryConsumption::memory_consumption(n_procs);
       memory += MemoryConsumption::memory_consumption(communicator);
       memory += MemoryConsumption::memory_consumption(have_ghost_indices);
+      memory += MemoryConsumption::memory_consumption(communicator_sm);
+      memory += MemoryConsumption::memory_consumption(ghost_targets_sm_ranks);
+      memory += MemoryConsumption::memory_consumption(import_targets_sm_ranks);
+      memory += MemoryConsumption::memory_consumption(sm_ghost_indices_data);
+      memory += MemoryConsumption::memory_consumption(sm_import_ghost_starts);
       return memory;
     }
 
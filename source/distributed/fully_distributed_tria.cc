@@ -502,7 +502,8 @@ namespace parallel
       // Save cell attached data.
       this->save_attached_data(global_first_cell,
                                this->n_global_active_cells(),
-                               filename);
+                               filename,
+                               this->asynchronous_save);
 
       // Save triangulation description.
       {
@@ -112,7 +112,17 @@ namespace parallel
         partition_settings = partition_zorder;
 #  endif
 
-      if (partition_settings == partition_zoltan)
+      // If requested, only the first process partitions the mesh, and it
+      // broadcasts the result to the other processes, see below.
+      const bool share_partition =
+        (settings & partition_on_first_process) &&
+        (partition_settings != partition_custom_signal);
+
+      if (share_partition && this->my_subdomain != 0)
+        {
+          // The subdomain ids are received from the first process below.
+        }
+      else if (partition_settings == partition_zoltan)
         {
 #  ifndef DEAL_II_TRILINOS_WITH_ZOLTAN
           AssertThrow(false,
@@ -156,6 +166,24 @@ namespace parallel
           AssertThrow(false, ExcInternalError());
         }
 
+      if (share_partition)
+        {
+          std::vector<types::subdomain_id> subdomain_ids(
+            this->n_active_cells());
+          if (this->my_subdomain == 0)
+            for (const auto &cell : this->active_cell_iterators())
+              subdomain_ids[cell->active_cell_index()] = cell->subdomain_id();
+
+          Utilities::MPI::broadcast(subdomain_ids.data(),
+                                    subdomain_ids.size(),
+                                    0,
+                                    this->get_communicator());
+
+          if (this->my_subdomain != 0)
+            for (const auto &cell : this->active_cell_iterators())
+              cell->set_subdomain_id(subdomain_ids[cell->active_cell_index()]);
+        }
+
       // do not partition multigrid levels if user is
       // defining a custom partition
       if ((settings & construct_multigrid_hierarchy) &&
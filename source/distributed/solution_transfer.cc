@@ -24,10 +24,13 @@
 #  include <deal.II/dofs/dof_accessor.h>
 #  include <deal.II/dofs/dof_tools.h>
 
+#  include <deal.II/fe/fe.h>
+
 #  include <deal.II/grid/tria_accessor.h>
 #  include <deal.II/grid/tria_iterator.h>
 
 #  include <deal.II/lac/block_vector.h>
+#  include <deal.II/lac/full_matrix.h>
 #  include <deal.II/lac/la_parallel_block_vector.h>
 #  include <deal.II/lac/la_parallel_vector.h>
 #  include <deal.II/lac/petsc_block_vector.h>
@@ -38,6 +41,7 @@
 
 #  include <functional>
 #  include <numeric>
+#  include <type_traits>
 
 
 DEAL_II_NAMESPACE_OPEN
@@ -104,6 +108,46 @@ namespace
 
     return unpacked_data;
   }
+
+
+
+  /**
+   * Apply a prolongation or restriction matrix to the local values of
+   * several vectors at once, i.e., compute @p dst = @p matrix * @p src where
+   * each column of @p src and @p dst holds the values of one vector.
+   *
+   * Compared to calling FullMatrix::vmult() once per vector, the matrix is
+   * read only once for all vectors. For double values, FullMatrix::mmult()
+   * dispatches to the matrix-matrix product of BLAS if available.
+   */
+  template <typename value_type>
+  void
+  apply_transfer_matrix(const FullMatrix<double>     &matrix,
+                        const FullMatrix<value_type> &src,
+                        FullMatrix<value_type>       &dst)
+  {
+    AssertDimension(matrix.n(), src.m());
+    AssertDimension(matrix.m(), dst.m());
+    AssertDimension(src.n(), dst.n());
+
+    if constexpr (std::is_same_v<value_type, double>)
+      matrix.mmult(dst, src);
+    else
+      {
+        const unsigned int n_vectors = src.n();
+        for (unsigned int i = 0; i < matrix.m(); ++i)
+          {
+            for (unsigned int v = 0; v < n_vectors; ++v)
+              dst(i, v) = value_type();
+            for (unsigned int k = 0; k < matrix.n(); ++k)
+              {
+                const double matrix_ik = matrix(i, k);
+                for (unsigned int v = 0; v < n_vectors; ++v)
+                  dst(i, v) += matrix_ik * src(k, v);
+              }
+          }
+      }
+  }
 } // namespace
 
 
@@ -360,12 +404,79 @@ namespace parallel
       if (dofs_per_cell == 0)
         return std::vector<char>(); // nothing to do for FE_Nothing
 
-      auto it_input  = input_vectors.cbegin();
-      auto it_output = dof_values.begin();
-      for (; it_input != input_vectors.cend(); ++it_input, ++it_output)
+      if (status == CellStatus::children_will_be_coarsened &&
+          dof_handler->has_hp_capabilities() == false &&
+          input_vectors.size() > 1)
         {
-          it_output->reinit(dofs_per_cell);
-          cell->get_interpolated_dof_values(*(*it_input), *it_output, fe_index);
+          // Without hp-capabilities, all children carry the same element as
+          // the parent. Rather than restricting each vector separately, as
+          // cell->get_interpolated_dof_values() would do, collect the values
+          // of all vectors on a child in the columns of a matrix and restrict
+          // them with a single matrix-matrix product. The matrices are kept
+          // in scratch_data, whose memory is only allocated for the first
+          // cell and then reused.
+          using value_type = typename VectorType::value_type;
+
+          const FiniteElement<dim, spacedim> &fe =
+            dof_handler->get_fe(fe_index);
+          const unsigned int n_vectors = input_vectors.size();
+
+          FullMatrix<value_type> &child_values = scratch_data.child_values;
+          FullMatrix<value_type> &restricted_values =
+            scratch_data.transferred_values;
+          FullMatrix<value_type>       &cell_values = scratch_data.cell_values;
+          ::dealii::Vector<value_type> &local_values =
+            scratch_data.local_values;
+          child_values.reinit(dofs_per_cell, n_vectors, true);
+          restricted_values.reinit(dofs_per_cell, n_vectors, true);
+          cell_values.reinit(dofs_per_cell, n_vectors);
+          local_values.reinit(dofs_per_cell, true);
+
+          for (unsigned int child = 0; child < cell->n_children(); ++child)
+            {
+              for (unsigned int v = 0; v < n_vectors; ++v)
+                {
+                  cell->child(child)->get_interpolated_dof_values(
+                    *input_vectors[v], local_values, fe_index);
+                  for (unsigned int i = 0; i < dofs_per_cell; ++i)
+                    child_values(i, v) = local_values(i);
+                }
+
+              apply_transfer_matrix(
+                fe.get_restriction_matrix(child, cell->refinement_case()),
+                child_values,
+                restricted_values);
+
+              // add up or set the values on the parent cell in the same way
+              // as cell->get_interpolated_dof_values()
+              for (unsigned int i = 0; i < dofs_per_cell; ++i)
+                if (fe.restriction_is_additive(i))
+                  for (unsigned int v = 0; v < n_vectors; ++v)
+                    cell_values(i, v) += restricted_values(i, v);
+                else
+                  for (unsigned int v = 0; v < n_vectors; ++v)
+                    if (restricted_values(i, v) != value_type())
+                      cell_values(i, v) = restricted_values(i, v);
+            }
+
+          for (unsigned int v = 0; v < n_vectors; ++v)
+            {
+              dof_values[v].reinit(dofs_per_cell);
+              for (unsigned int i = 0; i < dofs_per_cell; ++i)
+                dof_values[v](i) = cell_values(i, v);
+            }
+        }
+      else
+        {
+          auto it_input  = input_vectors.cbegin();
+          auto it_output = dof_values.begin();
+          for (; it_input != input_vectors.cend(); ++it_input, ++it_output)
+            {
+              it_output->reinit(dofs_per_cell);
+              cell->get_interpolated_dof_values(*(*it_input),
+                                                *it_output,
+                                                fe_index);
+            }
         }
 
       return pack_dof_values<typename VectorType::value_type>(dof_values,
@@ -447,19 +558,69 @@ namespace parallel
             "The transferred data was packed with a different number of dofs than the "
             "currently registered FE object assigned to the DoFHandler has."));
 
-      // distribute data for each registered vector on mesh
-      auto it_input  = dof_values.cbegin();
-      auto it_output = all_out.begin();
-      for (; it_input != dof_values.cend(); ++it_input, ++it_output)
-        if (average_values)
-          cell->distribute_local_to_global_by_interpolation(*it_input,
-                                                            *(*it_output),
-                                                            fe_index);
-        else
-          cell->set_dof_values_by_interpolation(*it_input,
-                                                *(*it_output),
-                                                fe_index,
-                                                true);
+      if (status == CellStatus::cell_will_be_refined &&
+          dof_handler->has_hp_capabilities() == false && all_out.size() > 1)
+        {
+          // Similar to pack_callback(): prolongate the values of all vectors
+          // to each child with a single matrix-matrix product, instead of
+          // one matrix-vector product per vector and child inside
+          // cell->set_dof_values_by_interpolation().
+          using value_type = typename VectorType::value_type;
+
+          const FiniteElement<dim, spacedim> &fe =
+            dof_handler->get_fe(fe_index);
+          const unsigned int n_vectors = all_out.size();
+
+          FullMatrix<value_type> &cell_values  = scratch_data.cell_values;
+          FullMatrix<value_type> &child_values = scratch_data.child_values;
+          ::dealii::Vector<value_type> &local_values =
+            scratch_data.local_values;
+          cell_values.reinit(dofs_per_cell, n_vectors, true);
+          child_values.reinit(dofs_per_cell, n_vectors, true);
+          local_values.reinit(dofs_per_cell, true);
+
+          for (unsigned int v = 0; v < n_vectors; ++v)
+            for (unsigned int i = 0; i < dofs_per_cell; ++i)
+              cell_values(i, v) = dof_values[v](i);
+
+          for (unsigned int child = 0; child < cell->n_children(); ++child)
+            {
+              apply_transfer_matrix(
+                fe.get_prolongation_matrix(child, cell->refinement_case()),
+                cell_values,
+                child_values);
+
+              for (unsigned int v = 0; v < n_vectors; ++v)
+                {
+                  for (unsigned int i = 0; i < dofs_per_cell; ++i)
+                    local_values(i) = child_values(i, v);
+
+                  if (average_values)
+                    cell->child(child)
+                      ->distribute_local_to_global_by_interpolation(
+                        local_values, *all_out[v], fe_index);
+                  else
+                    cell->child(child)->set_dof_values_by_interpolation(
+                      local_values, *all_out[v], fe_index, true);
+                }
+            }
+        }
+      else
+        {
+          // distribute data for each registered vector on mesh
+          auto it_input  = dof_values.cbegin();
+          auto it_output = all_out.begin();
+          for (; it_input != dof_values.cend(); ++it_input, ++it_output)
+            if (average_values)
+              cell->distribute_local_to_global_by_interpolation(*it_input,
+                                                                *(*it_output),
+                                                                fe_index);
+            else
+              cell->set_dof_values_by_interpolation(*it_input,
+                                                    *(*it_output),
+                                                    fe_index,
+                                                    true);
+        }
 
       if (average_values)
         {
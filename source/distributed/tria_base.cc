@@ -678,6 +678,7 @@ namespace parallel
         mpi_communicator,
         smooth_grid,
         check_for_distorted_cells)
+    , asynchronous_save(false)
   {}
 
 
@@ -686,11 +687,32 @@ namespace parallel
   DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
   void DistributedTriangulationBase<dim, spacedim>::clear()
   {
+    finish_asynchronous_save();
+
     dealii::Triangulation<dim, spacedim>::clear();
   }
 
 
 
+  template <int dim, int spacedim>
+  DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+  void DistributedTriangulationBase<dim, spacedim>::set_asynchronous_save(
+    const bool asynchronous_save)
+  {
+    this->asynchronous_save = asynchronous_save;
+  }
+
+
+
+  template <int dim, int spacedim>
+  DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+  void DistributedTriangulationBase<dim, spacedim>::finish_asynchronous_save()
+  {
+    this->data_serializer.save_finish();
+  }
+
+
+
   template <int dim, int spacedim>
   DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
   bool DistributedTriangulationBase<dim, spacedim>::has_hanging_nodes() const
@@ -346,18 +346,65 @@ FEValues<dim, spacedim>::do_reinit()
                                            this->mapping_output);
     }
 
+  // on a scaled copy of the cell stored in scaled_copy_cache, the finite
+  // element does not need to compute the mapped derivatives of the shape
+  // functions, and we set them from the stored ones below. the output of the
+  // finite element still holds the derivatives on the stored cell until the
+  // first such copy is found, so store them at that point
+  const bool is_scaled_translation =
+    (this->cell_similarity == CellSimilarity::scaled_translation);
+  auto &cache  = this->scaled_copy_cache;
+  auto &output = this->finite_element_output;
+  if (is_scaled_translation && !cache.derivatives_are_stored)
+    {
+      cache.shape_gradients        = output.shape_gradients;
+      cache.shape_hessians         = output.shape_hessians;
+      cache.shape_3rd_derivatives  = output.shape_3rd_derivatives;
+      cache.derivatives_are_stored = true;
+    }
+
   // then call the finite element and, with the data
   // already filled by the mapping, let it compute the
   // data for the mapped shape function values, gradients,
   // etc.
   this->get_fe().fill_fe_values(this->present_cell,
-                                this->cell_similarity,
+                                (is_scaled_translation ?
+                                   CellSimilarity::translation :
+                                   this->cell_similarity),
                                 this->quadrature,
                                 this->get_mapping(),
                                 *this->mapping_data,
                                 this->mapping_output,
                                 *this->fe_data,
-                                this->finite_element_output);
+                                output);
+
+  if (is_scaled_translation)
+    {
+      // the k-th derivatives scale with the k-th power of the inverse cell
+      // size
+      const double inverse_scaling = 1. / this->cell_scaling;
+      for (unsigned int i = 0; i < output.shape_gradients.n_rows(); ++i)
+        for (unsigned int q = 0; q < output.shape_gradients.n_cols(); ++q)
+          output.shape_gradients(i, q) =
+            inverse_scaling * cache.shape_gradients(i, q);
+      for (unsigned int i = 0; i < output.shape_hessians.n_rows(); ++i)
+        for (unsigned int q = 0; q < output.shape_hessians.n_cols(); ++q)
+          output.shape_hessians(i, q) =
+            (inverse_scaling * inverse_scaling) * cache.shape_hessians(i, q);
+      for (unsigned int i = 0; i < output.shape_3rd_derivatives.n_rows(); ++i)
+        for (unsigned int q = 0; q < output.shape_3rd_derivatives.n_cols();
+             ++q)
+          output.shape_3rd_derivatives(i, q) =
+            (inverse_scaling * inverse_scaling * inverse_scaling) *
+            cache.shape_3rd_derivatives(i, q);
+    }
+
+  ++this->cell_similarity_statistics.n_cells;
+  if (this->cell_similarity == CellSimilarity::translation ||
+      this->cell_similarity == CellSimilarity::inverted_translation)
+    ++this->cell_similarity_statistics.n_translations;
+  else if (is_scaled_translation)
+    ++this->cell_similarity_statistics.n_scaled_translations;
 }
 
 
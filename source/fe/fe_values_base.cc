@@ -26,8 +26,12 @@
 #include <deal.II/dofs/dof_accessor.h>
 
 #include <deal.II/fe/fe.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_q_base.h>
 #include <deal.II/fe/fe_values.h>
 #include <deal.II/fe/mapping.h>
+#include <deal.II/fe/mapping_cartesian.h>
+#include <deal.II/fe/mapping_q.h>
 
 #include <deal.II/grid/tria_accessor.h>
 #include <deal.II/grid/tria_iterator.h>
@@ -38,6 +42,7 @@
 
 #include <iomanip>
 #include <memory>
+#include <typeinfo>
 #include <type_traits>
 
 DEAL_II_NAMESPACE_OPEN
@@ -102,6 +107,69 @@ namespace internal
         return false;
       }
     };
+
+
+
+    // Return whether the derivatives of the shape functions of the given
+    // finite element, mapped with the given mapping, on a translated and
+    // uniformly scaled copy of a cell are the derivatives on the original
+    // cell times a power of the inverse scaling factor. This requires a
+    // mapping that is defined by the vertices of the cell alone, and shape
+    // functions that are defined on the reference cell and whose gradients
+    // are mapped covariantly. FESystem is not included because it copies the
+    // data of its base elements on every cell.
+    template <int dim, int spacedim>
+    bool
+    shape_derivatives_scale_with_cell(
+      const Mapping<dim, spacedim>       &mapping,
+      const FiniteElement<dim, spacedim> &fe)
+    {
+      if (dim != spacedim)
+        return false;
+
+      const bool mapping_scales_with_cell =
+        typeid(mapping) == typeid(MappingCartesian<dim, spacedim>) ||
+        (typeid(mapping) == typeid(MappingQ<dim, spacedim>) &&
+         static_cast<const MappingQ<dim, spacedim> &>(mapping).get_degree() ==
+           1);
+
+      const bool fe_scales_with_cell =
+        dynamic_cast<const FE_Q_Base<dim, spacedim> *>(&fe) != nullptr ||
+        dynamic_cast<const FE_DGQ<dim, spacedim> *>(&fe) != nullptr;
+
+      return mapping_scales_with_cell && fe_scales_with_cell;
+    }
+
+
+
+    // Return the factor s if the vertices of the given cell are
+    // s * vertices[v] + t for some shift t, or zero if the cell is not a
+    // translated and uniformly scaled copy of the cell with these vertices.
+    template <int dim, int spacedim>
+    double
+    get_scaling_to_cell(
+      const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+      const std::vector<Point<spacedim>>                         &vertices)
+    {
+      if (cell->n_vertices() != vertices.size())
+        return 0.;
+
+      const Tensor<1, spacedim> edge = cell->vertex(1) - cell->vertex(0);
+      const double scaling = edge.norm() / (vertices[1] - vertices[0]).norm();
+
+      // use the same relative tolerance as TriaAccessor::is_translation_of()
+      const double tolerance_square = 1e-24 * edge.norm_square();
+      for (const unsigned int v : cell->vertex_indices())
+        {
+          const Tensor<1, spacedim> difference =
+            (cell->vertex(v) - cell->vertex(0)) -
+            scaling * (vertices[v] - vertices[0]);
+          if (difference.norm_square() > tolerance_square)
+            return 0.;
+        }
+
+      return scaling;
+    }
   } // namespace
 } // namespace internal
 
@@ -222,8 +290,11 @@ FEValuesBase<dim, spacedim>::FEValuesBase(
   , mapping(&mapping, typeid(*this).name())
   , fe(&fe, typeid(*this).name())
   , cell_similarity(CellSimilarity::Similarity::none)
+  , cell_scaling(1.)
   , fe_values_views_cache(*this)
   , check_for_cell_similarity_allowed(MultithreadInfo::n_threads() == 1)
+  , check_for_scaled_translation_allowed(
+      internal::shape_derivatives_scale_with_cell(mapping, fe))
 {
   Assert(n_q_points > 0,
          ExcMessage("There is nothing useful you can do with an FEValues "
@@ -1416,6 +1487,9 @@ FEValuesBase<dim, spacedim>::check_cell_similarity(
   if (check_for_cell_similarity_allowed == false)
     {
       cell_similarity = CellSimilarity::none;
+      // the derivatives computed on the next cell overwrite the ones of the
+      // stored cell
+      scaled_copy_cache.vertices.clear();
       return;
     }
 
@@ -1443,8 +1517,37 @@ FEValuesBase<dim, spacedim>::check_cell_similarity(
             ->direction_flag() != cell->direction_flag())
         cell_similarity = CellSimilarity::inverted_translation;
     }
+
+  // cells that are not translations of the previous cell might still be
+  // translated and uniformly scaled copies of the last cell on which the
+  // derivatives were computed in full, e.g. cells on any level of an
+  // adaptively refined Cartesian mesh. the comparison only involves the
+  // vertices of that cell, so it remains valid if the triangulation has
+  // changed since. otherwise, the derivatives are computed in full on the
+  // current cell and it becomes the one to compare with
+  if (check_for_scaled_translation_allowed &&
+      cell_similarity == CellSimilarity::none)
+    {
+      const double scaling =
+        scaled_copy_cache.vertices.empty() ?
+          0. :
+          internal::get_scaling_to_cell<dim, spacedim>(
+            cell, scaled_copy_cache.vertices);
+      if (scaling > 0.)
+        {
+          cell_similarity = CellSimilarity::scaled_translation;
+          cell_scaling    = scaling;
+        }
+      else
+        {
+          scaled_copy_cache.vertices.resize(cell->n_vertices());
+          for (const unsigned int v : cell->vertex_indices())
+            scaled_copy_cache.vertices[v] = cell->vertex(v);
+          scaled_copy_cache.derivatives_are_stored = false;
+        }
+    }
   // TODO: here, one could implement other checks for similarity, e.g. for
-  // children of a parallelogram.
+  // rotated copies of the previous cell.
 }
 
 
@@ -1458,6 +1561,41 @@ FEValuesBase<dim, spacedim>::get_cell_similarity() const
 
 
 
+template <int dim, int spacedim>
+double
+FEValuesBase<dim, spacedim>::CellSimilarityStatistics::hit_rate() const
+{
+  if (n_cells == 0)
+    return 0.;
+
+  return static_cast<double>(n_translations + n_scaled_translations) /
+         n_cells;
+}
+
+
+
+template <int dim, int spacedim>
+typename FEValuesBase<dim, spacedim>::CellSimilarityStatistics &
+FEValuesBase<dim, spacedim>::CellSimilarityStatistics::operator+=(
+  const CellSimilarityStatistics &other)
+{
+  n_cells += other.n_cells;
+  n_translations += other.n_translations;
+  n_scaled_translations += other.n_scaled_translations;
+  return *this;
+}
+
+
+
+template <int dim, int spacedim>
+const typename FEValuesBase<dim, spacedim>::CellSimilarityStatistics &
+FEValuesBase<dim, spacedim>::get_cell_similarity_statistics() const
+{
+  return cell_similarity_statistics;
+}
+
+
+
 template <int dim, int spacedim>
 const unsigned int FEValuesBase<dim, spacedim>::dimension;
 
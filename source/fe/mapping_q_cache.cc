@@ -48,6 +48,7 @@ MappingQCache<dim, spacedim>::MappingQCache(
   const MappingQCache<dim, spacedim> &mapping)
   : MappingQ<dim, spacedim>(mapping)
   , support_point_cache(mapping.support_point_cache)
+  , affine_cell_cache(mapping.affine_cell_cache)
   , uses_level_info(mapping.uses_level_info)
 {}
 
@@ -61,6 +62,7 @@ MappingQCache<dim, spacedim>::~MappingQCache()
   // invalid memory that has been left back by freeing an object of this
   // class.
   support_point_cache.reset();
+  affine_cell_cache.reset();
   clear_signal.disconnect();
 }
 
@@ -142,14 +144,22 @@ MappingQCache<dim, spacedim>::initialize(
     &compute_points_on_cell)
 {
   clear_signal.disconnect();
-  clear_signal = triangulation.signals.any_change.connect(
-    [&]() -> void { this->support_point_cache.reset(); });
+  clear_signal = triangulation.signals.any_change.connect([&]() -> void {
+    this->support_point_cache.reset();
+    this->affine_cell_cache.reset();
+  });
 
   support_point_cache =
     std::make_shared<std::vector<std::vector<std::vector<Point<spacedim>>>>>(
       triangulation.n_levels());
+  affine_cell_cache =
+    std::make_shared<std::vector<std::vector<AffineCellData>>>(
+      triangulation.n_levels());
   for (unsigned int l = 0; l < triangulation.n_levels(); ++l)
-    (*support_point_cache)[l].resize(triangulation.n_raw_cells(l));
+    {
+      (*support_point_cache)[l].resize(triangulation.n_raw_cells(l));
+      (*affine_cell_cache)[l].resize(triangulation.n_raw_cells(l));
+    }
 
   WorkStream::run(
     triangulation.begin(),
@@ -157,11 +167,48 @@ MappingQCache<dim, spacedim>::initialize(
     [&](const typename Triangulation<dim, spacedim>::cell_iterator &cell,
         void *,
         void *) {
-      (*support_point_cache)[cell->level()][cell->index()] =
-        compute_points_on_cell(cell);
-      AssertDimension(
-        (*support_point_cache)[cell->level()][cell->index()].size(),
-        Utilities::pow(this->get_degree() + 1, dim));
+      const std::vector<Point<spacedim>> &points =
+        (*support_point_cache)[cell->level()][cell->index()] =
+          compute_points_on_cell(cell);
+      AssertDimension(points.size(),
+                      Utilities::pow(this->get_degree() + 1, dim));
+
+      // Check whether the support points are an affine image of the unit
+      // cell support points, using the vertices 1, 2, 4 adjacent to vertex
+      // 0 to define the affine map, and store its inverse if so.
+      if (dim == spacedim)
+        {
+          AffineCellData &affine_data =
+            (*affine_cell_cache)[cell->level()][cell->index()];
+
+          Tensor<2, spacedim> jacobian;
+          double              scale = 0.;
+          for (unsigned int d = 0; d < dim; ++d)
+            {
+              const Tensor<1, spacedim> edge = points[1 << d] - points[0];
+              for (unsigned int e = 0; e < spacedim; ++e)
+                jacobian[e][d] = edge[e];
+              scale += edge.norm_square();
+            }
+
+          bool is_affine = determinant(jacobian) > 0.;
+          for (unsigned int i = 0; i < points.size() && is_affine; ++i)
+            {
+              Tensor<1, spacedim> unit_point;
+              for (unsigned int d = 0; d < dim; ++d)
+                unit_point[d] = this->unit_cell_support_points[i][d];
+              if ((points[0] + jacobian * unit_point - points[i])
+                    .norm_square() > 1e-24 * scale)
+                is_affine = false;
+            }
+
+          affine_data.is_affine = is_affine;
+          if (is_affine)
+            {
+              affine_data.origin           = points[0];
+              affine_data.inverse_jacobian = invert(jacobian);
+            }
+        }
     },
     /* copier */ std::function<void(void *)>(),
     /* scratch_data */ nullptr,
@@ -692,13 +739,84 @@ MappingQCache<dim, spacedim>::initialize(
 
 
 
+template <int dim, int spacedim>
+bool
+MappingQCache<dim, spacedim>::is_affine(
+  const typename Triangulation<dim, spacedim>::cell_iterator &cell) const
+{
+  Assert(affine_cell_cache.get() != nullptr,
+         ExcMessage("Must call MappingQCache::initialize() before "
+                    "using it or after mesh has changed!"));
+
+  Assert(uses_level_info || cell->is_active(), ExcInternalError());
+
+  AssertIndexRange(cell->level(), affine_cell_cache->size());
+  AssertIndexRange(cell->index(), (*affine_cell_cache)[cell->level()].size());
+  return (*affine_cell_cache)[cell->level()][cell->index()].is_affine;
+}
+
+
+
+template <int dim, int spacedim>
+Point<dim>
+MappingQCache<dim, spacedim>::transform_real_to_unit_cell(
+  const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+  const Point<spacedim>                                      &p) const
+{
+  if (is_affine(cell) == false)
+    return MappingQ<dim, spacedim>::transform_real_to_unit_cell(cell, p);
+
+  const AffineCellData &affine_data =
+    (*affine_cell_cache)[cell->level()][cell->index()];
+  const Tensor<1, spacedim> unit_point =
+    affine_data.inverse_jacobian * (p - affine_data.origin);
+
+  Point<dim> p_unit;
+  for (unsigned int d = 0; d < dim; ++d)
+    p_unit[d] = unit_point[d];
+  return p_unit;
+}
+
+
+
+template <int dim, int spacedim>
+void
+MappingQCache<dim, spacedim>::transform_points_real_to_unit_cell(
+  const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+  const ArrayView<const Point<spacedim>>                     &real_points,
+  const ArrayView<Point<dim>>                                &unit_points) const
+{
+  AssertDimension(real_points.size(), unit_points.size());
+
+  if (is_affine(cell) == false)
+    {
+      MappingQ<dim, spacedim>::transform_points_real_to_unit_cell(cell,
+                                                                  real_points,
+                                                                  unit_points);
+      return;
+    }
+
+  const AffineCellData &affine_data =
+    (*affine_cell_cache)[cell->level()][cell->index()];
+  for (unsigned int i = 0; i < real_points.size(); ++i)
+    {
+      const Tensor<1, spacedim> unit_point =
+        affine_data.inverse_jacobian * (real_points[i] - affine_data.origin);
+      for (unsigned int d = 0; d < dim; ++d)
+        unit_points[i][d] = unit_point[d];
+    }
+}
+
+
+
 template <int dim, int spacedim>
 std::size_t
 MappingQCache<dim, spacedim>::memory_consumption() const
 {
   if (support_point_cache.get() != nullptr)
     return sizeof(*this) +
-           MemoryConsumption::memory_consumption(*support_point_cache);
+           MemoryConsumption::memory_consumption(*support_point_cache) +
+           MemoryConsumption::memory_consumption(*affine_cell_cache);
   else
     return sizeof(*this);
 }
@@ -3946,7 +3946,8 @@ namespace GridTools
       const std::vector<bool>                               &marked_vertices,
       const double                                           tolerance,
       const bool                                             perform_handshake,
-      const bool enforce_unique_mapping)
+      const bool enforce_unique_mapping,
+      Utilities::MPI::ConsensusAlgorithms::NeighborGraphCache *consensus_cache)
     {
       DistributedComputePointLocationsInternal<dim, spacedim> result;
       result.n_searched_points = points.size();
@@ -4083,12 +4084,22 @@ namespace GridTools
           }
       };
 
-      Utilities::MPI::ConsensusAlgorithms::selector<RequestType, AnswerType>(
-        potential_owners_ranks,
-        create_request,
-        answer_request,
-        process_answer,
-        comm);
+      if (consensus_cache != nullptr)
+        Utilities::MPI::ConsensusAlgorithms::neighbor_graph<RequestType,
+                                                            AnswerType>(
+          *consensus_cache,
+          potential_owners_ranks,
+          create_request,
+          answer_request,
+          process_answer,
+          comm);
+      else
+        Utilities::MPI::ConsensusAlgorithms::selector<RequestType, AnswerType>(
+          potential_owners_ranks,
+          create_request,
+          answer_request,
+          process_answer,
+          comm);
 
       result.finalize_setup();
 
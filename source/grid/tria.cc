@@ -135,6 +135,26 @@ namespace internal
   {}
 
 
+
+  template <int dim, int spacedim>
+  DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+  CellAttachedDataSerializer<dim, spacedim>::~CellAttachedDataSerializer()
+  {
+#ifdef DEAL_II_WITH_MPI
+    if (save_pending())
+      {
+        // The object might be destroyed after MPI has been finalized, in
+        // which case the file handles do not exist any more.
+        int       finalized = 0;
+        const int ierr      = MPI_Finalized(&finalized);
+        AssertNothrow(ierr == MPI_SUCCESS, ExcMPI(ierr));
+        if (finalized == 0)
+          save_finish();
+      }
+#endif
+  }
+
+
   template <int dim, int spacedim>
   DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
   void CellAttachedDataSerializer<dim, spacedim>::pack_data(
@@ -895,6 +915,200 @@ namespace internal
   }
 
 
+  template <int dim, int spacedim>
+  DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+  void CellAttachedDataSerializer<dim, spacedim>::save_start(
+    const unsigned int global_first_cell,
+    const unsigned int global_num_cells,
+    const std::string &filename,
+    const MPI_Comm    &mpi_communicator)
+  {
+    Assert(sizes_fixed_cumulative.size() > 0,
+           ExcMessage("No data has been packed!"));
+
+    // Only one save can be in flight at any time.
+    save_finish();
+
+#ifdef DEAL_II_WITH_MPI
+    const int myrank  = Utilities::MPI::this_mpi_process(mpi_communicator);
+    const int mpisize = Utilities::MPI::n_mpi_processes(mpi_communicator);
+
+    if (mpisize > 1)
+      {
+        const unsigned int bytes_per_cell = sizes_fixed_cumulative.back();
+
+        // Move the packed data into the staging buffers, which need to stay
+        // alive until the write operations have completed.
+        pending_save.sizes_fixed_cumulative = sizes_fixed_cumulative;
+        pending_save.data_fixed             = std::move(src_data_fixed);
+        src_data_fixed.clear();
+        if (variable_size_data_stored)
+          {
+            pending_save.sizes_variable = std::move(src_sizes_variable);
+            pending_save.data_variable  = std::move(src_data_variable);
+            src_sizes_variable.clear();
+            src_data_variable.clear();
+          }
+
+        // Open a file for writing and delete its previous contents.
+        const auto open_file = [&](const std::string &fname) {
+          MPI_Info info;
+          int      ierr = MPI_Info_create(&info);
+          AssertThrowMPI(ierr);
+
+          MPI_File fh;
+          ierr = MPI_File_open(mpi_communicator,
+                               fname.c_str(),
+                               MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                               info,
+                               &fh);
+          AssertThrowMPI(ierr);
+
+          ierr = MPI_File_set_size(fh, 0); // delete the file contents
+          AssertThrowMPI(ierr);
+          // this barrier is necessary, because otherwise others might already
+          // write while one core is still setting the size to zero.
+          ierr = MPI_Barrier(mpi_communicator);
+          AssertThrowMPI(ierr);
+          ierr = MPI_Info_free(&info);
+          AssertThrowMPI(ierr);
+
+          pending_save.files.push_back(fh);
+          return fh;
+        };
+
+        // Start a collective write operation into the file, to be completed
+        // in save_finish().
+        const auto start_write = [&](MPI_File           fh,
+                                     const MPI_Offset   position,
+                                     const void        *data,
+                                     const MPI_Count    count,
+                                     const MPI_Datatype datatype) {
+          MPI_Request request;
+          const int   ierr = Utilities::MPI::LargeCount::File_iwrite_at_all_c(
+            fh, position, data, count, datatype, &request);
+          AssertThrowMPI(ierr);
+          pending_save.requests.push_back(request);
+        };
+
+        //
+        // ---------- Fixed size data ----------
+        //
+        {
+          MPI_File fh = open_file(std::string(filename) + "_fixed.data");
+
+          // The header is small, so let the first processor write it right
+          // away, see save().
+          if (myrank == 0)
+            {
+              const int ierr = Utilities::MPI::LargeCount::File_write_at_c(
+                fh,
+                0,
+                pending_save.sizes_fixed_cumulative.data(),
+                pending_save.sizes_fixed_cumulative.size(),
+                MPI_UNSIGNED,
+                MPI_STATUS_IGNORE);
+              AssertThrowMPI(ierr);
+            }
+
+          const MPI_Offset size_header =
+            pending_save.sizes_fixed_cumulative.size() * sizeof(unsigned int);
+          const MPI_Offset my_global_file_position =
+            size_header +
+            static_cast<MPI_Offset>(global_first_cell) * bytes_per_cell;
+
+          start_write(fh,
+                      my_global_file_position,
+                      pending_save.data_fixed.data(),
+                      pending_save.data_fixed.size(),
+                      MPI_BYTE);
+        }
+
+        //
+        // ---------- Variable size data ----------
+        //
+        if (variable_size_data_stored)
+          {
+            MPI_File fh = open_file(std::string(filename) + "_variable.data");
+
+            AssertThrow(pending_save.sizes_variable.size() <
+                          static_cast<std::size_t>(
+                            std::numeric_limits<int>::max()),
+                        ExcNotImplemented());
+
+            start_write(fh,
+                        static_cast<MPI_Offset>(global_first_cell) *
+                          sizeof(unsigned int),
+                        pending_save.sizes_variable.data(),
+                        pending_save.sizes_variable.size(),
+                        MPI_INT);
+
+            const std::uint64_t size_on_proc =
+              pending_save.data_variable.size();
+            std::uint64_t prefix_sum = 0;
+            const int     ierr       = MPI_Exscan(&size_on_proc,
+                                        &prefix_sum,
+                                        1,
+                                        MPI_UINT64_T,
+                                        MPI_SUM,
+                                        mpi_communicator);
+            AssertThrowMPI(ierr);
+
+            start_write(fh,
+                        static_cast<MPI_Offset>(global_num_cells) *
+                            sizeof(unsigned int) +
+                          prefix_sum,
+                        pending_save.data_variable.data(),
+                        pending_save.data_variable.size(),
+                        MPI_BYTE);
+          }
+      }
+    else
+#endif
+      save(global_first_cell, global_num_cells, filename, mpi_communicator);
+  }
+
+
+
+  template <int dim, int spacedim>
+  DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+  void CellAttachedDataSerializer<dim, spacedim>::save_finish()
+  {
+#ifdef DEAL_II_WITH_MPI
+    if (!save_pending())
+      return;
+
+    int ierr = MPI_Waitall(pending_save.requests.size(),
+                           pending_save.requests.data(),
+                           MPI_STATUSES_IGNORE);
+    AssertThrowMPI(ierr);
+
+    for (MPI_File &fh : pending_save.files)
+      {
+        ierr = MPI_File_close(&fh);
+        AssertThrowMPI(ierr);
+      }
+
+    // free the staging buffers
+    pending_save = PendingSave();
+#endif
+  }
+
+
+
+  template <int dim, int spacedim>
+  DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+  bool CellAttachedDataSerializer<dim, spacedim>::save_pending() const
+  {
+#ifdef DEAL_II_WITH_MPI
+    return !pending_save.files.empty();
+#else
+    return false;
+#endif
+  }
+
+
+
   template <int dim, int spacedim>
   DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
   void CellAttachedDataSerializer<dim, spacedim>::load(
@@ -16071,11 +16285,15 @@ DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
 void Triangulation<dim, spacedim>::save_attached_data(
   const unsigned int global_first_cell,
   const unsigned int global_num_cells,
-  const std::string &filename) const
+  const std::string &filename,
+  const bool         asynchronous) const
 {
   // cast away constness
   auto tria = const_cast<Triangulation<dim, spacedim> *>(this);
 
+  // complete a previous asynchronous save before writing again
+  tria->data_serializer.save_finish();
+
   if (this->cell_attached_data.n_attached_data_sets > 0)
     {
       // pack attached data first
@@ -16085,11 +16303,18 @@ void Triangulation<dim, spacedim>::save_attached_data(
         tria->cell_attached_data.pack_callbacks_variable,
         this->get_communicator());
 
-      // then store buffers in file
-      tria->data_serializer.save(global_first_cell,
-                                 global_num_cells,
-                                 filename,
-                                 this->get_communicator());
+      // then store buffers in file, or only start to do so, in which case the
+      // buffers are kept alive by the serializer until save_finish()
+      if (asynchronous)
+        tria->data_serializer.save_start(global_first_cell,
+                                         global_num_cells,
+                                         filename,
+                                         this->get_communicator());
+      else
+        tria->data_serializer.save(global_first_cell,
+                                   global_num_cells,
+                                   filename,
+                                   this->get_communicator());
 
       // and release the memory afterwards
       tria->data_serializer.clear();
@@ -16115,6 +16340,9 @@ void Triangulation<dim, spacedim>::load_attached_data(
   const unsigned int n_attached_deserialize_fixed,
   const unsigned int n_attached_deserialize_variable)
 {
+  // the files might still be written by an asynchronous save
+  this->data_serializer.save_finish();
+
   // load saved data, if any was stored
   if (this->cell_attached_data.n_attached_deserialize > 0)
     {
@@ -256,6 +256,26 @@ namespace hp
                              indices :
                              std::vector<unsigned int>(size, 0));
   }
+
+
+
+  template <int dim, int q_dim, typename FEValuesType>
+  typename FEValuesType::CellSimilarityStatistics
+  FEValuesBase<dim, q_dim, FEValuesType>::get_cell_similarity_statistics()
+    const
+  {
+    typename FEValuesType::CellSimilarityStatistics statistics;
+    for (unsigned int fe_index = 0; fe_index < fe_values_table.size(0);
+         ++fe_index)
+      for (unsigned int m_index = 0; m_index < fe_values_table.size(1);
+           ++m_index)
+        for (unsigned int q_index = 0; q_index < fe_values_table.size(2);
+             ++q_index)
+          if (fe_values_table[fe_index][m_index][q_index].get() != nullptr)
+            statistics += fe_values_table[fe_index][m_index][q_index]
+                            ->get_cell_similarity_statistics();
+    return statistics;
+  }
 } // namespace hp
 
 
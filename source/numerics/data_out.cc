@@ -15,6 +15,8 @@
 
 #include <deal.II/base/work_stream.h>
 
+#include <deal.II/distributed/tria_base.h>
+
 #include <deal.II/dofs/dof_accessor.h>
 #include <deal.II/dofs/dof_handler.h>
 
@@ -59,6 +61,7 @@ namespace internal
                                         false)
       , cell_to_patch_index_map(&cell_to_patch_index_map)
     {}
+
   } // namespace DataOutImplementation
 } // namespace internal
 
@@ -99,11 +102,24 @@ DataOut<dim, spacedim>::build_one_patch(
   const unsigned int                                            n_subdivisions,
   const CurvedCellRegion curved_cell_region)
 {
-  // first create the output object that we will write into
+  // first get the output object that we will write into. we write directly
+  // into the entry of the patches array rather than into a temporary object:
+  // if build_patches() is called repeatedly, the patch still holds the
+  // memory of its data table from the previous call, and reinit() below does
+  // not need to allocate new memory if the size has not changed
+  const unsigned int patch_idx =
+    (*scratch_data.cell_to_patch_index_map)[cell_and_index->first->level()]
+                                           [cell_and_index->first->index()];
+  // did we mess up the indices?
+  Assert(patch_idx < this->patches.size(), ExcInternalError());
 
-  ::dealii::DataOutBase::Patch<dim, spacedim> patch;
+  ::dealii::DataOutBase::Patch<dim, spacedim> &patch = this->patches[patch_idx];
+  patch.patch_index    = patch_idx;
   patch.n_subdivisions = n_subdivisions;
   patch.reference_cell = cell_and_index->first->reference_cell();
+  std::fill(patch.neighbors.begin(),
+            patch.neighbors.end(),
+            numbers::invalid_unsigned_int);
 
   // initialize FEValues
   scratch_data.reinit_all_fe_values(this->dof_data, cell_and_index->first);
@@ -1042,18 +1058,6 @@ DataOut<dim, spacedim>::build_one_patch(
         (*scratch_data
             .cell_to_patch_index_map)[neighbor->level()][neighbor->index()];
     }
-
-  const unsigned int patch_idx =
-    (*scratch_data.cell_to_patch_index_map)[cell_and_index->first->level()]
-                                           [cell_and_index->first->index()];
-  // did we mess up the indices?
-  Assert(patch_idx < this->patches.size(), ExcInternalError());
-  patch.patch_index = patch_idx;
-
-  // Put the patch into the patches vector. instead of copying the data,
-  // simply swap the contents to avoid the penalty of writing into another
-  // processor's memory
-  this->patches[patch_idx].swap(patch);
 }
 
 
@@ -1123,21 +1127,23 @@ DataOut<dim, spacedim>::build_patches(
   // Now construct the map such that
   // cell_to_patch_index_map[cell->level][cell->index] = patch_index
   std::vector<std::vector<unsigned int>> cell_to_patch_index_map;
-  cell_to_patch_index_map.resize(this->triangulation->n_levels());
-  for (unsigned int l = 0; l < this->triangulation->n_levels(); ++l)
-    {
-      // max_index is the largest cell->index on level l
-      unsigned int max_index = 0;
-      for (cell_iterator cell = first_cell_function(*this->triangulation);
-           cell != this->triangulation->end();
-           cell = next_cell_function(*this->triangulation, cell))
-        if (static_cast<unsigned int>(cell->level()) == l)
-          max_index =
-            std::max(max_index, static_cast<unsigned int>(cell->index()));
+  {
+    // max_index[l] is the largest cell->index on level l. compute it for all
+    // levels in a single sweep over the selected cells
+    std::vector<unsigned int> max_index(this->triangulation->n_levels(), 0);
+    for (cell_iterator cell = first_cell_function(*this->triangulation);
+         cell != this->triangulation->end();
+         cell = next_cell_function(*this->triangulation, cell))
+      max_index[cell->level()] =
+        std::max(max_index[cell->level()],
+                 static_cast<unsigned int>(cell->index()));
 
+    cell_to_patch_index_map.resize(this->triangulation->n_levels());
+    for (unsigned int l = 0; l < this->triangulation->n_levels(); ++l)
       cell_to_patch_index_map[l].resize(
-        max_index + 1, dealii::DataOutBase::Patch<dim, spacedim>::no_neighbor);
-    }
+        max_index[l] + 1,
+        dealii::DataOutBase::Patch<dim, spacedim>::no_neighbor);
+  }
 
   // will be all_cells[patch_index] = pair(cell, active_index)
   std::vector<std::pair<cell_iterator, unsigned int>> all_cells;
@@ -1177,7 +1183,10 @@ DataOut<dim, spacedim>::build_patches(
       }
   }
 
-  this->patches.clear();
+  // do not clear the patches from a previous call: build_one_patch() writes
+  // all fields of each patch, and keeping the existing objects allows to
+  // re-use the memory of their data tables when the output is written
+  // repeatedly on the same mesh
   this->patches.resize(all_cells.size());
 
   // Now create a default object for the WorkStream object to work with. The
@@ -1324,6 +1333,73 @@ DataOut<dim, spacedim>::set_cell_selection(
 
 
 
+template <int dim, int spacedim>
+void
+DataOut<dim, spacedim>::set_cell_selection(
+  const unsigned int                          max_level,
+  const std::optional<BoundingBox<spacedim>> &region)
+{
+  // for each cell on max_level (indexed by cell->index()), whether all of
+  // its active descendants, or the cell itself if it is active, are locally
+  // owned. this is filled once at the start of each sweep over the cells
+  // below, rather than evaluated for every cell the filter looks at
+  const auto all_descendants_owned = std::make_shared<std::vector<bool>>();
+
+  const auto predicate = [max_level, region, all_descendants_owned](
+                           const cell_iterator &cell) {
+    if (region && !region->has_overlap_with(cell->bounding_box()))
+      return false;
+
+    const unsigned int level = cell->level();
+    if (level < max_level)
+      return (cell->is_active() && cell->is_locally_owned());
+    else if (level == max_level)
+      return static_cast<bool>((*all_descendants_owned)[cell->index()]);
+    else
+      {
+        // a cell on a finer level is only output if its ancestor on
+        // max_level could not be selected. on serial triangulations, all
+        // cells are locally owned and the ancestor is always selected
+        if (cell->is_active() == false || cell->is_locally_owned() == false ||
+            dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+              &cell->get_triangulation()) == nullptr)
+          return false;
+
+        cell_iterator ancestor = cell;
+        while (static_cast<unsigned int>(ancestor->level()) > max_level)
+          ancestor = ancestor->parent();
+        return !(*all_descendants_owned)[ancestor->index()];
+      }
+  };
+
+  set_cell_selection(FilteredIterator<cell_iterator>(predicate));
+
+  const FirstCellFunctionType filtered_first_cell = first_cell_function;
+  first_cell_function =
+    [max_level, all_descendants_owned, filtered_first_cell](
+      const Triangulation<dim, spacedim> &triangulation) {
+      all_descendants_owned->clear();
+      if (max_level < triangulation.n_levels())
+        {
+          all_descendants_owned->resize(triangulation.n_raw_cells(max_level),
+                                        true);
+          for (const auto &cell : triangulation.active_cell_iterators())
+            if (static_cast<unsigned int>(cell->level()) >= max_level &&
+                cell->is_locally_owned() == false)
+              {
+                cell_iterator ancestor = cell;
+                while (static_cast<unsigned int>(ancestor->level()) >
+                       max_level)
+                  ancestor = ancestor->parent();
+                (*all_descendants_owned)[ancestor->index()] = false;
+              }
+        }
+      return filtered_first_cell(triangulation);
+    };
+}
+
+
+
 template <int dim, int spacedim>
 std::pair<typename DataOut<dim, spacedim>::FirstCellFunctionType,
           typename DataOut<dim, spacedim>::NextCellFunctionType>
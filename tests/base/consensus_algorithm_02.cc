@@ -0,0 +1,107 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+// Test ConsensusAlgorithms::neighbor_graph(): the communication pattern is
+// set up by the first exchange, re-used as long as the targets do not change,
+// and set up again when the targets change on one of the processes.
+
+#include <deal.II/base/mpi_consensus_algorithms.h>
+
+#include "../tests.h"
+
+
+void
+exchange(Utilities::MPI::ConsensusAlgorithms::NeighborGraphCache &cache,
+         const std::vector<unsigned int>                          &targets,
+         const unsigned int                                        round,
+         const MPI_Comm                                            comm)
+{
+  const unsigned int my_rank = Utilities::MPI::this_mpi_process(comm);
+
+  using T1 = std::vector<unsigned int>;
+  using T2 = std::vector<unsigned int>;
+
+  const auto sources =
+    Utilities::MPI::ConsensusAlgorithms::neighbor_graph<T1, T2>(
+      cache,
+      targets,
+      /* create_request: */
+      [my_rank, round](const unsigned int target) {
+        return T1({my_rank, target, round});
+      },
+      /* answer_request: */
+      [my_rank](const unsigned int other_rank, const T1 &request) {
+        AssertDimension(other_rank, request[0]);
+        AssertDimension(my_rank, request[1]);
+        return T2({my_rank, request[2] * 10});
+      },
+      /* process_answer: */
+      [&](const unsigned int other_rank, const T2 &answer) {
+        AssertDimension(other_rank, answer[0]);
+        deallog << "answer from " << other_rank << ": " << answer[1]
+                << std::endl;
+      },
+      comm);
+
+  deallog << "sources:";
+  for (const auto &i : sources)
+    deallog << ' ' << i;
+  deallog << std::endl;
+
+  const auto &statistics = cache.get_statistics();
+  deallog << "setups: " << statistics.n_setups
+          << ", reuses: " << statistics.n_reuses << std::endl;
+}
+
+
+
+void
+test(const MPI_Comm comm)
+{
+  const unsigned int my_rank = Utilities::MPI::this_mpi_process(comm);
+  const unsigned int n_procs = Utilities::MPI::n_mpi_processes(comm);
+
+  Utilities::MPI::ConsensusAlgorithms::NeighborGraphCache cache;
+
+  // send to the next process, three times
+  const std::vector<unsigned int> targets = {(my_rank + 1) % n_procs};
+  for (unsigned int round = 0; round < 3; ++round)
+    exchange(cache, targets, round, comm);
+
+  // change the targets on the first process only, which requires all
+  // processes to set up the pattern again
+  std::vector<unsigned int> new_targets = targets;
+  if (my_rank == 0 && n_procs > 2)
+    new_targets.push_back(n_procs - 1);
+  for (unsigned int round = 3; round < 5; ++round)
+    exchange(cache, new_targets, round, comm);
+
+  if (n_procs > 1)
+    deallog << "estimated time saved is finite: "
+            << std::isfinite(cache.get_statistics().estimated_time_saved())
+            << std::endl;
+}
+
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  test(MPI_COMM_WORLD);
+}
@@ -0,0 +1,176 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+
+// test the queries of IndexSet for sets with many short ranges, for which a
+// bitmap is set up, the batched version of index_within_set(), and the set
+// operations for sets with so many ranges that they are split into chunks
+
+#include <deal.II/base/index_set.h>
+
+#include <algorithm>
+#include <iterator>
+
+#include "../tests.h"
+
+
+// a set with many short ranges separated by short gaps
+IndexSet
+create_fragmented_set(const types::global_dof_index size,
+                      const unsigned int            period,
+                      const unsigned int            shift)
+{
+  IndexSet set(size);
+  for (types::global_dof_index i = shift; i + period <= size; i += period)
+    set.add_range(i, i + 1 + (i / period) % (period - 1));
+  set.compress();
+  return set;
+}
+
+
+
+// compare is_element() and index_within_set() against the elements of the set
+void
+check_queries(const IndexSet &set)
+{
+  const std::vector<types::global_dof_index> elements = set.get_index_vector();
+
+  bool                    ok = true;
+  types::global_dof_index n  = 0;
+  for (types::global_dof_index i = 0; i < set.size(); ++i)
+    {
+      const bool is_element = n < elements.size() && elements[n] == i;
+      if (set.is_element(i) != is_element)
+        ok = false;
+      if (set.index_within_set(i) !=
+          (is_element ? n : numbers::invalid_dof_index))
+        ok = false;
+      if (is_element)
+        ++n;
+    }
+  deallog << "n_elements " << set.n_elements() << ", n_intervals "
+          << set.n_intervals() << ", queries " << (ok ? "OK" : "FAILED")
+          << std::endl;
+
+  // batched queries with sorted indices, including gaps and indices that are
+  // not in the set, and unsorted indices
+  std::vector<types::global_dof_index> indices;
+  for (types::global_dof_index i = 0; i < set.size(); i += 1 + i % 7)
+    indices.push_back(i);
+  std::vector<types::global_dof_index> local_indices;
+  set.index_within_set(indices, local_indices);
+  ok = local_indices.size() == indices.size();
+  for (unsigned int i = 0; i < indices.size(); ++i)
+    if (local_indices[i] != set.index_within_set(indices[i]))
+      ok = false;
+  deallog << "batched sorted queries " << (ok ? "OK" : "FAILED") << std::endl;
+
+  std::reverse(indices.begin(), indices.end());
+  std::rotate(indices.begin(),
+              indices.begin() + indices.size() / 3,
+              indices.end());
+  set.index_within_set(indices, local_indices);
+  ok = local_indices.size() == indices.size();
+  for (unsigned int i = 0; i < indices.size(); ++i)
+    if (local_indices[i] != set.index_within_set(indices[i]))
+      ok = false;
+  deallog << "batched unsorted queries " << (ok ? "OK" : "FAILED")
+          << std::endl;
+}
+
+
+
+void
+check_result(const std::string                          &name,
+             const IndexSet                             &result,
+             const std::vector<types::global_dof_index> &reference)
+{
+  deallog << name << ": " << result.n_elements() << " elements, "
+          << (result.get_index_vector() == reference ? "OK" : "FAILED")
+          << std::endl;
+}
+
+
+
+void
+test()
+{
+  const types::global_dof_index size = 200000;
+
+  deallog << "Dense set:" << std::endl;
+  const IndexSet dense = create_fragmented_set(size, 10, 3);
+  check_queries(dense);
+
+  deallog << "Sparse set:" << std::endl;
+  const IndexSet sparse = create_fragmented_set(size, 1000, 5);
+  check_queries(sparse);
+
+  deallog << "Set operations:" << std::endl;
+  const IndexSet other = create_fragmented_set(size, 7, 0);
+  const std::vector<types::global_dof_index> a = dense.get_index_vector();
+  const std::vector<types::global_dof_index> b = other.get_index_vector();
+
+  std::vector<types::global_dof_index> reference;
+  std::set_intersection(
+    a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(reference));
+  check_result("intersection", dense & other, reference);
+
+  reference.clear();
+  std::set_difference(
+    a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(reference));
+  IndexSet difference = dense;
+  difference.subtract_set(other);
+  check_result("difference", difference, reference);
+  check_queries(difference);
+
+  reference.clear();
+  std::set_union(
+    a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(reference));
+  IndexSet union_set = dense;
+  union_set.add_indices(other);
+  check_result("union", union_set, reference);
+
+  // union with an offset into a set of double size
+  IndexSet shifted(2 * size);
+  shifted.add_indices(dense);
+  shifted.add_indices(other, size / 2);
+  reference = a;
+  for (const auto i : b)
+    reference.push_back(i + size / 2);
+  std::sort(reference.begin(), reference.end());
+  reference.erase(std::unique(reference.begin(), reference.end()),
+                  reference.end());
+  check_result("union with offset", shifted, reference);
+
+  // removing elements keeps the set compressed, but must be reflected in the
+  // queries
+  IndexSet popped = dense;
+  const types::global_dof_index last = popped.pop_back();
+  deallog << "pop_back: " << last << ' ' << popped.is_element(last) << ' '
+          << (popped.index_within_set(last) == numbers::invalid_dof_index)
+          << std::endl;
+  check_queries(popped);
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test();
+}
@@ -0,0 +1,140 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+// Test Utilities::pack/unpack for ArrayView objects and the in-place reading
+// of packed vectors with Utilities::unpack_view()
+
+
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/utilities.h>
+
+#include <string>
+#include <vector>
+
+#include "../tests.h"
+
+
+
+void
+test_array_view()
+{
+  std::vector<double> values(100);
+  for (unsigned int i = 0; i < values.size(); ++i)
+    values[i] = 0.5 * i;
+
+  // an ArrayView is packed like the vector it points to, with and without
+  // compression
+  const std::vector<char> packed_view =
+    Utilities::pack(make_array_view(values), false);
+  const std::vector<char> packed_vector = Utilities::pack(values, false);
+  deallog << "ArrayView packed like vector: "
+          << (packed_view == packed_vector ? "OK" : "Failed") << std::endl;
+
+  const auto unpacked = Utilities::unpack<std::vector<double>>(packed_view,
+                                                               false);
+  deallog << "ArrayView unpacked as vector: "
+          << (unpacked == values ? "OK" : "Failed") << std::endl;
+
+  const std::vector<char> compressed_view =
+    Utilities::pack(make_array_view(values), true);
+  deallog << "ArrayView packed like vector with compression: "
+          << (compressed_view == Utilities::pack(values, true) &&
+                  Utilities::unpack<std::vector<double>>(compressed_view,
+                                                         true) == values ?
+                "OK" :
+                "Failed")
+          << std::endl;
+
+  const ArrayView<const double> view =
+    Utilities::unpack_view<double>(packed_vector.cbegin(),
+                                   packed_vector.cend());
+  deallog << "unpack_view points into buffer: "
+          << (static_cast<const void *>(view.data()) >
+                  static_cast<const void *>(packed_vector.data()) &&
+                view.end() ==
+                  reinterpret_cast<const double *>(packed_vector.data() +
+                                                   packed_vector.size()) ?
+                "OK" :
+                "Failed")
+          << std::endl;
+  deallog << "unpack_view elements: "
+          << (std::vector<double>(view.begin(), view.end()) == values ?
+                "OK" :
+                "Failed")
+          << std::endl;
+
+  // an empty view
+  const std::vector<char> packed_empty =
+    Utilities::pack(ArrayView<const double>(), false);
+  deallog << "empty view: "
+          << Utilities::unpack_view<double>(packed_empty.cbegin(),
+                                            packed_empty.cend())
+               .size()
+          << std::endl;
+}
+
+
+
+void
+test_append()
+{
+  // append several vectors of different length to the same buffer and read
+  // them back in place
+  std::vector<char>             buffer;
+  std::vector<std::size_t>      offsets(1, 0);
+  std::vector<std::vector<int>> vectors;
+  for (unsigned int i = 0; i < 5; ++i)
+    {
+      vectors.emplace_back(3 * i);
+      for (unsigned int j = 0; j < vectors.back().size(); ++j)
+        vectors.back()[j] = 10 * i + j;
+      offsets.push_back(offsets.back() +
+                        Utilities::pack(vectors.back(), buffer, false));
+    }
+
+  bool ok = true;
+  for (unsigned int i = 0; i < vectors.size(); ++i)
+    {
+      const ArrayView<const int> view =
+        Utilities::unpack_view<int>(buffer.cbegin() + offsets[i],
+                                    buffer.cbegin() + offsets[i + 1]);
+      if (std::vector<int>(view.begin(), view.end()) != vectors[i])
+        ok = false;
+    }
+  deallog << "appended vectors: " << (ok ? "OK" : "Failed") << std::endl;
+
+  // vectors of vectors
+  std::vector<char> nested_buffer;
+  Utilities::pack(vectors, nested_buffer, false);
+  deallog << "vector of vectors: "
+          << (Utilities::unpack<std::vector<std::vector<int>>>(nested_buffer,
+                                                                false) ==
+                  vectors ?
+                "OK" :
+                "Failed")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test_array_view();
+  test_append();
+}
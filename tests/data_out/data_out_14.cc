@@ -0,0 +1,138 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+// DataOut::build_patches() re-uses the patches of a previous call. Check that
+// calling it repeatedly on the same object, with changing numbers of
+// subdivisions, curved cell regions, and cell selections, gives the same
+// patches as a freshly created DataOut object.
+
+#include <deal.II/base/function_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/numerics/data_out.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include <tuple>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+build(DataOut<dim>                                  &data_out,
+      const Mapping<dim>                            &mapping,
+      const unsigned int                             n_subdivisions,
+      const typename DataOut<dim>::CurvedCellRegion curved_region,
+      const bool                                     select_cells)
+{
+  if (select_cells)
+    data_out.set_cell_selection(
+      [](const typename Triangulation<dim>::cell_iterator &cell) {
+        return (cell->is_active() && cell->center()[0] > 0);
+      });
+  else
+    data_out.set_cell_selection(
+      [](const typename Triangulation<dim>::cell_iterator &cell) {
+        return cell->is_active();
+      });
+
+  data_out.build_patches(mapping, n_subdivisions, curved_region);
+}
+
+
+
+template <int dim>
+void
+check()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_ball(tria);
+  tria.refine_global(1);
+  tria.begin_active()->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  const FE_Q<dim>     fe(2);
+  const MappingQ<dim> mapping(2);
+  DoFHandler<dim>     dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  Vector<double> solution(dof_handler.n_dofs());
+  VectorTools::interpolate(mapping,
+                           dof_handler,
+                           Functions::SquareFunction<dim>(),
+                           solution);
+
+  DataOut<dim> data_out_reused;
+  data_out_reused.attach_dof_handler(dof_handler);
+  data_out_reused.add_data_vector(solution, "solution");
+
+  // the number of points per patch decreases and increases again between
+  // the calls, and so does the number of patches
+  const std::vector<std::tuple<unsigned int,
+                               typename DataOut<dim>::CurvedCellRegion,
+                               bool>>
+    settings = {{2, DataOut<dim>::curved_inner_cells, false},
+                {1, DataOut<dim>::no_curved_cells, false},
+                {3, DataOut<dim>::curved_boundary, false},
+                {2, DataOut<dim>::curved_inner_cells, true},
+                {2, DataOut<dim>::no_curved_cells, false}};
+
+  for (const auto &setting : settings)
+    {
+      build(data_out_reused,
+            mapping,
+            std::get<0>(setting),
+            std::get<1>(setting),
+            std::get<2>(setting));
+
+      DataOut<dim> data_out;
+      data_out.attach_dof_handler(dof_handler);
+      data_out.add_data_vector(solution, "solution");
+      build(data_out,
+            mapping,
+            std::get<0>(setting),
+            std::get<1>(setting),
+            std::get<2>(setting));
+
+      deallog << "subdivisions " << std::get<0>(setting)
+              << ", curved region " << std::get<1>(setting)
+              << ", cell selection " << std::get<2>(setting)
+              << ", patches agree: "
+              << (data_out_reused.get_patches() == data_out.get_patches())
+              << std::endl;
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  check<2>();
+  check<3>();
+}
@@ -0,0 +1,125 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+// Test DataOut::set_cell_selection() with a maximal level, on which finer
+// cells are collapsed into their ancestors, and with a region of interest
+
+#include <deal.II/base/bounding_box.h>
+#include <deal.II/base/function.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/numerics/data_out.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+check_patches(DataOut<dim> &data_out, const Function<dim> &function)
+{
+  data_out.build_patches();
+
+  // the interpolation of a linear function to coarser cells is exact, so
+  // the values at the vertices of each patch must match the function
+  double max_error = 0;
+  for (const auto &patch : data_out.get_patches())
+    for (const unsigned int v : GeometryInfo<dim>::vertex_indices())
+      max_error = std::max(max_error,
+                           std::abs(patch.data(0, v) -
+                                    function.value(patch.vertices[v])));
+
+  deallog << data_out.get_patches().size()
+          << " patches, values exact: " << (max_error < 1e-12) << std::endl;
+}
+
+
+
+template <int dim>
+void
+check()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(3);
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->center()[0] > 0.875 && cell->center()[1] > 0.875)
+      cell->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  FE_Q<dim>       fe(1);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  const ScalarFunctionFromFunctionObject<dim> function(
+    [](const Point<dim> &p) {
+      double value = 0.5;
+      for (unsigned int d = 0; d < dim; ++d)
+        value += (d + 1.) * p[d];
+      return value;
+    });
+
+  Vector<double> solution(dof_handler.n_dofs());
+  VectorTools::interpolate(dof_handler, function, solution);
+
+  DataOut<dim> data_out;
+  data_out.attach_dof_handler(dof_handler);
+  data_out.add_data_vector(solution, "solution");
+
+  deallog << "all active cells: ";
+  check_patches(data_out, function);
+
+  deallog << "collapsed to level 3: ";
+  data_out.set_cell_selection(3);
+  check_patches(data_out, function);
+
+  deallog << "collapsed to level 2: ";
+  data_out.set_cell_selection(2);
+  check_patches(data_out, function);
+
+  Point<dim> upper_corner;
+  for (unsigned int d = 0; d < dim; ++d)
+    upper_corner[d] = 0.3;
+  const BoundingBox<dim> region(std::make_pair(Point<dim>(), upper_corner));
+
+  deallog << "region of interest: ";
+  data_out.set_cell_selection(numbers::invalid_unsigned_int, region);
+  check_patches(data_out, function);
+
+  deallog << "collapsed to level 1 in region of interest: ";
+  data_out.set_cell_selection(1, region);
+  check_patches(data_out, function);
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  check<2>();
+  check<3>();
+}
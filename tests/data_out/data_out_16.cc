@@ -0,0 +1,141 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+// Test DataOut::set_cell_selection() with a maximal level on a parallel
+// triangulation, where the active descendants of some cells on that level
+// are owned by different processes. These ancestors must not be output;
+// instead each process outputs its locally owned descendants, such that
+// the patches of all processes cover the domain exactly once.
+
+#include <deal.II/base/function.h>
+
+#include <deal.II/distributed/shared_tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/numerics/data_out.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+check_patches(DataOut<dim> &data_out, const Function<dim> &function)
+{
+  data_out.build_patches();
+
+  double max_error = 0, covered_measure = 0;
+  for (const auto &patch : data_out.get_patches())
+    {
+      for (const unsigned int v : GeometryInfo<dim>::vertex_indices())
+        max_error = std::max(max_error,
+                             std::abs(patch.data(0, v) -
+                                      function.value(patch.vertices[v])));
+
+      double measure = 1;
+      for (unsigned int d = 0; d < dim; ++d)
+        measure *= patch.vertices[1 << d][d] - patch.vertices[0][d];
+      covered_measure += measure;
+    }
+
+  deallog << data_out.get_patches().size()
+          << " patches, values exact: " << (max_error < 1e-12)
+          << ", domain covered once: "
+          << (std::abs(Utilities::MPI::sum(covered_measure, MPI_COMM_WORLD) -
+                       1.) < 1e-12)
+          << std::endl;
+}
+
+
+
+template <int dim>
+void
+check()
+{
+  // assign the cells left of x=0.375 to process 0 and the others to
+  // process 1, such that the cells on levels 1 and 2 that contain this
+  // plane have descendants on both processes
+  parallel::shared::Triangulation<dim> tria(
+    MPI_COMM_WORLD,
+    Triangulation<dim>::none,
+    false,
+    parallel::shared::Triangulation<dim>::partition_custom_signal);
+  tria.signals.post_refinement.connect([&tria]() {
+    for (const auto &cell : tria.active_cell_iterators())
+      cell->set_subdomain_id(cell->center()[0] < 0.375 ? 0 : 1);
+  });
+
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(3);
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->center()[0] > 0.25 && cell->center()[0] < 0.5 &&
+        cell->center()[1] < 0.25)
+      cell->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  FE_Q<dim>       fe(1);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  const ScalarFunctionFromFunctionObject<dim> function(
+    [](const Point<dim> &p) {
+      double value = 0.5;
+      for (unsigned int d = 0; d < dim; ++d)
+        value += (d + 1.) * p[d];
+      return value;
+    });
+
+  Vector<double> solution(dof_handler.n_dofs());
+  VectorTools::interpolate(dof_handler, function, solution);
+
+  DataOut<dim> data_out;
+  data_out.attach_dof_handler(dof_handler);
+  data_out.add_data_vector(solution, "solution");
+
+  deallog << "all active cells: ";
+  check_patches(data_out, function);
+
+  for (const unsigned int level : {3, 2, 1, 0})
+    {
+      deallog << "collapsed to level " << level << ": ";
+      data_out.set_cell_selection(level);
+      check_patches(data_out, function);
+    }
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    log;
+
+  deallog.push("2d");
+  check<2>();
+  deallog.pop();
+  deallog.push("3d");
+  check<3>();
+  deallog.pop();
+}
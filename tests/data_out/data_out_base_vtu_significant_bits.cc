@@ -0,0 +1,82 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+// Check that DataOutBase::VtkFlags::n_significant_bits rounds the data
+// fields written by DataOutBase::write_vtu(), but not the point coordinates
+
+#include <deal.II/base/data_out_base.h>
+
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "../tests.h"
+
+
+
+void
+check(const unsigned int n_significant_bits, std::ostream &out)
+{
+  DataOutBase::Patch<2, 2> patch;
+  patch.reference_cell = ReferenceCells::Quadrilateral;
+  patch.vertices[0]    = Point<2>(0, 0);
+  patch.vertices[1]    = Point<2>(1. / 3., 0);
+  patch.vertices[2]    = Point<2>(0, 1. / 3.);
+  patch.vertices[3]    = Point<2>(1. / 3., 1. / 3.);
+  patch.patch_index    = 0;
+
+  // one scalar field and one vector field
+  patch.data.reinit(3, 4);
+  const double values[4] = {1. / 3., -2. / 3., 1.2345678e-3, 12345.678};
+  for (unsigned int i = 0; i < 4; ++i)
+    {
+      patch.data(0, i) = values[i];
+      patch.data(1, i) = -values[i];
+      patch.data(2, i) = 10. * values[i];
+    }
+  // infinite values are left unchanged
+  patch.data(0, 3) = std::numeric_limits<float>::infinity();
+
+  const std::vector<DataOutBase::Patch<2, 2>> patches(1, patch);
+  const std::vector<std::string>              names = {"s", "v", "v"};
+  const std::vector<
+    std::tuple<unsigned int,
+               unsigned int,
+               std::string,
+               DataComponentInterpretation::DataComponentInterpretation>>
+    vectors = {std::make_tuple(
+      1, 2, "v", DataComponentInterpretation::component_is_part_of_vector)};
+
+  DataOutBase::VtkFlags flags;
+  flags.print_date_and_time = false;
+  flags.compression_level   = DataOutBase::CompressionLevel::plain_text;
+  flags.n_significant_bits  = n_significant_bits;
+
+  out << "n_significant_bits = " << n_significant_bits << std::endl;
+  out << std::setprecision(10);
+  DataOutBase::write_vtu(patches, names, vectors, flags, out);
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  for (const unsigned int n_bits : {24, 11, 4, 1})
+    check(n_bits, deallog.get_file_stream());
+}
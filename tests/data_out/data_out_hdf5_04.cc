@@ -0,0 +1,125 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+// Write a time series with DataOutInterface::write_hdf5_time_step(), which
+// writes the mesh only once and the data of each time step into a separate
+// group of the same HDF5 file, and check the XDMF file and the data read
+// back from the HDF5 file. When run on several processes, each process
+// contributes the same patches.
+
+#include <deal.II/base/data_out_base.h>
+#include <deal.II/base/hdf5.h>
+
+#include <deal.II/lac/full_matrix.h>
+
+#include <string>
+#include <vector>
+
+#include "../tests.h"
+
+#include "patches.h"
+
+
+
+std::vector<DataOutBase::Patch<2, 2>> patches;
+std::vector<std::string>              names;
+
+class DataOutX : public DataOutInterface<2, 2>
+{
+  virtual const std::vector<::DataOutBase::Patch<2, 2>> &
+  get_patches() const override
+  {
+    return patches;
+  }
+
+  virtual std::vector<std::string>
+  get_dataset_names() const override
+  {
+    return names;
+  }
+};
+
+
+
+void
+test()
+{
+  patches.resize(4);
+  create_patches(patches);
+  names = {"x1", "x2", "x3", "x4", "i"};
+
+  const std::vector<DataOutBase::Patch<2, 2>> initial_patches = patches;
+
+  DataOutX               data_out;
+  std::vector<XDMFEntry> xdmf_entries;
+  const unsigned int     n_steps = 3;
+  for (unsigned int step = 0; step < n_steps; ++step)
+    {
+      // only the values change between the time steps
+      for (unsigned int p = 0; p < patches.size(); ++p)
+        for (unsigned int i = 0; i < patches[p].data.n_rows(); ++i)
+          for (unsigned int j = 0; j < patches[p].data.n_cols(); ++j)
+            patches[p].data(i, j) =
+              (step + 1.) * initial_patches[p].data(i, j);
+
+      DataOutBase::DataOutFilter data_filter(
+        DataOutBase::DataOutFilterFlags(false, false));
+      data_out.write_filtered_data(data_filter);
+      data_out.write_hdf5_time_step(data_filter,
+                                    "out.h5",
+                                    step,
+                                    MPI_COMM_WORLD);
+      xdmf_entries.push_back(data_out.create_xdmf_time_step_entry(
+        data_filter, "out.h5", step, 0.5 * step, MPI_COMM_WORLD));
+    }
+
+  data_out.write_xdmf_file(xdmf_entries, "out.xdmf", MPI_COMM_WORLD);
+  if (Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) != 0)
+    return;
+
+  cat_file("out.xdmf");
+
+  // read the data back: the mesh is stored only once, and the values of
+  // all time steps are multiples of the ones of the first step
+  HDF5::File file("out.h5", HDF5::File::FileAccessMode::open);
+  deallog << "nodes: " << file.open_dataset("nodes").get_dimensions()[0]
+          << ", cells: " << file.open_dataset("cells").get_dimensions()[0]
+          << std::endl;
+
+  const FullMatrix<double> first_values =
+    file.open_group("step_000000").open_dataset("i").read<FullMatrix<double>>();
+  for (unsigned int step = 0; step < n_steps; ++step)
+    {
+      FullMatrix<double> values = file.open_group("step_00000" +
+                                                  std::to_string(step))
+                                    .open_dataset("i")
+                                    .read<FullMatrix<double>>();
+      values.add(-(step + 1.), first_values);
+      deallog << "step " << step << ": values OK: "
+              << (values.frobenius_norm() < 1e-12) << std::endl;
+    }
+}
+
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    log;
+
+  test();
+}
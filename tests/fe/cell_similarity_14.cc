@@ -0,0 +1,210 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+
+// Check that FEValues reuses the derivatives of the shape functions on cells
+// that are translated and scaled copies of a cell visited before, by
+// comparing against an FEValues object that does not check for cell
+// similarity. The cells are visited in an order in which cells of different
+// sizes alternate. Also check the statistics on cell similarities of FEValues
+// and hp::FEValues.
+
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/mapping_cartesian.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/hp/fe_collection.h>
+#include <deal.II/hp/fe_values.h>
+
+#include <algorithm>
+
+#include "../tests.h"
+
+
+
+// a mesh with cells of three different sizes
+template <int dim>
+void
+create_mesh(Triangulation<dim> &tria)
+{
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(1);
+  for (unsigned int i = 0; i < 2; ++i)
+    {
+      tria.begin_active()->set_refine_flag();
+      tria.execute_coarsening_and_refinement();
+    }
+}
+
+
+
+template <int dim>
+void
+print_statistics(
+  const typename FEValuesBase<dim>::CellSimilarityStatistics &statistics)
+{
+  deallog << "cells: " << statistics.n_cells
+          << ", translations: " << statistics.n_translations
+          << ", scaled translations: " << statistics.n_scaled_translations
+          << std::endl;
+}
+
+
+
+template <int dim>
+void
+test(const Mapping<dim> &mapping, const FiniteElement<dim> &fe)
+{
+  Triangulation<dim> tria;
+  create_mesh(tria);
+
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  const UpdateFlags flags = update_gradients | update_hessians |
+                            update_3rd_derivatives | update_JxW_values;
+  const QGauss<dim> quadrature(fe.degree + 1);
+
+  FEValues<dim> fe_values(mapping, fe, quadrature, flags);
+  fe_values.always_allow_check_for_cell_similarity(true);
+  FEValues<dim> reference(mapping, fe, quadrature, flags);
+  reference.always_allow_check_for_cell_similarity(false);
+
+  // visit the cells sorted by the coordinates of their centers, such that
+  // cells of different sizes alternate
+  std::vector<typename DoFHandler<dim>::active_cell_iterator> cells;
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    cells.push_back(cell);
+  std::sort(cells.begin(), cells.end(), [](const auto &a, const auto &b) {
+    const Point<dim> center_a = a->center(), center_b = b->center();
+    return std::lexicographical_compare(center_a.begin_raw(),
+                                        center_a.end_raw(),
+                                        center_b.begin_raw(),
+                                        center_b.end_raw());
+  });
+
+  // compare relative to the size of the derivatives on the smallest cells
+  const double h = 0.125;
+
+  bool ok = true;
+  for (const auto &cell : cells)
+    {
+      fe_values.reinit(cell);
+      reference.reinit(cell);
+
+      for (const unsigned int q : fe_values.quadrature_point_indices())
+        {
+          if (std::abs(fe_values.JxW(q) - reference.JxW(q)) > 1e-12)
+            ok = false;
+          for (const unsigned int i : fe_values.dof_indices())
+            for (unsigned int c = 0; c < fe.n_components(); ++c)
+              {
+                if ((fe_values.shape_grad_component(i, q, c) -
+                     reference.shape_grad_component(i, q, c))
+                      .norm() > 1e-10 / h)
+                  ok = false;
+                if ((fe_values.shape_hessian_component(i, q, c) -
+                     reference.shape_hessian_component(i, q, c))
+                      .norm() > 1e-10 / (h * h))
+                  ok = false;
+                if ((fe_values.shape_3rd_derivative_component(i, q, c) -
+                     reference.shape_3rd_derivative_component(i, q, c))
+                      .norm() > 1e-10 / (h * h * h))
+                  ok = false;
+              }
+        }
+    }
+
+  deallog << fe.get_name() << ": values agree: " << ok << std::endl;
+  print_statistics<dim>(fe_values.get_cell_similarity_statistics());
+  print_statistics<dim>(reference.get_cell_similarity_statistics());
+}
+
+
+
+template <int dim>
+void
+test_hp()
+{
+  Triangulation<dim> tria;
+  create_mesh(tria);
+
+  hp::FECollection<dim> fe_collection(FE_Q<dim>(1), FE_Q<dim>(2));
+
+  DoFHandler<dim> dof_handler(tria);
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    cell->set_active_fe_index(cell->level() % 2);
+  dof_handler.distribute_dofs(fe_collection);
+
+  hp::QCollection<dim> q_collection(QGauss<dim>(2), QGauss<dim>(3));
+
+  // the check for cell similarity is enabled because main() limits the
+  // number of threads to one
+  hp::FEValues<dim> hp_fe_values(fe_collection,
+                                 q_collection,
+                                 update_gradients);
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    hp_fe_values.reinit(cell);
+
+  deallog << "hp: ";
+  print_statistics<dim>(hp_fe_values.get_cell_similarity_statistics());
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  deallog.push(std::to_string(dim) + "d");
+
+  deallog.push("MappingQ");
+  test(MappingQ<dim>(1), FE_Q<dim>(2));
+  test(MappingQ<dim>(1), FE_DGQ<dim>(3));
+  test(MappingQ<dim>(1), FESystem<dim>(FE_Q<dim>(2), dim));
+  deallog.pop();
+
+  deallog.push("MappingCartesian");
+  test(MappingCartesian<dim>(), FE_Q<dim>(2));
+  deallog.pop();
+
+  test_hp<dim>();
+
+  deallog.pop();
+}
+
+
+
+int
+main()
+{
+  initlog();
+  MultithreadInfo::set_thread_limit(1);
+
+  test<2>();
+  test<3>();
+}
@@ -0,0 +1,143 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+// check the joint dof indices and the map to the local dof indices of the
+// two cells that FEInterfaceValues sets up in reinit(), on a mesh with
+// hanging nodes, for continuous and discontinuous elements, against a
+// simple implementation with std::map
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_interface_values.h>
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <map>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+test(const FiniteElement<dim> &fe)
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(2);
+  tria.begin_active()->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  FEInterfaceValues<dim> fiv(fe,
+                             QGauss<dim - 1>(fe.degree + 1),
+                             update_values);
+
+  std::vector<types::global_dof_index> dof_indices(fe.n_dofs_per_cell());
+  std::vector<types::global_dof_index> dof_indices_neighbor(
+    fe.n_dofs_per_cell());
+
+  bool         ok      = true;
+  unsigned int n_faces = 0;
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    for (const unsigned int f : cell->face_indices())
+      {
+        if (cell->at_boundary(f))
+          continue;
+
+        const auto neighbor = cell->neighbor(f);
+        if (cell->neighbor_is_coarser(f))
+          {
+            // use the subface of the coarser neighbor
+            const auto [neighbor_face_no, neighbor_subface_no] =
+              cell->neighbor_of_coarser_neighbor(f);
+            fiv.reinit(cell,
+                       f,
+                       numbers::invalid_unsigned_int,
+                       neighbor,
+                       neighbor_face_no,
+                       neighbor_subface_no);
+          }
+        else if (!cell->face(f)->has_children() &&
+                 neighbor->index() > cell->index())
+          fiv.reinit(cell,
+                     f,
+                     numbers::invalid_unsigned_int,
+                     neighbor,
+                     cell->neighbor_of_neighbor(f),
+                     numbers::invalid_unsigned_int);
+        else
+          continue;
+        ++n_faces;
+
+        // the reference: the same map as set up by FEInterfaceValues before
+        // it used a sorted array
+        cell->get_dof_indices(dof_indices);
+        neighbor->get_dof_indices(dof_indices_neighbor);
+        std::map<types::global_dof_index, std::array<unsigned int, 2>>
+          reference;
+        for (unsigned int i = 0; i < dof_indices.size(); ++i)
+          reference
+            .emplace(dof_indices[i],
+                     std::array<unsigned int, 2>{
+                       {numbers::invalid_unsigned_int,
+                        numbers::invalid_unsigned_int}})
+            .first->second[0] = i;
+        for (unsigned int i = 0; i < dof_indices_neighbor.size(); ++i)
+          reference
+            .emplace(dof_indices_neighbor[i],
+                     std::array<unsigned int, 2>{
+                       {numbers::invalid_unsigned_int,
+                        numbers::invalid_unsigned_int}})
+            .first->second[1] = i;
+
+        if (fiv.n_current_interface_dofs() != reference.size())
+          ok = false;
+        else
+          {
+            unsigned int i = 0;
+            for (const auto &[dof_index, local_indices] : reference)
+              {
+                if (fiv.get_interface_dof_indices()[i] != dof_index ||
+                    fiv.interface_dof_to_dof_indices(i) != local_indices)
+                  ok = false;
+                ++i;
+              }
+          }
+      }
+
+  deallog << fe.get_name() << ": checked faces: " << (n_faces > 0)
+          << ", interface dofs agree: " << ok << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+  test<2>(FE_Q<2>(2));
+  test<2>(FE_DGQ<2>(1));
+  test<3>(FE_Q<3>(2));
+  test<3>(FE_DGQ<3>(1));
+}
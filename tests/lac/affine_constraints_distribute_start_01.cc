@@ -0,0 +1,115 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+// check AffineConstraints::distribute_start() and distribute_finish() against
+// distribute() for constraints that depend on locally owned and on remote
+// elements, re-using the temporary ghosted vector in a second call. Between
+// the two calls, a difference quotient is computed on another vector whose
+// ghost values are exchanged at the same time as those of the split
+// distribute.
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include "../tests.h"
+
+
+void
+test()
+{
+  const unsigned int my_id   = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+  const unsigned int n_procs = Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+
+  const types::global_dof_index n_local = 4;
+  const types::global_dof_index size    = n_local * n_procs;
+
+  IndexSet owned(size);
+  owned.add_range(my_id * n_local, (my_id + 1) * n_local);
+
+  // the second element depends on owned elements only, the last one on the
+  // first element of the next process
+  const types::global_dof_index next = ((my_id + 1) * n_local) % size;
+  IndexSet                      relevant = owned;
+  relevant.add_index(next);
+
+  AffineConstraints<double> constraints(owned, relevant);
+  constraints.add_line(my_id * n_local + 1);
+  constraints.add_entry(my_id * n_local + 1, my_id * n_local, 0.5);
+  constraints.add_entry(my_id * n_local + 1, my_id * n_local + 2, 0.5);
+  constraints.add_line(my_id * n_local + 3);
+  constraints.add_entry(my_id * n_local + 3, next, 2.);
+  constraints.set_inhomogeneity(my_id * n_local + 3, 1.);
+  constraints.close();
+
+  LinearAlgebra::distributed::Vector<double> reference(owned,
+                                                       MPI_COMM_WORLD);
+  LinearAlgebra::distributed::Vector<double> vec(owned, MPI_COMM_WORLD);
+  LinearAlgebra::distributed::Vector<double> ghosted_vector;
+
+  IndexSet other_ghosts(size);
+  other_ghosts.add_index(next);
+  LinearAlgebra::distributed::Vector<double> other(owned,
+                                                   other_ghosts,
+                                                   MPI_COMM_WORLD);
+  LinearAlgebra::distributed::Vector<double> differences(owned,
+                                                         MPI_COMM_WORLD);
+
+  for (unsigned int cycle = 0; cycle < 2; ++cycle)
+    {
+      for (const auto i : owned)
+        reference(i) = 1. + i + 10. * cycle;
+      vec = reference;
+
+      constraints.distribute(reference);
+
+      for (const auto i : owned)
+        other(i) = (1. + cycle) * i * i;
+
+      constraints.distribute_start(vec, ghosted_vector);
+
+      other.update_ghost_values();
+      for (const auto i : owned)
+        differences(i) = other((i + 1) % size) - other(i);
+      other.zero_out_ghost_values();
+
+      constraints.distribute_finish(vec, ghosted_vector);
+
+      deallog << "Differences:";
+      for (const auto i : owned)
+        deallog << ' ' << differences(i);
+      deallog << std::endl;
+
+      deallog << "Cycle " << cycle << ':' << std::endl;
+      for (const auto i : owned)
+        deallog << i << ": " << vec(i) << std::endl;
+
+      vec -= reference;
+      deallog << "Difference to distribute(): " << vec.linfty_norm()
+              << std::endl;
+      deallog << "Ghosted vector has ghost elements: "
+              << ghosted_vector.has_ghost_elements() << std::endl;
+    }
+}
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    log;
+
+  test();
+}
@@ -0,0 +1,164 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+// Test the exchange of ghost values of LinearAlgebra::distributed::Vector
+// through shared memory as set up by
+// Utilities::MPI::Partitioner::set_shared_memory_communicator(): the
+// processes are grouped in pairs that form the "shared-memory domains", such
+// that some neighbors are reached through shared memory and others with MPI
+// messages. The results of update_ghost_values() and compress() must match
+// the ones of a vector using MPI messages only. Vectors only use shared
+// memory if they are initialized with the shared-memory communicator of the
+// partitioner, also when reinit() is called again with the same partitioner.
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/partitioner.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include "../tests.h"
+
+using namespace dealii;
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  const unsigned int my_rank = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+  const unsigned int n_procs = Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+
+  MPI_Comm comm_sm;
+  MPI_Comm_split(MPI_COMM_WORLD, my_rank / 2, my_rank, &comm_sm);
+
+  // each process owns 10 entries and has ghosts of all other processes, one
+  // of which is also ghost on a third process
+  const unsigned int local_size = 10;
+  IndexSet           locally_owned(local_size * n_procs);
+  locally_owned.add_range(my_rank * local_size, (my_rank + 1) * local_size);
+  IndexSet ghosts(local_size * n_procs);
+  for (unsigned int p = 0; p < n_procs; ++p)
+    if (p != my_rank)
+      {
+        ghosts.add_index(p * local_size + (my_rank + 3) % local_size);
+        ghosts.add_index(p * local_size + 7);
+      }
+
+  const auto partitioner =
+    std::make_shared<Utilities::MPI::Partitioner>(locally_owned,
+                                                  ghosts,
+                                                  MPI_COMM_WORLD);
+  const auto partitioner_sm =
+    std::make_shared<Utilities::MPI::Partitioner>(locally_owned,
+                                                  ghosts,
+                                                  MPI_COMM_WORLD);
+  partitioner_sm->set_shared_memory_communicator(comm_sm);
+
+  LinearAlgebra::distributed::Vector<double> reference(partitioner);
+
+  // with the default arguments, the vector uses private memory
+  LinearAlgebra::distributed::Vector<double> vector(partitioner_sm);
+  deallog << "default uses private memory: "
+          << (vector.shared_vector_data().size() == 1 ? "OK" : "FAILED")
+          << std::endl;
+
+  // reinit with the same partitioner, now opting in to shared memory
+  vector.reinit(partitioner_sm, comm_sm);
+  deallog << "reinit() with comm_sm uses shared memory: "
+          << (vector.shared_vector_data().size() ==
+                  Utilities::MPI::n_mpi_processes(comm_sm) ?
+                "OK" :
+                "FAILED")
+          << std::endl;
+
+  const auto check = [&](const std::string &operation) {
+    bool equal = true;
+    for (unsigned int i = 0;
+         i < partitioner->locally_owned_size() + partitioner->n_ghost_indices();
+         ++i)
+      if (vector.local_element(i) != reference.local_element(i))
+        equal = false;
+    deallog << operation << ": " << (equal ? "OK" : "FAILED") << std::endl;
+  };
+
+  for (unsigned int repeat = 0; repeat < 2; ++repeat)
+    {
+      // update_ghost_values()
+      for (unsigned int i = 0; i < local_size; ++i)
+        {
+          reference.local_element(i) = 100 * (repeat + 1) * my_rank + i;
+          vector.local_element(i)    = reference.local_element(i);
+        }
+      reference.update_ghost_values();
+      vector.update_ghost_values();
+      check("update_ghost_values()");
+
+      // compress() with various operations
+      for (const auto operation : {VectorOperation::add,
+                                   VectorOperation::insert,
+                                   VectorOperation::min,
+                                   VectorOperation::max})
+        {
+          // for insert, the ghost entries stay zero
+          reference.zero_out_ghost_values();
+          vector.zero_out_ghost_values();
+          if (operation != VectorOperation::insert)
+            for (const auto i : ghosts)
+              {
+                reference(i) = i + my_rank;
+                vector(i)    = i + my_rank;
+              }
+          reference.compress(operation);
+          vector.compress(operation);
+          check(std::string("compress(") +
+                (operation == VectorOperation::add    ? "add" :
+                 operation == VectorOperation::insert ? "insert" :
+                 operation == VectorOperation::min    ? "min" :
+                                                        "max") +
+                ")");
+        }
+    }
+
+  // a vector reinitialized from the first one uses shared memory as well
+  LinearAlgebra::distributed::Vector<double> copy;
+  copy.reinit(vector);
+  copy = vector;
+  copy.update_ghost_values();
+  vector.update_ghost_values();
+  bool equal = true;
+  for (unsigned int i = 0;
+       i < partitioner->locally_owned_size() + partitioner->n_ghost_indices();
+       ++i)
+    if (vector.local_element(i) != copy.local_element(i))
+      equal = false;
+  deallog << "reinit() from vector: " << (equal ? "OK" : "FAILED")
+          << std::endl;
+
+  // going back to private memory with the same partitioner
+  vector.reinit(partitioner_sm);
+  for (unsigned int i = 0; i < local_size; ++i)
+    vector.local_element(i) = reference.local_element(i);
+  vector.update_ghost_values();
+  reference.update_ghost_values();
+  deallog << "reinit() without comm_sm uses private memory: "
+          << (vector.shared_vector_data().size() == 1 ? "OK" : "FAILED")
+          << std::endl;
+  check("update_ghost_values() with private memory");
+
+  MPI_Comm_free(&comm_sm);
+}
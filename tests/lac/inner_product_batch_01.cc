@@ -0,0 +1,160 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+
+// Check Utilities::MPI::ReductionBatch and InnerProductBatch for parallel
+// vectors, block vectors, and serial vectors against the inner products
+// computed by the vectors themselves
+
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/lac/inner_product_batch.h>
+#include <deal.II/lac/la_parallel_block_vector.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+
+template <typename VectorType>
+void
+fill(VectorType &u, VectorType &v, VectorType &w)
+{
+  for (unsigned int i = 0; i < u.locally_owned_size(); ++i)
+    {
+      const auto index = u.get_partitioner()->local_to_global(i) % 7;
+      u.local_element(i) = 1. + index;
+      v.local_element(i) = 0.5 * index - 1.;
+      w.local_element(i) = 2. - 0.25 * index;
+    }
+}
+
+
+
+template <typename VectorType>
+void
+check(VectorType &u, const VectorType &v, const VectorType &w)
+{
+  const VectorType u_copy = u;
+
+  InnerProductBatch<VectorType> products(u);
+  const unsigned int            u_dot_v = products.inner_product(u, v);
+  const unsigned int            v_dot_w = products.inner_product(v, w);
+  const unsigned int            add_dot = products.add_and_dot(u, 2., v, w);
+  products.compute();
+
+  VectorType u_ref = u_copy;
+  deallog << "u*v: " << products[u_dot_v] << " (" << u_copy * v << ")"
+          << std::endl;
+  deallog << "v*w: " << products[v_dot_w] << " (" << v * w << ")"
+          << std::endl;
+  deallog << "add_and_dot: " << products[add_dot] << " ("
+          << u_ref.add_and_dot(2., v, w) << ")" << std::endl;
+  u_ref -= u;
+  deallog << "difference after add_and_dot: " << u_ref.l2_norm() << std::endl;
+
+  // non-blocking variant
+  InnerProductBatch<VectorType> products_nb(u);
+  const unsigned int            w_dot_w = products_nb.inner_product(w, w);
+  products_nb.compute_start();
+  products_nb.compute_finish();
+  deallog << "w*w non-blocking: " << products_nb[w_dot_w] << " (" << w * w
+          << ")" << std::endl;
+}
+
+
+
+void
+test()
+{
+  const MPI_Comm     comm    = MPI_COMM_WORLD;
+  const unsigned int my_rank = Utilities::MPI::this_mpi_process(comm);
+  const unsigned int n_procs = Utilities::MPI::n_mpi_processes(comm);
+
+  // scalar batch
+  {
+    Utilities::MPI::ReductionBatch<double> batch(comm);
+    const unsigned int                     i0 = batch.add(1.);
+    const unsigned int                     i1 = batch.add(my_rank);
+    batch.compute();
+    deallog << "ReductionBatch: " << i0 << ' ' << batch[i0] << ' ' << i1
+            << ' ' << batch[i1] << std::endl;
+
+    // sums added after a reduction are reduced by the next one, without
+    // reducing the earlier sums again
+    const unsigned int i2 = batch.add(2.);
+    batch.compute();
+    deallog << "ReductionBatch after add: " << batch[i0] << ' ' << batch[i1]
+            << ' ' << i2 << ' ' << batch[i2] << std::endl;
+    const unsigned int i3 = batch.add(my_rank + 1.);
+    batch.compute_start();
+    batch.compute_finish();
+    deallog << "ReductionBatch non-blocking after add: " << batch[i0] << ' '
+            << batch[i2] << ' ' << i3 << ' ' << batch[i3] << std::endl;
+  }
+
+  IndexSet owned(8 * n_procs);
+  owned.add_range(8 * my_rank, 8 * my_rank + 8);
+
+  {
+    deallog.push("distributed::Vector");
+    LinearAlgebra::distributed::Vector<double> u(owned, comm), v(u), w(u);
+    fill(u, v, w);
+    check(u, v, w);
+    deallog.pop();
+  }
+
+  {
+    deallog.push("distributed::BlockVector");
+    LinearAlgebra::distributed::BlockVector<double> u(2), v(2), w(2);
+    for (unsigned int b = 0; b < 2; ++b)
+      {
+        u.block(b).reinit(owned, comm);
+        v.block(b).reinit(owned, comm);
+        w.block(b).reinit(owned, comm);
+        fill(u.block(b), v.block(b), w.block(b));
+      }
+    u.collect_sizes();
+    v.collect_sizes();
+    w.collect_sizes();
+    check(u, v, w);
+    deallog.pop();
+  }
+
+  {
+    deallog.push("Vector");
+    Vector<double> u(13), v(13), w(13);
+    for (unsigned int i = 0; i < u.size(); ++i)
+      {
+        u(i) = 1. + i % 7;
+        v(i) = 0.5 * (i % 7) - 1.;
+        w(i) = 2. - 0.25 * (i % 7);
+      }
+    check(u, v, w);
+    deallog.pop();
+  }
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    log;
+
+  test();
+}
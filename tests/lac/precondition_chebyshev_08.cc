@@ -0,0 +1,130 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+// Test PreconditionChebyshev with eigenvalue estimates given from the Ritz
+// values of a CG solver and with the automatic update of the eigenvalue
+// estimates when the matrix changes between applications
+
+
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+
+double
+compute_residual(const SparseMatrix<double>                 &A,
+                 const PreconditionChebyshev<SparseMatrix<double>,
+                                             Vector<double>> &preconditioner,
+                 const Vector<double>                       &v)
+{
+  Vector<double> tmp1(v.size()), tmp2(v.size());
+  A.vmult(tmp1, v);
+  preconditioner.vmult(tmp2, tmp1);
+  tmp2 -= v;
+  return tmp2.l2_norm() / v.l2_norm();
+}
+
+
+
+int
+main()
+{
+  initlog();
+  deallog << std::setprecision(4);
+
+  const unsigned int size = 16;
+  const unsigned int dim  = (size - 1) * (size - 1);
+
+  FDMatrix        testproblem(size, size);
+  SparsityPattern structure(dim, dim, 5);
+  testproblem.five_point_structure(structure);
+  structure.compress();
+  SparseMatrix<double> A(structure);
+  testproblem.five_point(A);
+
+  Vector<double> v(dim);
+  for (unsigned int j = 0; j < dim; ++j)
+    v(j) = random_value<double>();
+
+  using Chebyshev = PreconditionChebyshev<SparseMatrix<double>, Vector<double>>;
+  Chebyshev::AdditionalData cheby_data;
+  cheby_data.degree              = 4;
+  cheby_data.smoothing_range     = 10;
+  cheby_data.eig_cg_n_iterations = 0;
+  cheby_data.max_eigenvalue      = 1.;
+
+  // Ritz values from a CG solve preconditioned by the same point-Jacobi
+  // method as the one used inside the Chebyshev iteration
+  {
+    Chebyshev cheby;
+    cheby.initialize(A, cheby_data);
+
+    Vector<double> solution(dim), rhs(dim);
+    rhs = 1.;
+    PreconditionJacobi<SparseMatrix<double>> jacobi;
+    jacobi.initialize(A);
+
+    SolverControl        control(100, 1e-8);
+    SolverCG<Vector<double>> solver(control);
+    solver.connect_eigenvalues_slot(
+      [&cheby](const std::vector<double> &eigenvalues) {
+        const auto info =
+          cheby.set_eigenvalue_estimates(eigenvalues.front(),
+                                         eigenvalues.back());
+        deallog << "Eigenvalue estimates from CG: "
+                << info.min_eigenvalue_estimate << " "
+                << info.max_eigenvalue_estimate << std::endl;
+      });
+    solver.solve(A, solution, rhs, jacobi);
+
+    deallog << "Residual with CG Ritz values: "
+            << compute_residual(A, cheby, v) << std::endl;
+  }
+
+  // scale the matrix after the first application, keeping the inverse
+  // diagonal of the Chebyshev preconditioner, which shifts the spectrum of
+  // the preconditioned matrix
+  for (const unsigned int interval : {0U, 1U})
+    {
+      SparseMatrix<double> B(structure);
+      B.copy_from(A);
+
+      cheby_data.eig_cg_n_iterations            = 20;
+      cheby_data.eigenvalue_update_interval     = interval;
+      cheby_data.eigenvalue_update_n_iterations = 8;
+
+      Chebyshev cheby;
+      cheby.initialize(B, cheby_data);
+
+      deallog << "Update interval " << interval << std::endl;
+      deallog << "Residual before scaling: " << compute_residual(B, cheby, v)
+              << std::endl;
+
+      B *= 3.;
+      for (unsigned int i = 0; i < 3; ++i)
+        deallog << "Residual after scaling:  " << compute_residual(B, cheby, v)
+                << std::endl;
+    }
+
+  return 0;
+}
@@ -0,0 +1,213 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+// Test the fused vector updates of PreconditionChebyshev for
+// LinearAlgebra::distributed::BlockVector, both with a DiagonalMatrix and
+// with a generic preconditioner, against the same operator acting on a
+// LinearAlgebra::distributed::Vector holding all blocks
+
+
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/la_parallel_block_vector.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/precondition.h>
+
+#include "../tests.h"
+
+
+const std::vector<unsigned int> block_sizes = {13, 29, 7};
+const std::vector<double>       coefficients = {1., 5., 0.3};
+
+
+
+// block-diagonal matrix with a scaled 1d Laplacian in each block, applied
+// either to a block vector or to a vector holding the blocks one after the
+// other
+class BlockLaplace : public Subscriptor
+{
+public:
+  using BlockVectorType = LinearAlgebra::distributed::BlockVector<double>;
+  using VectorType      = LinearAlgebra::distributed::Vector<double>;
+
+  types::global_dof_index
+  m() const
+  {
+    return std::accumulate(block_sizes.begin(), block_sizes.end(), 0U);
+  }
+
+  void
+  vmult(BlockVectorType &dst, const BlockVectorType &src) const
+  {
+    for (unsigned int b = 0; b < block_sizes.size(); ++b)
+      apply_block(b, dst.block(b).begin(), src.block(b).begin());
+  }
+
+  void
+  vmult(VectorType &dst, const VectorType &src) const
+  {
+    unsigned int offset = 0;
+    for (unsigned int b = 0; b < block_sizes.size(); ++b)
+      {
+        apply_block(b, dst.begin() + offset, src.begin() + offset);
+        offset += block_sizes[b];
+      }
+  }
+
+  double
+  diagonal(const unsigned int b) const
+  {
+    return 2. * coefficients[b];
+  }
+
+  // only the diagonal entries are needed by PreconditionChebyshev
+  double
+  el(const unsigned int i, const unsigned int j) const
+  {
+    AssertDimension(i, j);
+    (void)j;
+    unsigned int b = 0, offset = block_sizes[0];
+    while (i >= offset)
+      offset += block_sizes[++b];
+    return diagonal(b);
+  }
+
+private:
+  void
+  apply_block(const unsigned int b, double *dst, const double *src) const
+  {
+    const unsigned int n = block_sizes[b];
+    for (unsigned int i = 0; i < n; ++i)
+      dst[i] = coefficients[b] * (2. * src[i] - (i > 0 ? src[i - 1] : 0.) -
+                                  (i + 1 < n ? src[i + 1] : 0.));
+  }
+};
+
+
+
+// point-Jacobi method that is not a DiagonalMatrix, selecting the generic
+// path of the vector updates
+class GenericJacobi : public Subscriptor
+{
+public:
+  GenericJacobi(const DiagonalMatrix<BlockLaplace::BlockVectorType> &diagonal)
+    : diagonal(diagonal)
+  {}
+
+  void
+  vmult(BlockLaplace::BlockVectorType       &dst,
+        const BlockLaplace::BlockVectorType &src) const
+  {
+    diagonal.vmult(dst, src);
+  }
+
+private:
+  const DiagonalMatrix<BlockLaplace::BlockVectorType> &diagonal;
+};
+
+
+
+template <typename VectorType, typename PreconditionerType>
+VectorType
+apply_chebyshev(const BlockLaplace                     &matrix,
+                const std::shared_ptr<PreconditionerType> preconditioner,
+                const VectorType                        &src,
+                const bool                               use_step)
+{
+  PreconditionChebyshev<BlockLaplace, VectorType, PreconditionerType> cheby;
+  typename PreconditionChebyshev<BlockLaplace, VectorType, PreconditionerType>::
+    AdditionalData data;
+  data.degree              = 5;
+  data.smoothing_range     = 20;
+  data.eig_cg_n_iterations = 0;
+  data.max_eigenvalue      = 2.;
+  data.preconditioner      = preconditioner;
+  cheby.initialize(matrix, data);
+
+  VectorType dst(src);
+  if (use_step)
+    {
+      dst = 1.;
+      cheby.step(dst, src);
+    }
+  else
+    cheby.vmult(dst, src);
+
+  return dst;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  initlog();
+
+  BlockLaplace matrix;
+
+  LinearAlgebra::distributed::BlockVector<double> src_block(block_sizes.size());
+  for (unsigned int b = 0; b < block_sizes.size(); ++b)
+    src_block.block(b).reinit(block_sizes[b]);
+  src_block.collect_sizes();
+  for (unsigned int i = 0; i < src_block.size(); ++i)
+    src_block(i) = random_value<double>();
+
+  LinearAlgebra::distributed::Vector<double> src(matrix.m());
+  for (unsigned int i = 0; i < src.size(); ++i)
+    src(i) = src_block(i);
+
+  auto diagonal_block =
+    std::make_shared<DiagonalMatrix<BlockLaplace::BlockVectorType>>();
+  diagonal_block->reinit(src_block);
+  auto diagonal = std::make_shared<DiagonalMatrix<BlockLaplace::VectorType>>();
+  diagonal->reinit(src);
+  {
+    unsigned int offset = 0;
+    for (unsigned int b = 0; b < block_sizes.size(); ++b)
+      for (unsigned int i = 0; i < block_sizes[b]; ++i, ++offset)
+        {
+          diagonal_block->get_vector()(offset) = 1. / matrix.diagonal(b);
+          diagonal->get_vector()(offset)       = 1. / matrix.diagonal(b);
+        }
+  }
+  auto generic = std::make_shared<GenericJacobi>(*diagonal_block);
+
+  for (const bool use_step : {false, true})
+    {
+      const auto reference = apply_chebyshev(matrix, diagonal, src, use_step);
+      const auto result_diagonal =
+        apply_chebyshev(matrix, diagonal_block, src_block, use_step);
+      const auto result_generic =
+        apply_chebyshev(matrix, generic, src_block, use_step);
+
+      double error_diagonal = 0., error_generic = 0.;
+      for (unsigned int i = 0; i < reference.size(); ++i)
+        {
+          error_diagonal = std::max(error_diagonal,
+                                    std::abs(result_diagonal(i) -
+                                             reference(i)));
+          error_generic =
+            std::max(error_generic, std::abs(result_generic(i) - reference(i)));
+        }
+
+      const double tolerance = 1e-12 * reference.linfty_norm();
+      deallog << (use_step ? "step():  " : "vmult(): ")
+              << "DiagonalMatrix "
+              << (error_diagonal < tolerance ? "OK" : "FAILED")
+              << ", generic preconditioner "
+              << (error_generic < tolerance ? "OK" : "FAILED") << std::endl;
+    }
+}
@@ -0,0 +1,157 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+// Test the automatic update of the eigenvalue estimates of
+// PreconditionChebyshev with the default number of power iterations: the
+// updates must not reduce the estimate of the largest eigenvalue from the
+// initial eigenvalue estimation, and the Chebyshev iteration must reduce
+// the error in every application. The matrix is the five-point stencil with
+// positive off-diagonal entries, whose eigenvector of the largest eigenvalue
+// is smooth and thus hardly present in the high-frequency initial guess of
+// the eigenvalue estimation. Furthermore, check that the updates follow a
+// shrinking spectrum if AdditionalData::eigenvalue_update_monotone is
+// disabled.
+
+
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+#include "../testmatrix.h"
+
+
+
+void
+test(const SparseMatrix<double> &A, const bool use_power_iteration)
+{
+  using Chebyshev = PreconditionChebyshev<SparseMatrix<double>, Vector<double>>;
+  Chebyshev::AdditionalData data;
+  data.eigenvalue_update_interval = 1;
+  if (use_power_iteration)
+    {
+      data.eigenvalue_algorithm =
+        Chebyshev::AdditionalData::EigenvalueAlgorithm::power_iteration;
+      data.eig_cg_n_iterations = 20;
+    }
+
+  Chebyshev cheby;
+  cheby.initialize(A, data);
+
+  Vector<double> error(A.m()), rhs(A.m());
+  for (unsigned int i = 0; i < error.size(); ++i)
+    error(i) = random_value<double>();
+
+  const double initial_estimate =
+    cheby.estimate_eigenvalues(error).max_eigenvalue_estimate;
+
+  // apply the Chebyshev iteration to the homogeneous system, such that the
+  // solution is the error, updating the eigenvalues in every step
+  bool error_reduced = true;
+  for (unsigned int i = 0; i < 10; ++i)
+    {
+      const double old_norm = error.l2_norm();
+      cheby.step(error, rhs);
+      if (!(error.l2_norm() < old_norm))
+        error_reduced = false;
+    }
+
+  const double final_estimate =
+    cheby.update_eigenvalue_estimates(error, 2).max_eigenvalue_estimate;
+
+  deallog << (use_power_iteration ? "Power iteration: " : "Lanczos: ")
+          << "estimate not reduced: " << (final_estimate >= initial_estimate)
+          << ", error reduced in every step: " << error_reduced << std::endl;
+}
+
+
+
+
+void
+test_shrinking(const SparseMatrix<double> &A, const bool monotone)
+{
+  using Chebyshev = PreconditionChebyshev<SparseMatrix<double>, Vector<double>>;
+  Chebyshev::AdditionalData data;
+  data.eigenvalue_algorithm =
+    Chebyshev::AdditionalData::EigenvalueAlgorithm::power_iteration;
+  data.eig_cg_n_iterations            = 20;
+  data.eigenvalue_update_interval     = 1;
+  data.eigenvalue_update_n_iterations = 8;
+  data.eigenvalue_update_monotone     = monotone;
+
+  SparseMatrix<double> B(A.get_sparsity_pattern());
+  B.copy_from(A);
+
+  Chebyshev cheby;
+  cheby.initialize(B, data);
+
+  Vector<double> error(A.m()), rhs(A.m());
+  for (unsigned int i = 0; i < error.size(); ++i)
+    error(i) = random_value<double>();
+
+  const double initial_estimate =
+    cheby.estimate_eigenvalues(error).max_eigenvalue_estimate;
+
+  // scale the matrix, keeping the inverse diagonal of the Chebyshev
+  // preconditioner, which shrinks the spectrum of the preconditioned matrix
+  B *= 0.25;
+
+  bool error_reduced = true;
+  for (unsigned int i = 0; i < 10; ++i)
+    {
+      const double old_norm = error.l2_norm();
+      cheby.step(error, rhs);
+      if (!(error.l2_norm() < old_norm))
+        error_reduced = false;
+    }
+
+  const double final_estimate =
+    cheby.update_eigenvalue_estimates(error, 8).max_eigenvalue_estimate;
+
+  deallog << "Shrinking spectrum, monotone " << monotone
+          << ": estimate reduced to a quarter: "
+          << (std::abs(final_estimate - 0.25 * initial_estimate) <
+              0.05 * initial_estimate)
+          << ", estimate kept: " << (final_estimate == initial_estimate)
+          << ", error reduced in every step: " << error_reduced << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  const unsigned int size = 32;
+  const unsigned int dim  = (size - 1) * (size - 1);
+
+  FDMatrix        testproblem(size, size);
+  SparsityPattern structure(dim, dim, 5);
+  testproblem.five_point_structure(structure);
+  structure.compress();
+  SparseMatrix<double> A(structure);
+  testproblem.five_point(A);
+  for (auto &entry : A)
+    if (entry.row() != entry.column())
+      entry.value() = -entry.value();
+
+  test(A, false);
+  test(A, true);
+  test_shrinking(A, true);
+  test_shrinking(A, false);
+}
@@ -0,0 +1,77 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+// Iterate SolverMinRes close to machine precision on a symmetric indefinite
+// matrix with few clusters of eigenvalues. The Krylov space becomes almost
+// invariant after a few steps, such that the new Lanczos vector is tiny
+// compared to the vectors it is computed from. If its norm is not computed
+// accurately, e.g., by expanding it in terms of inner products of the
+// previous vectors, the solver needs many more iterations than the number of
+// clusters suggests.
+
+
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_minres.h>
+#include <deal.II/lac/vector.h>
+
+#include "../tests.h"
+
+
+
+template <typename PreconditionerType>
+void
+test(const unsigned int n_clusters, const PreconditionerType &preconditioner)
+{
+  const double eigenvalues[] = {-2., 1., 3., -1.};
+
+  const unsigned int n = 100;
+  Vector<double>     diagonal(n), x(n), b(n), residual(n);
+  for (unsigned int i = 0; i < n; ++i)
+    {
+      diagonal(i) = eigenvalues[i % n_clusters] * (1. + 1e-9 * i);
+      b(i)        = random_value<double>();
+    }
+  const DiagonalMatrix<Vector<double>> A(diagonal);
+
+  SolverControl                control(100, 1e-14 * b.l2_norm());
+  SolverMinRes<Vector<double>> solver(control);
+  solver.solve(A, x, b, preconditioner);
+
+  A.vmult(residual, x);
+  residual -= b;
+  deallog << n_clusters << " clusters: steps below " << 3 * n_clusters
+          << ": " << (control.last_step() < 3 * n_clusters)
+          << ", true residual below 1e-13: "
+          << (residual.l2_norm() < 1e-13 * b.l2_norm()) << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+  deallog.depth_file(1);
+
+  test(3, PreconditionIdentity());
+  test(4, PreconditionIdentity());
+
+  Vector<double> scaling(100);
+  scaling = 0.5;
+  test(3, DiagonalMatrix<Vector<double>>(scaling));
+}
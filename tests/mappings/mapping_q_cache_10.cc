@@ -0,0 +1,121 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+// Test MappingQCache::is_affine() and the transformation of points from
+// real to unit coordinates on affine cells, which does not use a Newton
+// iteration, against the one of MappingQ on a sheared mesh, where all cells
+// are affine, and a ball, where the cells at the boundary are curved.
+
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/fe/mapping_q_cache.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+check(const Triangulation<dim> &tria, const unsigned int degree)
+{
+  MappingQ<dim>      mapping(degree);
+  MappingQCache<dim> mapping_cache(degree);
+  mapping_cache.initialize(mapping, tria);
+
+  unsigned int n_affine = 0;
+  double       max_diff = 0.;
+  for (const auto &cell : tria.active_cell_iterators())
+    {
+      if (mapping_cache.is_affine(cell))
+        ++n_affine;
+
+      // points inside and slightly outside the cell
+      std::vector<Point<dim>> unit_points;
+      for (unsigned int i = 0; i < 7; ++i)
+        {
+          Point<dim> p;
+          for (unsigned int d = 0; d < dim; ++d)
+            p[d] = -0.1 + 0.2 * i - 0.03 * d * i;
+          unit_points.push_back(p);
+        }
+
+      std::vector<Point<dim>> real_points;
+      for (const auto &p : unit_points)
+        real_points.push_back(mapping.transform_unit_to_real_cell(cell, p));
+
+      std::vector<Point<dim>> reference(real_points.size());
+      std::vector<Point<dim>> result(real_points.size());
+      mapping.transform_points_real_to_unit_cell(cell, real_points, reference);
+      mapping_cache.transform_points_real_to_unit_cell(cell,
+                                                       real_points,
+                                                       result);
+      for (unsigned int i = 0; i < result.size(); ++i)
+        {
+          max_diff = std::max(max_diff, reference[i].distance(result[i]));
+          max_diff = std::max(
+            max_diff,
+            reference[i].distance(
+              mapping_cache.transform_real_to_unit_cell(cell,
+                                                        real_points[i])));
+        }
+    }
+
+  deallog << "degree " << degree << ": " << n_affine << " of "
+          << tria.n_active_cells() << " cells affine, transformations agree: "
+          << (max_diff < 1e-10) << std::endl;
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  deallog << "dim=" << dim << std::endl;
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria, -1, 1);
+  tria.refine_global(2);
+  GridTools::transform(
+    [](const Point<dim> &p) {
+      Point<dim> q = p;
+      q[0] += 0.3 * p[dim - 1];
+      q[dim - 1] *= 2.;
+      return q;
+    },
+    tria);
+  check(tria, 1);
+  check(tria, 3);
+
+  tria.clear();
+  GridGenerator::hyper_ball(tria);
+  tria.refine_global(1);
+  check(tria, 1);
+  check(tria, 3);
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+}
@@ -0,0 +1,179 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+
+// Check CellPatchSmoother for continuous elements on a Cartesian mesh with
+// varying cell sizes and mixed Dirichlet/Neumann boundary conditions: the
+// tensor-product approximation of the cell matrices is exact in this case,
+// so the result must coincide with the weighted sum of the inverses of the
+// restrictions of the assembled Laplace matrix to the unknowns of each cell.
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/cell_patch_smoother.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test(const unsigned int fe_degree)
+{
+  using Number     = double;
+  using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+  Triangulation<dim>               tria;
+  std::vector<std::vector<double>> step_sizes(
+    dim, std::vector<double>{0.2, 0.3, 0.1, 0.4});
+  Point<dim> upper_right;
+  for (unsigned int d = 0; d < dim; ++d)
+    upper_right[d] = 1.;
+  GridGenerator::subdivided_hyper_rectangle(
+    tria, step_sizes, Point<dim>(), upper_right, true);
+
+  FE_Q<dim>       fe(fe_degree);
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  deallog << "Testing " << fe.get_name() << std::endl;
+
+  MappingQ1<dim>            mapping;
+  AffineConstraints<Number> constraints;
+  VectorTools::interpolate_boundary_values(
+    mapping, dof_handler, 0, Functions::ZeroFunction<dim>(), constraints);
+  VectorTools::interpolate_boundary_values(
+    mapping, dof_handler, 3, Functions::ZeroFunction<dim>(), constraints);
+  constraints.close();
+
+  QGauss<1> quadrature(fe_degree + 1);
+
+  auto matrix_free = std::make_shared<MatrixFree<dim, Number>>();
+  matrix_free->reinit(mapping, dof_handler, constraints, quadrature);
+
+  // assemble the global Laplace matrix
+  const unsigned int n_dofs = dof_handler.n_dofs();
+  FullMatrix<Number> global_matrix(n_dofs, n_dofs);
+  {
+    FEValues<dim> fe_values(mapping,
+                            fe,
+                            QGauss<dim>(fe_degree + 1),
+                            update_gradients | update_JxW_values);
+    std::vector<types::global_dof_index> dof_indices(fe.n_dofs_per_cell());
+    for (const auto &cell : dof_handler.active_cell_iterators())
+      {
+        fe_values.reinit(cell);
+        cell->get_dof_indices(dof_indices);
+        for (const unsigned int q : fe_values.quadrature_point_indices())
+          for (const unsigned int i : fe_values.dof_indices())
+            for (const unsigned int j : fe_values.dof_indices())
+              global_matrix(dof_indices[i], dof_indices[j]) +=
+                fe_values.shape_grad(i, q) * fe_values.shape_grad(j, q) *
+                fe_values.JxW(q);
+      }
+  }
+
+  // compute the additive Schwarz method with exact local solvers and the
+  // symmetric weighting by the multiplicity of the unknowns
+  Vector<Number> src(n_dofs), result(n_dofs), multiplicity(n_dofs);
+  for (unsigned int i = 0; i < n_dofs; ++i)
+    if (constraints.is_constrained(i) == false)
+      src(i) = random_value<Number>();
+
+  std::vector<types::global_dof_index> dof_indices(fe.n_dofs_per_cell());
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      cell->get_dof_indices(dof_indices);
+      for (const auto i : dof_indices)
+        multiplicity(i) += 1.;
+    }
+
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      cell->get_dof_indices(dof_indices);
+      std::vector<types::global_dof_index> unconstrained;
+      for (const auto i : dof_indices)
+        if (constraints.is_constrained(i) == false)
+          unconstrained.push_back(i);
+
+      const unsigned int n_local = unconstrained.size();
+      FullMatrix<Number> local_matrix(n_local, n_local);
+      Vector<Number>     local_src(n_local), local_dst(n_local);
+      for (unsigned int i = 0; i < n_local; ++i)
+        {
+          for (unsigned int j = 0; j < n_local; ++j)
+            local_matrix(i, j) =
+              global_matrix(unconstrained[i], unconstrained[j]);
+          local_src(i) =
+            src(unconstrained[i]) / std::sqrt(multiplicity(unconstrained[i]));
+        }
+      local_matrix.gauss_jordan();
+      local_matrix.vmult(local_dst, local_src);
+      for (unsigned int i = 0; i < n_local; ++i)
+        result(unconstrained[i]) +=
+          local_dst(i) / std::sqrt(multiplicity(unconstrained[i]));
+    }
+
+  // apply the smoother
+  CellPatchSmoother<dim, Number> smoother;
+  smoother.initialize(
+    matrix_free,
+    typename CellPatchSmoother<dim, Number>::AdditionalData(1., {0, 3}));
+
+  VectorType src_mf, dst_mf;
+  matrix_free->initialize_dof_vector(src_mf);
+  matrix_free->initialize_dof_vector(dst_mf);
+  for (unsigned int i = 0; i < n_dofs; ++i)
+    src_mf(i) = src(i);
+
+  smoother.vmult(dst_mf, src_mf);
+
+  double error = 0.;
+  for (unsigned int i = 0; i < n_dofs; ++i)
+    error = std::max(error, std::abs(dst_mf(i) - result(i)));
+
+  deallog << "Difference to exact cell-wise inverses: "
+          << (error < 1e-10 * result.linfty_norm() ? "OK" : "FAILED")
+          << std::endl;
+}
+
+
+int
+main()
+{
+  initlog();
+
+  for (unsigned int degree = 1; degree <= 3; ++degree)
+    test<2>(degree);
+  for (unsigned int degree = 1; degree <= 2; ++degree)
+    test<3>(degree);
+}
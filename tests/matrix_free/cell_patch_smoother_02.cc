@@ -0,0 +1,193 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+
+// Check CellPatchSmoother for discontinuous elements on a Cartesian mesh
+// with varying cell sizes and mixed Dirichlet/Neumann boundary conditions:
+// the result must coincide with the block-Jacobi method with the exact cell
+// matrices of the symmetric interior penalty discretization.
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/cell_patch_smoother.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include "../tests.h"
+
+
+template <int dim, typename FiniteElementType>
+void
+test(const unsigned int fe_degree)
+{
+  using Number     = double;
+  using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+  Triangulation<dim>               tria;
+  std::vector<std::vector<double>> step_sizes(
+    dim, std::vector<double>{0.2, 0.3, 0.1, 0.4});
+  Point<dim> upper_right;
+  for (unsigned int d = 0; d < dim; ++d)
+    upper_right[d] = 1.;
+  GridGenerator::subdivided_hyper_rectangle(
+    tria, step_sizes, Point<dim>(), upper_right, true);
+
+  FiniteElementType fe(fe_degree);
+  DoFHandler<dim>   dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  deallog << "Testing " << fe.get_name() << std::endl;
+
+  MappingQ1<dim>            mapping;
+  AffineConstraints<Number> constraints;
+  constraints.close();
+
+  auto matrix_free = std::make_shared<MatrixFree<dim, Number>>();
+  matrix_free->reinit(mapping,
+                      dof_handler,
+                      constraints,
+                      QGauss<1>(fe_degree + 1));
+
+  const std::set<types::boundary_id> dirichlet_boundaries = {0, 2};
+  const double penalty_factor = 1.5 * fe_degree * (fe_degree + 1);
+
+  const unsigned int n_dofs = dof_handler.n_dofs();
+  Vector<Number>     src(n_dofs), result(n_dofs);
+  for (unsigned int i = 0; i < n_dofs; ++i)
+    src(i) = random_value<Number>();
+
+  // assemble the cell matrices of the interior penalty method, i.e., the
+  // cell and face integrals that couple the unknowns of a cell with itself,
+  // and apply their inverse
+  FEValues<dim> fe_values(mapping,
+                          fe,
+                          QGauss<dim>(fe_degree + 1),
+                          update_gradients | update_JxW_values);
+
+  FEFaceValues<dim> fe_face_values(mapping,
+                                   fe,
+                                   QGauss<dim - 1>(fe_degree + 1),
+                                   update_values | update_gradients |
+                                     update_normal_vectors |
+                                     update_JxW_values);
+
+  const unsigned int                   n_local = fe.n_dofs_per_cell();
+  std::vector<types::global_dof_index> dof_indices(n_local);
+  FullMatrix<Number>                   cell_matrix(n_local, n_local);
+  Vector<Number>                       local_src(n_local), local_dst(n_local);
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      cell_matrix = 0.;
+      fe_values.reinit(cell);
+      for (const unsigned int q : fe_values.quadrature_point_indices())
+        for (const unsigned int i : fe_values.dof_indices())
+          for (const unsigned int j : fe_values.dof_indices())
+            cell_matrix(i, j) += fe_values.shape_grad(i, q) *
+                                 fe_values.shape_grad(j, q) * fe_values.JxW(q);
+
+      for (const unsigned int f : cell->face_indices())
+        {
+          const double h = cell->extent_in_direction(f / 2);
+
+          double factor_derivative = 0., sigma = 0.;
+          if (cell->at_boundary(f) == false)
+            {
+              const double h_neighbor =
+                cell->neighbor(f)->extent_in_direction(f / 2);
+              factor_derivative = 0.5;
+              sigma = 0.5 * (1. / h + 1. / h_neighbor) * penalty_factor;
+            }
+          else if (dirichlet_boundaries.find(cell->face(f)->boundary_id()) !=
+                   dirichlet_boundaries.end())
+            {
+              factor_derivative = 1.;
+              sigma             = 2. / h * penalty_factor;
+            }
+
+          fe_face_values.reinit(cell, f);
+          for (const unsigned int q : fe_face_values.quadrature_point_indices())
+            {
+              const Tensor<1, dim> normal = fe_face_values.normal_vector(q);
+              for (const unsigned int i : fe_face_values.dof_indices())
+                for (const unsigned int j : fe_face_values.dof_indices())
+                  cell_matrix(i, j) +=
+                    (sigma * fe_face_values.shape_value(i, q) *
+                       fe_face_values.shape_value(j, q) -
+                     factor_derivative *
+                       (normal * fe_face_values.shape_grad(j, q) *
+                          fe_face_values.shape_value(i, q) +
+                        normal * fe_face_values.shape_grad(i, q) *
+                          fe_face_values.shape_value(j, q))) *
+                    fe_face_values.JxW(q);
+            }
+        }
+
+      cell->get_dof_indices(dof_indices);
+      for (unsigned int i = 0; i < n_local; ++i)
+        local_src(i) = src(dof_indices[i]);
+      cell_matrix.gauss_jordan();
+      cell_matrix.vmult(local_dst, local_src);
+      for (unsigned int i = 0; i < n_local; ++i)
+        result(dof_indices[i]) = local_dst(i);
+    }
+
+  // apply the smoother
+  CellPatchSmoother<dim, Number> smoother;
+  smoother.initialize(matrix_free,
+                      typename CellPatchSmoother<dim, Number>::AdditionalData(
+                        1., dirichlet_boundaries, penalty_factor));
+
+  VectorType src_mf, dst_mf;
+  matrix_free->initialize_dof_vector(src_mf);
+  matrix_free->initialize_dof_vector(dst_mf);
+  for (unsigned int i = 0; i < n_dofs; ++i)
+    src_mf(i) = src(i);
+
+  smoother.vmult(dst_mf, src_mf);
+
+  double error = 0.;
+  for (unsigned int i = 0; i < n_dofs; ++i)
+    error = std::max(error, std::abs(dst_mf(i) - result(i)));
+
+  deallog << "Difference to exact cell-wise inverses: "
+          << (error < 1e-10 * result.linfty_norm() ? "OK" : "FAILED")
+          << std::endl;
+}
+
+
+int
+main()
+{
+  initlog();
+
+  for (unsigned int degree = 1; degree <= 3; ++degree)
+    test<2, FE_DGQ<2>>(degree);
+  test<2, FE_DGQHermite<2>>(3);
+  for (unsigned int degree = 1; degree <= 2; ++degree)
+    test<3, FE_DGQ<3>>(degree);
+}
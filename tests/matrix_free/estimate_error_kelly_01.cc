@@ -0,0 +1,119 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+// Test MatrixFreeTools::estimate_error_kelly() against
+// KellyErrorEstimator::estimate() on a mesh with hanging nodes, for scalar
+// and vector-valued elements
+
+#include <deal.II/base/function_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/tools.h>
+
+#include <deal.II/numerics/error_estimator.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+
+template <int dim, int n_components>
+void
+test(const unsigned int fe_degree)
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria, -1, 1);
+  tria.refine_global(2);
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->center()[0] < 0)
+      cell->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  const FESystem<dim> fe(FE_Q<dim>(fe_degree), n_components);
+  DoFHandler<dim>     dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+  constraints.close();
+
+  const MappingQ<dim> mapping(1);
+  const QGauss<1>     quadrature(fe_degree + 1);
+
+  typename MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags_inner_faces =
+    update_gradients | update_JxW_values;
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(
+    mapping, dof_handler, constraints, quadrature, additional_data);
+
+  LinearAlgebra::distributed::Vector<double> solution;
+  matrix_free.initialize_dof_vector(solution);
+  VectorTools::interpolate(mapping,
+                           dof_handler,
+                           Functions::CosineFunction<dim>(n_components),
+                           solution);
+  constraints.distribute(solution);
+
+  Vector<float> reference(tria.n_active_cells());
+  KellyErrorEstimator<dim>::estimate(mapping,
+                                     dof_handler,
+                                     QGauss<dim - 1>(fe_degree + 1),
+                                     {},
+                                     solution,
+                                     reference);
+
+  Vector<float> estimated_error;
+  MatrixFreeTools::estimate_error_kelly<n_components>(matrix_free,
+                                                      solution,
+                                                      estimated_error);
+
+  deallog << "dim=" << dim << ", n_components=" << n_components
+          << ", degree=" << fe_degree << std::endl;
+  deallog << "size matches: "
+          << (estimated_error.size() == reference.size()) << std::endl;
+  estimated_error -= reference;
+  deallog << "relative difference to KellyErrorEstimator below 1e-6: "
+          << (estimated_error.linfty_norm() < 1e-6 * reference.linfty_norm())
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2, 1>(1);
+  test<2, 1>(2);
+  test<2, 2>(2);
+  test<3, 1>(2);
+}
@@ -0,0 +1,124 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+
+// check Utilities::MPI::node_aware_sum() and Utilities::MPI::node_aware_max()
+// as well as the two-level reduction behind them on an artificial node
+// topology in which pairs of processes form a "node"
+
+#include <deal.II/base/mpi.h>
+
+#include "../tests.h"
+
+
+void
+test()
+{
+  const unsigned int myid = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+  const unsigned int numprocs =
+    Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+
+  // the topology is set up once and then cached
+  const Utilities::MPI::NodeTopology &topology =
+    Utilities::MPI::get_node_topology(MPI_COMM_WORLD);
+  AssertThrow(&topology == &Utilities::MPI::get_node_topology(MPI_COMM_WORLD),
+              ExcInternalError());
+  AssertThrow(Utilities::MPI::sum(Utilities::MPI::this_mpi_process(
+                                    topology.node_communicator) == 0 ?
+                                    1U :
+                                    0U,
+                                  MPI_COMM_WORLD) == topology.n_nodes,
+              ExcInternalError());
+
+  // the public functions, on whatever topology this test runs
+  deallog << "sum: " << Utilities::MPI::node_aware_sum(myid + 1, MPI_COMM_WORLD)
+          << std::endl;
+  deallog << "sum: "
+          << Utilities::MPI::node_aware_sum(0.5 * myid, MPI_COMM_WORLD)
+          << std::endl;
+  deallog << "max: " << Utilities::MPI::node_aware_max(myid, MPI_COMM_WORLD)
+          << std::endl;
+
+  std::array<int, 3> values = {{1, int(myid), -int(myid)}};
+  Utilities::MPI::node_aware_sum(ArrayView<const int>(values.data(), 3),
+                                 MPI_COMM_WORLD,
+                                 ArrayView<int>(values.data(), 3));
+  deallog << "sum in place: " << values[0] << ' ' << values[1] << ' '
+          << values[2] << std::endl;
+
+  // the two-level algorithm on an artificial topology with two processes
+  // per node
+  Utilities::MPI::NodeTopology pairs;
+  int ierr = MPI_Comm_split(MPI_COMM_WORLD,
+                            myid / 2,
+                            myid,
+                            &pairs.node_communicator);
+  AssertThrowMPI(ierr);
+  ierr = MPI_Comm_split(MPI_COMM_WORLD,
+                        myid % 2 == 0 ? 0 : MPI_UNDEFINED,
+                        myid,
+                        &pairs.leader_communicator);
+  AssertThrowMPI(ierr);
+  pairs.n_nodes                     = (numprocs + 1) / 2;
+  pairs.use_hierarchical_reductions = true;
+
+  const std::array<double, 2> input = {{1. + myid, 1. * numprocs - myid}};
+  std::array<double, 2>       output;
+  Utilities::MPI::internal::hierarchical_all_reduce(
+    MPI_SUM,
+    ArrayView<const double>(input.data(), 2),
+    pairs,
+    ArrayView<double>(output.data(), 2));
+  deallog << "hierarchical sum: " << output[0] << ' ' << output[1]
+          << std::endl;
+
+  Utilities::MPI::internal::hierarchical_all_reduce(
+    MPI_MAX,
+    ArrayView<const double>(input.data(), 2),
+    pairs,
+    ArrayView<double>(output.data(), 2));
+  deallog << "hierarchical max: " << output[0] << ' ' << output[1]
+          << std::endl;
+
+  output = input;
+  Utilities::MPI::internal::hierarchical_all_reduce(
+    MPI_SUM,
+    ArrayView<const double>(output.data(), 2),
+    pairs,
+    ArrayView<double>(output.data(), 2));
+  deallog << "hierarchical sum in place: " << output[0] << ' ' << output[1]
+          << std::endl;
+
+  MPI_Comm_free(&pairs.node_communicator);
+  if (pairs.leader_communicator != MPI_COMM_NULL)
+    MPI_Comm_free(&pairs.leader_communicator);
+
+  // the cached data is released together with the communicator
+  MPI_Comm duplicate = Utilities::MPI::duplicate_communicator(MPI_COMM_WORLD);
+  deallog << "sum on duplicate: "
+          << Utilities::MPI::node_aware_sum(1U, duplicate) << std::endl;
+  Utilities::MPI::free_communicator(duplicate);
+}
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    log;
+
+  test();
+}
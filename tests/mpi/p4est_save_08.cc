@@ -0,0 +1,182 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+
+// save a triangulation with variable size data attached asynchronously, and
+// refine it while the data is still being written. The refinement transfers
+// other data attached to the cells, which reuses the buffers of the
+// triangulation that the pending save must not depend on anymore. The save
+// is completed when the triangulation is destroyed, and the checkpoint is
+// then loaded with a different number of cpus, which must give back the mesh
+// and the data at the time of the save.
+
+#include <deal.II/base/point.h>
+#include <deal.II/base/utilities.h>
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_accessor.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+std::vector<char>
+pack_center(
+  const typename parallel::distributed::Triangulation<dim>::cell_iterator
+    &cell,
+  const CellStatus)
+{
+  // the size of the data depends on the level of the cell
+  const std::vector<Point<dim>> centers(cell->level() + 1, cell->center());
+  return Utilities::pack(centers, /*allow_compression=*/false);
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  const unsigned int myid = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+  MPI_Comm           com_small;
+
+  // split the communicator in proc 0,1,2 and 3
+  MPI_Comm_split(MPI_COMM_WORLD, (myid < 3) ? 0 : 1, myid, &com_small);
+
+  if (myid < 3)
+    {
+      deallog << "writing with " << Utilities::MPI::n_mpi_processes(com_small)
+              << std::endl;
+
+      parallel::distributed::Triangulation<dim> tr(com_small);
+      GridGenerator::subdivided_hyper_cube(tr, 2);
+      tr.refine_global(1);
+      tr.set_asynchronous_save(true);
+
+      tr.register_data_attach(pack_center<dim>,
+                              /*returns_variable_size_data=*/true);
+      tr.save("file");
+
+      // refine the left half of the mesh while the save is pending and
+      // transfer the center of each cell with fixed size data
+      for (const auto &cell : tr.active_cell_iterators())
+        if (cell->is_locally_owned() && cell->center()[0] < 0.5)
+          cell->set_refine_flag();
+
+      const unsigned int handle = tr.register_data_attach(
+        [](const typename parallel::distributed::Triangulation<
+             dim>::cell_iterator &cell,
+           const CellStatus) {
+          return Utilities::pack(cell->center(), /*allow_compression=*/false);
+        },
+        /*returns_variable_size_data=*/false);
+
+      tr.execute_coarsening_and_refinement();
+
+      unsigned int n_transferred = 0, n_wrong = 0;
+      tr.notify_ready_to_unpack(
+        handle,
+        [&](const typename parallel::distributed::Triangulation<
+              dim>::cell_iterator &cell,
+            const CellStatus,
+            const boost::iterator_range<std::vector<char>::const_iterator>
+              &data_range) {
+          const Point<dim> center =
+            Utilities::unpack<Point<dim>>(data_range.begin(),
+                                          data_range.end(),
+                                          /*allow_compression=*/false);
+          ++n_transferred;
+          if (center.distance(cell->center()) > 1e-12)
+            ++n_wrong;
+        });
+
+      deallog << "#cells after refinement = " << tr.n_global_active_cells()
+              << std::endl;
+      deallog << "#cells with transferred data = "
+              << Utilities::MPI::sum(n_transferred, com_small) << std::endl;
+      deallog << "#cells with wrong transferred data = "
+              << Utilities::MPI::sum(n_wrong, com_small) << std::endl;
+
+      // the destructor completes the pending save
+    }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  deallog << "reading with " << Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD)
+          << std::endl;
+
+  {
+    parallel::distributed::Triangulation<dim> tr(MPI_COMM_WORLD);
+
+    GridGenerator::subdivided_hyper_cube(tr, 2);
+    tr.load("file");
+
+    const unsigned int handle =
+      tr.register_data_attach(pack_center<dim>,
+                              /*returns_variable_size_data=*/true);
+
+    unsigned int n_unpacked = 0, n_wrong = 0;
+    tr.notify_ready_to_unpack(
+      handle,
+      [&](const typename parallel::distributed::Triangulation<
+            dim>::cell_iterator &cell,
+          const CellStatus status,
+          const boost::iterator_range<std::vector<char>::const_iterator>
+            &data_range) {
+        Assert(status == CellStatus::cell_will_persist, ExcInternalError());
+        (void)status;
+
+        const std::vector<Point<dim>> centers =
+          Utilities::unpack<std::vector<Point<dim>>>(
+            data_range.begin(), data_range.end(), /*allow_compression=*/false);
+        ++n_unpacked;
+        if (centers.size() != static_cast<unsigned int>(cell->level() + 1))
+          ++n_wrong;
+        else
+          for (const auto &center : centers)
+            if (center.distance(cell->center()) > 1e-12)
+              {
+                ++n_wrong;
+                break;
+              }
+      });
+
+    deallog << "#cells = " << tr.n_global_active_cells() << std::endl;
+    deallog << "#cells with saved data = "
+            << Utilities::MPI::sum(n_unpacked, MPI_COMM_WORLD) << std::endl;
+    deallog << "#cells with wrong saved data = "
+            << Utilities::MPI::sum(n_wrong, MPI_COMM_WORLD) << std::endl;
+  }
+
+  MPI_Comm_free(&com_small);
+
+  if (myid == 0)
+    deallog << "OK" << std::endl;
+}
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    log;
+
+  test<2>();
+}
@@ -0,0 +1,164 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+
+// Test distributed SolutionTransfer with several vectors that are refined
+// and coarsened in one go. The vectors interpolate polynomials that are
+// contained in the finite element space, so the transferred vectors must
+// coincide with the interpolation on the new mesh. FE_Q uses non-additive,
+// FE_DGQ additive restriction.
+
+
+#include <deal.II/base/function.h>
+
+#include <deal.II/distributed/solution_transfer.h>
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+template <int dim, typename Number>
+void
+test(const FiniteElement<dim> &fe, const bool average_values)
+{
+  using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+  parallel::distributed::Triangulation<dim> tria(MPI_COMM_WORLD);
+  GridGenerator::subdivided_hyper_cube(tria, 2);
+  tria.refine_global(1);
+
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  // polynomials of the same degree in each coordinate direction as the
+  // finite element, different for each vector
+  const unsigned int n_vectors = 3;
+  std::vector<std::unique_ptr<Function<dim, Number>>> functions;
+  for (unsigned int v = 0; v < n_vectors; ++v)
+    functions.emplace_back(
+      std::make_unique<ScalarFunctionFromFunctionObject<dim, Number>>(
+        [v, &fe](const Point<dim> &p) {
+          double value = 1.;
+          for (unsigned int d = 0; d < dim; ++d)
+            value *= std::pow(1. + (v + d + 1.) * p[d], fe.degree);
+          return Number(value);
+        }));
+
+  const auto interpolate = [&](std::vector<VectorType> &vectors) {
+    const IndexSet locally_relevant_dofs =
+      DoFTools::extract_locally_relevant_dofs(dof_handler);
+    vectors.resize(n_vectors);
+    for (unsigned int v = 0; v < n_vectors; ++v)
+      {
+        vectors[v].reinit(dof_handler.locally_owned_dofs(),
+                          locally_relevant_dofs,
+                          MPI_COMM_WORLD);
+        VectorTools::interpolate(dof_handler, *functions[v], vectors[v]);
+        vectors[v].update_ghost_values();
+      }
+  };
+
+  std::vector<VectorType> old_vectors;
+  interpolate(old_vectors);
+
+  // refine the children of the first coarse cell, coarsen the ones of the
+  // second coarse cell
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->is_locally_owned())
+      {
+        if (cell->parent()->id().to_string() == "0_0:")
+          cell->set_refine_flag();
+        else if (cell->parent()->id().to_string() == "1_0:")
+          cell->set_coarsen_flag();
+      }
+
+  parallel::distributed::SolutionTransfer<dim, VectorType> solution_transfer(
+    dof_handler, average_values);
+  std::vector<const VectorType *> in;
+  for (const auto &vector : old_vectors)
+    in.push_back(&vector);
+  solution_transfer.prepare_for_coarsening_and_refinement(in);
+
+  tria.execute_coarsening_and_refinement();
+  dof_handler.distribute_dofs(fe);
+
+  std::vector<VectorType> reference;
+  interpolate(reference);
+
+  std::vector<VectorType>   new_vectors(n_vectors);
+  std::vector<VectorType *> out;
+  for (auto &vector : new_vectors)
+    {
+      vector.reinit(dof_handler.locally_owned_dofs(), MPI_COMM_WORLD);
+      out.push_back(&vector);
+    }
+  solution_transfer.interpolate(out);
+
+  // compare relative to the size of the values, which grow quickly with
+  // the polynomial degree
+  double error = 0.;
+  for (unsigned int v = 0; v < n_vectors; ++v)
+    for (const auto i : dof_handler.locally_owned_dofs())
+      {
+        const double difference = new_vectors[v](i) - reference[v](i);
+        const double scaling    = std::max<double>(1., reference[v](i));
+        error = std::max(error, std::abs(difference) / scaling);
+      }
+  error = Utilities::MPI::max(error, MPI_COMM_WORLD);
+
+  const bool is_double = std::is_same_v<Number, double>;
+  deallog << fe.get_name() << (is_double ? " double" : " float")
+          << (average_values ? " averaged" : "")
+          << ": transferred vectors agree: "
+          << (error < (is_double ? 1e-10 : 1e-4)) << std::endl;
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  test<dim, double>(FE_Q<dim>(4), false);
+  test<dim, double>(FE_Q<dim>(4), true);
+  test<dim, float>(FE_Q<dim>(4), false);
+  test<dim, double>(FE_DGQ<dim>(3), false);
+  test<dim, float>(FE_DGQ<dim>(3), false);
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    log;
+
+  test<2>();
+  test<3>();
+}
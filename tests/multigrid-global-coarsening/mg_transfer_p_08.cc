@@ -0,0 +1,171 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+/**
+ * Test MGTwoLevelTransfer::enable_mixed_degree_batching() for polynomial
+ * coarsening on a hp-mesh with hanging nodes and degrees between 2 and 8:
+ * prolongation and restriction must give the same result as the
+ * transfer processing each pair of degrees separately, both when the
+ * batching is enabled before and after reinit().
+ */
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/hp/fe_collection.h>
+
+#include <deal.II/multigrid/mg_transfer_global_coarsening.h>
+
+#include "mg_transfer_util.h"
+
+using namespace dealii;
+
+template <int dim, typename Number>
+void
+do_test(const bool continuous)
+{
+  parallel::distributed::Triangulation<dim> tria(MPI_COMM_WORLD);
+  GridGenerator::subdivided_hyper_cube(tria, 3);
+  tria.begin_active()->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  hp::FECollection<dim> fe_collection;
+  for (unsigned int degree = 1; degree <= 8; ++degree)
+    if (continuous)
+      fe_collection.push_back(FE_Q<dim>(degree));
+    else
+      fe_collection.push_back(FE_DGQ<dim>(degree));
+
+  deallog << "Testing " << fe_collection[0].get_name() << std::endl;
+
+  DoFHandler<dim> dof_handler_fine(tria);
+  DoFHandler<dim> dof_handler_coarse(tria);
+
+  // fine degrees between 2 and 8, coarse degrees by bisection
+  {
+    auto cell_coarse = dof_handler_coarse.begin_active();
+    for (const auto &cell : dof_handler_fine.active_cell_iterators())
+      {
+        if (cell->is_locally_owned())
+          {
+            const unsigned int degree =
+              2 + (cell->active_cell_index() * 3) % 7;
+            cell->set_active_fe_index(degree - 1);
+            cell_coarse->set_active_fe_index(std::max(degree / 2, 1u) - 1);
+          }
+        ++cell_coarse;
+      }
+  }
+
+  dof_handler_fine.distribute_dofs(fe_collection);
+  dof_handler_coarse.distribute_dofs(fe_collection);
+
+  AffineConstraints<Number> constraint_fine(
+    dof_handler_fine.locally_owned_dofs(),
+    DoFTools::extract_locally_relevant_dofs(dof_handler_fine));
+  DoFTools::make_hanging_node_constraints(dof_handler_fine, constraint_fine);
+  constraint_fine.close();
+
+  AffineConstraints<Number> constraint_coarse(
+    dof_handler_coarse.locally_owned_dofs(),
+    DoFTools::extract_locally_relevant_dofs(dof_handler_coarse));
+  DoFTools::make_hanging_node_constraints(dof_handler_coarse,
+                                          constraint_coarse);
+  constraint_coarse.close();
+
+  using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+  MGTwoLevelTransfer<dim, VectorType> transfer_reference;
+  transfer_reference.reinit(dof_handler_fine,
+                            dof_handler_coarse,
+                            constraint_fine,
+                            constraint_coarse);
+
+  std::array<MGTwoLevelTransfer<dim, VectorType>, 2> transfers;
+  transfers[0].enable_mixed_degree_batching();
+  for (auto &transfer : transfers)
+    transfer.reinit(dof_handler_fine,
+                    dof_handler_coarse,
+                    constraint_fine,
+                    constraint_coarse);
+  transfers[1].enable_mixed_degree_batching();
+
+  VectorType src_coarse, src_fine;
+  initialize_dof_vector(src_coarse,
+                        dof_handler_coarse,
+                        numbers::invalid_unsigned_int);
+  initialize_dof_vector(src_fine,
+                        dof_handler_fine,
+                        numbers::invalid_unsigned_int);
+  for (const auto i : src_coarse.locally_owned_elements())
+    if (constraint_coarse.is_constrained(i) == false)
+      src_coarse[i] = random_value<Number>();
+  for (const auto i : src_fine.locally_owned_elements())
+    if (constraint_fine.is_constrained(i) == false)
+      src_fine[i] = random_value<Number>();
+
+  VectorType prolongated_reference(src_fine), restricted_reference(src_coarse);
+  prolongated_reference = 0.;
+  restricted_reference  = 0.;
+  transfer_reference.prolongate_and_add(prolongated_reference, src_coarse);
+  transfer_reference.restrict_and_add(restricted_reference, src_fine);
+
+  for (unsigned int t = 0; t < transfers.size(); ++t)
+    {
+      VectorType prolongated(src_fine), restricted(src_coarse);
+      prolongated = 0.;
+      restricted  = 0.;
+      transfers[t].prolongate_and_add(prolongated, src_coarse);
+      transfers[t].restrict_and_add(restricted, src_fine);
+
+      prolongated -= prolongated_reference;
+      restricted -= restricted_reference;
+
+      deallog << "Batching enabled " << (t == 0 ? "before" : "after ")
+              << " reinit(): prolongation "
+              << (prolongated.linfty_norm() <
+                      1e-12 * prolongated_reference.linfty_norm() ?
+                    "OK" :
+                    "FAILED")
+              << ", restriction "
+              << (restricted.linfty_norm() <
+                      1e-12 * restricted_reference.linfty_norm() ?
+                    "OK" :
+                    "FAILED")
+              << std::endl;
+    }
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  do_test<2, double>(true);
+  do_test<2, double>(false);
+  do_test<3, double>(true);
+  do_test<3, double>(false);
+}
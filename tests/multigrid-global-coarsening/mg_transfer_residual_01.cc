@@ -0,0 +1,251 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+/**
+ * Test MGTwoLevelTransfer::restrict_residual_and_add() against the
+ * separate computation of the residual and restrict_and_add(), both for an
+ * operator with and without pre- and post-operations in vmult() and both
+ * with and without in-place operations of the transfer.
+ */
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <deal.II/multigrid/mg_transfer_global_coarsening.h>
+
+#include "../tests.h"
+
+
+
+template <int dim, typename Number>
+class LaplaceOperator
+{
+public:
+  using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+  LaplaceOperator(const MatrixFree<dim, Number> &matrix_free)
+    : matrix_free(matrix_free)
+  {}
+
+  void
+  vmult(VectorType &dst, const VectorType &src) const
+  {
+    matrix_free.cell_loop(&LaplaceOperator::local_apply, this, dst, src, true);
+  }
+
+  void
+  vmult(VectorType       &dst,
+        const VectorType &src,
+        const std::function<void(const unsigned int, const unsigned int)>
+          &operation_before_loop,
+        const std::function<void(const unsigned int, const unsigned int)>
+          &operation_after_loop) const
+  {
+    matrix_free.cell_loop(&LaplaceOperator::local_apply,
+                          this,
+                          dst,
+                          src,
+                          operation_before_loop,
+                          operation_after_loop);
+  }
+
+private:
+  void
+  local_apply(const MatrixFree<dim, Number>               &data,
+              VectorType                                  &dst,
+              const VectorType                            &src,
+              const std::pair<unsigned int, unsigned int> &cell_range) const
+  {
+    FEEvaluation<dim, -1, 0, 1, Number> eval(data);
+    for (unsigned int cell = cell_range.first; cell < cell_range.second;
+         ++cell)
+      {
+        eval.reinit(cell);
+        eval.gather_evaluate(src,
+                             EvaluationFlags::values |
+                               EvaluationFlags::gradients);
+        for (const unsigned int q : eval.quadrature_point_indices())
+          {
+            eval.submit_value(eval.get_value(q), q);
+            eval.submit_gradient(eval.get_gradient(q), q);
+          }
+        eval.integrate_scatter(EvaluationFlags::values |
+                                 EvaluationFlags::gradients,
+                               dst);
+      }
+  }
+
+  const MatrixFree<dim, Number> &matrix_free;
+};
+
+
+
+// same operator without the vmult() variant taking pre- and
+// post-operations
+template <int dim, typename Number>
+class LaplaceOperatorPlain
+{
+public:
+  using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+  LaplaceOperatorPlain(const LaplaceOperator<dim, Number> &op)
+    : op(op)
+  {}
+
+  void
+  vmult(VectorType &dst, const VectorType &src) const
+  {
+    op.vmult(dst, src);
+  }
+
+private:
+  const LaplaceOperator<dim, Number> &op;
+};
+
+
+
+template <typename TransferType, typename OperatorType, typename MatrixFreeType>
+void
+compare(const TransferType   &transfer,
+        const OperatorType   &op,
+        const MatrixFreeType &matrix_free)
+{
+  using VectorType = typename OperatorType::VectorType;
+  using Number     = typename VectorType::value_type;
+
+  VectorType solution, rhs, residual;
+  matrix_free.initialize_dof_vector(solution);
+  matrix_free.initialize_dof_vector(rhs);
+  matrix_free.initialize_dof_vector(residual);
+  for (unsigned int i = 0; i < solution.locally_owned_size(); ++i)
+    {
+      solution.local_element(i) = random_value<Number>();
+      rhs.local_element(i)      = random_value<Number>();
+    }
+
+  VectorType dst_ref(transfer.partitioner_coarse);
+  VectorType dst(transfer.partitioner_coarse);
+
+  op.vmult(residual, solution);
+  residual.sadd(-1., 1., rhs);
+  transfer.restrict_and_add(dst_ref, residual);
+
+  VectorType tmp;
+  transfer.restrict_residual_and_add(dst, op, solution, rhs, tmp);
+
+  dst -= dst_ref;
+  deallog << "Difference to separate residual and restriction: "
+          << (dst.linfty_norm() < 1e-12 * dst_ref.linfty_norm() ? "OK" :
+                                                                  "FAILED")
+          << std::endl;
+}
+
+
+
+template <int dim, typename Number>
+void
+do_test(const FiniteElement<dim> &fe_fine, const FiniteElement<dim> &fe_coarse)
+{
+  // coarse grid with one level less than fine grid, refined towards the
+  // left to get hanging nodes
+  Triangulation<dim> tria_coarse, tria_fine;
+  for (Triangulation<dim> *tria : {&tria_coarse, &tria_fine})
+    {
+      GridGenerator::hyper_cube(*tria);
+      tria->refine_global(2);
+      for (auto &cell : tria->active_cell_iterators())
+        if (cell->center()[0] < 0.5)
+          cell->set_refine_flag();
+      tria->execute_coarsening_and_refinement();
+    }
+  tria_fine.refine_global();
+
+  DoFHandler<dim> dof_handler_fine(tria_fine);
+  dof_handler_fine.distribute_dofs(fe_fine);
+  DoFHandler<dim> dof_handler_coarse(tria_coarse);
+  dof_handler_coarse.distribute_dofs(fe_coarse);
+
+  AffineConstraints<Number> constraint_coarse;
+  DoFTools::make_hanging_node_constraints(dof_handler_coarse,
+                                          constraint_coarse);
+  constraint_coarse.close();
+
+  AffineConstraints<Number> constraint_fine;
+  DoFTools::make_hanging_node_constraints(dof_handler_fine, constraint_fine);
+  constraint_fine.close();
+
+  MatrixFree<dim, Number> matrix_free;
+  matrix_free.reinit(MappingQ1<dim>(),
+                     dof_handler_fine,
+                     constraint_fine,
+                     QGauss<1>(fe_fine.degree + 1),
+                     typename MatrixFree<dim, Number>::AdditionalData());
+
+  const LaplaceOperator<dim, Number>      op(matrix_free);
+  const LaplaceOperatorPlain<dim, Number> op_plain(op);
+
+  MGTwoLevelTransfer<dim, LinearAlgebra::distributed::Vector<Number>> transfer;
+  transfer.reinit(dof_handler_fine,
+                  dof_handler_coarse,
+                  constraint_fine,
+                  constraint_coarse);
+
+  deallog << "Internal vectors, operator with pre/post operations" << std::endl;
+  compare(transfer, op, matrix_free);
+  deallog << "Internal vectors, plain operator" << std::endl;
+  compare(transfer, op_plain, matrix_free);
+
+  transfer.enable_inplace_operations_if_possible(
+    transfer.partitioner_coarse, matrix_free.get_vector_partitioner());
+
+  deallog << "In-place, operator with pre/post operations" << std::endl;
+  compare(transfer, op, matrix_free);
+  deallog << "In-place, plain operator" << std::endl;
+  compare(transfer, op_plain, matrix_free);
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  for (unsigned int degree = 1; degree < 4; ++degree)
+    {
+      deallog.push("CG" + std::to_string(degree));
+      do_test<2, double>(FE_Q<2>(degree), FE_Q<2>(degree));
+      deallog.pop();
+      deallog.push("DG" + std::to_string(degree));
+      do_test<2, double>(FE_DGQ<2>(degree), FE_DGQ<2>(degree));
+      deallog.pop();
+    }
+}
@@ -0,0 +1,133 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+/*
+ * Test the order of operations of the additive multigrid cycle without any
+ * numerics, similar to the cycles test. All transfer operators are void and
+ * we use the same matrix on each level.
+ */
+
+#include <deal.II/base/mg_level_object.h>
+
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/multigrid/mg_base.h>
+#include <deal.II/multigrid/mg_matrix.h>
+#include <deal.II/multigrid/multigrid.h>
+
+#include "../tests.h"
+
+
+#define N 3
+using VectorType = Vector<double>;
+
+class MGAll : public MGSmootherBase<VectorType>,
+              public MGTransferBase<VectorType>,
+              public MGCoarseGridBase<VectorType>
+{
+public:
+  virtual ~MGAll()
+  {}
+
+  virtual void
+  smooth(const unsigned int, VectorType &, const VectorType &) const
+  {}
+
+  virtual void
+  prolongate(const unsigned int, VectorType &, const VectorType &) const
+  {}
+
+  virtual void
+  restrict_and_add(const unsigned int, VectorType &, const VectorType &) const
+  {}
+
+  virtual void
+  clear()
+  {}
+
+  virtual void
+  operator()(const unsigned int, VectorType &, const VectorType &) const
+  {}
+};
+
+void
+test_cycles(unsigned int minlevel, unsigned int maxlevel)
+{
+  MGAll                             all;
+  MGLevelObject<FullMatrix<double>> level_matrices(0, maxlevel);
+  for (unsigned int i = 0; i <= maxlevel; ++i)
+    level_matrices[i].reinit(N, N);
+  mg::Matrix<VectorType> mgmatrix(level_matrices);
+
+  Multigrid<VectorType> mg1(mgmatrix,
+                            all,
+                            all,
+                            all,
+                            all,
+                            minlevel,
+                            maxlevel,
+                            Multigrid<VectorType>::additive);
+
+  for (unsigned int i = minlevel; i <= maxlevel; ++i)
+    mg1.defect[i].reinit(N);
+
+  auto print_coarse_solve = [](const bool start, const unsigned int level) {
+    if (start)
+      deallog << "Coarse solve     level " << level << std::endl;
+  };
+
+  auto print_restriction = [](const bool start, const unsigned int level) {
+    if (start)
+      deallog << "Restriction from level " << level << std::endl;
+  };
+
+  auto print_prolongation = [](const bool start, const unsigned int level) {
+    if (start)
+      deallog << "Prolongation to  level " << level << std::endl;
+  };
+
+  auto print_pre_smoother_step = [](const bool         start,
+                                    const unsigned int level) {
+    if (start)
+      deallog << "Smoothing on     level " << level << std::endl;
+  };
+
+  auto print_other_step = [](const bool start, const unsigned int level) {
+    if (start)
+      deallog << "Unexpected step  level " << level << std::endl;
+  };
+
+  mg1.connect_coarse_solve(print_coarse_solve);
+  mg1.connect_restriction(print_restriction);
+  mg1.connect_prolongation(print_prolongation);
+  mg1.connect_pre_smoother_step(print_pre_smoother_step);
+  mg1.connect_post_smoother_step(print_other_step);
+  mg1.connect_residual_step(print_other_step);
+  mg1.connect_edge_prolongation(print_other_step);
+
+  mg1.cycle();
+  deallog << std::endl;
+}
+
+int
+main()
+{
+  initlog();
+
+  test_cycles(0, 4);
+  test_cycles(2, 5);
+}
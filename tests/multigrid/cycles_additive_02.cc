@@ -0,0 +1,249 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+/*
+ * Test the additive multigrid cycle on a 1d Laplacian with linear
+ * interpolation as transfer and a damped Jacobi smoother: check that the
+ * preconditioner is symmetric and positive, that the concurrent execution
+ * of the level operations gives the same result as the sequential one, and
+ * that the additive cycle works as a preconditioner in SolverCG.
+ */
+
+#include <deal.II/base/mg_level_object.h>
+
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/multigrid/mg_base.h>
+#include <deal.II/multigrid/mg_matrix.h>
+#include <deal.II/multigrid/multigrid.h>
+
+#include "../tests.h"
+
+
+using VectorType = Vector<double>;
+
+
+// number of interior nodes of a uniform 1d mesh on the given level
+unsigned int
+n_dofs(const unsigned int level)
+{
+  return (2u << level) - 1;
+}
+
+
+
+class Transfer : public MGTransferBase<VectorType>
+{
+public:
+  virtual void
+  prolongate(const unsigned int to_level,
+             VectorType        &dst,
+             const VectorType  &src) const override
+  {
+    dst = 0.;
+    prolongate_and_add(to_level, dst, src);
+  }
+
+  virtual void
+  prolongate_and_add(const unsigned int to_level,
+                     VectorType        &dst,
+                     const VectorType  &src) const override
+  {
+    AssertDimension(dst.size(), n_dofs(to_level));
+    AssertDimension(src.size(), n_dofs(to_level - 1));
+    for (unsigned int j = 0; j < src.size(); ++j)
+      {
+        dst(2 * j) += 0.5 * src(j);
+        dst(2 * j + 1) += src(j);
+        dst(2 * j + 2) += 0.5 * src(j);
+      }
+  }
+
+  virtual void
+  restrict_and_add(const unsigned int from_level,
+                   VectorType        &dst,
+                   const VectorType  &src) const override
+  {
+    AssertDimension(src.size(), n_dofs(from_level));
+    AssertDimension(dst.size(), n_dofs(from_level - 1));
+    for (unsigned int j = 0; j < dst.size(); ++j)
+      dst(j) += 0.5 * src(2 * j) + src(2 * j + 1) + 0.5 * src(2 * j + 2);
+  }
+};
+
+
+
+class JacobiSmoother : public MGSmootherBase<VectorType>
+{
+public:
+  JacobiSmoother(const MGLevelObject<FullMatrix<double>> &matrices)
+    : matrices(matrices)
+  {}
+
+  virtual void
+  clear() override
+  {}
+
+  virtual void
+  smooth(const unsigned int level,
+         VectorType        &u,
+         const VectorType  &rhs) const override
+  {
+    VectorType residual(rhs);
+    matrices[level].vmult(residual, u);
+    residual.sadd(-1., 1., rhs);
+    for (unsigned int i = 0; i < u.size(); ++i)
+      u(i) += 2. / 3. * residual(i) / matrices[level](i, i);
+  }
+
+private:
+  const MGLevelObject<FullMatrix<double>> &matrices;
+};
+
+
+
+class DirectCoarse : public MGCoarseGridBase<VectorType>
+{
+public:
+  DirectCoarse(const FullMatrix<double> &matrix)
+  {
+    inverse.reinit(matrix.m(), matrix.n());
+    inverse.invert(matrix);
+  }
+
+  virtual void
+  operator()(const unsigned int,
+             VectorType       &dst,
+             const VectorType &src) const override
+  {
+    inverse.vmult(dst, src);
+  }
+
+private:
+  FullMatrix<double> inverse;
+};
+
+
+
+class AdditivePreconditioner
+{
+public:
+  AdditivePreconditioner(Multigrid<VectorType> &mg)
+    : mg(mg)
+  {}
+
+  void
+  vmult(VectorType &dst, const VectorType &src) const
+  {
+    for (unsigned int level = mg.get_minlevel(); level <= mg.get_maxlevel();
+         ++level)
+      mg.defect[level].reinit(n_dofs(level));
+    mg.defect[mg.get_maxlevel()] = src;
+    mg.cycle();
+    dst = mg.solution[mg.get_maxlevel()];
+  }
+
+private:
+  Multigrid<VectorType> &mg;
+};
+
+
+
+void
+test(const unsigned int minlevel, const unsigned int maxlevel)
+{
+  MGLevelObject<FullMatrix<double>> level_matrices(0, maxlevel);
+  for (unsigned int level = 0; level <= maxlevel; ++level)
+    {
+      const unsigned int n = n_dofs(level);
+      level_matrices[level].reinit(n, n);
+      const double h = 1. / (n + 1);
+      for (unsigned int i = 0; i < n; ++i)
+        {
+          level_matrices[level](i, i) = 2. / h;
+          if (i > 0)
+            level_matrices[level](i, i - 1) = -1. / h;
+          if (i + 1 < n)
+            level_matrices[level](i, i + 1) = -1. / h;
+        }
+    }
+  mg::Matrix<VectorType> mg_matrix(level_matrices);
+
+  Transfer       transfer;
+  JacobiSmoother smoother(level_matrices);
+  DirectCoarse   coarse(level_matrices[minlevel]);
+
+  Multigrid<VectorType> mg(mg_matrix,
+                           coarse,
+                           transfer,
+                           smoother,
+                           smoother,
+                           minlevel,
+                           maxlevel,
+                           Multigrid<VectorType>::additive);
+
+  AdditivePreconditioner preconditioner(mg);
+
+  const unsigned int n = n_dofs(maxlevel);
+  VectorType         u(n), v(n), Bu(n), Bv(n);
+  for (unsigned int i = 0; i < n; ++i)
+    {
+      u(i) = random_value<double>();
+      v(i) = random_value<double>();
+    }
+
+  preconditioner.vmult(Bu, u);
+  preconditioner.vmult(Bv, v);
+
+  deallog << "Levels " << minlevel << " - " << maxlevel << std::endl;
+  deallog << "Symmetric: "
+          << (std::abs(Bv * u - Bu * v) < 1e-12 * std::abs(Bv * u) ? "yes" :
+                                                                      "no")
+          << std::endl;
+  deallog << "Positive:  " << (Bu * u > 0. ? "yes" : "no") << std::endl;
+
+  mg.set_concurrent_level_operations(true);
+  VectorType Bu_concurrent(n);
+  preconditioner.vmult(Bu_concurrent, u);
+  Bu_concurrent -= Bu;
+  deallog << "Concurrent equals sequential: "
+          << (Bu_concurrent.linfty_norm() < 1e-12 * Bu.linfty_norm() ? "yes" :
+                                                                      "no")
+          << std::endl;
+
+  SolverControl        control(200, 1e-10 * u.l2_norm());
+  SolverCG<VectorType> solver(control);
+  VectorType           solution(n);
+  check_solver_within_range(
+    solver.solve(level_matrices[maxlevel], solution, u, preconditioner),
+    control.last_step(),
+    1,
+    40);
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test(0, 5);
+  test(2, 6);
+}
@@ -0,0 +1,182 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+// check VectorTools::project for FE_DGQ elements on a mesh of affine cells,
+// where the mass matrix is inverted cell by cell, against the projection
+// computed with local mass matrices assembled by FEValues
+//
+// Make sure that the iterative solver is not used in that case by checking
+// whether the projection put vectors into the pool of GrowingVectorMemory,
+// which only SolverCG allocates from. On a mesh with a non-affine cell, the
+// iterative solver must be used.
+
+
+#include <deal.II/base/function_lib.h>
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/fe_values.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/vector.h>
+#include <deal.II/lac/vector_memory.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+class F : public Function<dim>
+{
+public:
+  F(const unsigned int n_components)
+    : Function<dim>(n_components)
+  {}
+
+  virtual double
+  value(const Point<dim> &p, const unsigned int component) const override
+  {
+    return std::sin(p[0] + component) * std::exp(p[dim - 1]);
+  }
+};
+
+
+
+template <int dim>
+void
+check(const Triangulation<dim> &tria, const FiniteElement<dim> &fe)
+{
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  const QGauss<dim> quadrature(fe.degree + 2);
+  const F<dim>      function(fe.n_components());
+  Vector<double>    projection(dof_handler.n_dofs());
+
+  GrowingVectorMemory<LinearAlgebra::distributed::Vector<double>> memory;
+  GrowingVectorMemory<
+    LinearAlgebra::distributed::Vector<double>>::release_unused_memory();
+  VectorTools::project(
+    dof_handler, constraints, quadrature, function, projection);
+  const bool used_iterative_solver =
+    memory.memory_consumption() > sizeof(memory);
+
+  // compute the local projections with FEValues
+  Vector<double> reference(dof_handler.n_dofs());
+  FEValues<dim>  fe_values(fe,
+                          quadrature,
+                          update_values | update_quadrature_points |
+                            update_JxW_values);
+  FullMatrix<double> local_mass(fe.n_dofs_per_cell(), fe.n_dofs_per_cell());
+  Vector<double>     local_rhs(fe.n_dofs_per_cell());
+  Vector<double>     local_solution(fe.n_dofs_per_cell());
+  std::vector<types::global_dof_index> dof_indices(fe.n_dofs_per_cell());
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      fe_values.reinit(cell);
+      local_mass = 0;
+      local_rhs  = 0;
+      for (const unsigned int q : fe_values.quadrature_point_indices())
+        for (const unsigned int i : fe_values.dof_indices())
+          {
+            const unsigned int component_i =
+              fe.system_to_component_index(i).first;
+            for (const unsigned int j : fe_values.dof_indices())
+              if (fe.system_to_component_index(j).first == component_i)
+                local_mass(i, j) += fe_values.shape_value(i, q) *
+                                    fe_values.shape_value(j, q) *
+                                    fe_values.JxW(q);
+            local_rhs(i) +=
+              fe_values.shape_value(i, q) *
+              function.value(fe_values.quadrature_point(q), component_i) *
+              fe_values.JxW(q);
+          }
+      local_mass.gauss_jordan();
+      local_mass.vmult(local_solution, local_rhs);
+      cell->get_dof_indices(dof_indices);
+      reference.add(dof_indices, local_solution);
+    }
+
+  reference -= projection;
+  deallog << fe.get_name() << ", n_dofs=" << dof_handler.n_dofs()
+          << ", difference to local projection: "
+          << (reference.linfty_norm() < 1e-10 * projection.linfty_norm() ?
+                "OK" :
+                "Failed")
+          << ", iterative solver used: " << used_iterative_solver
+          << std::endl;
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  Point<dim> upper_right;
+  for (unsigned int d = 0; d < dim; ++d)
+    upper_right[d] = 1.;
+  upper_right[0] = 2.;
+
+  Triangulation<dim> tria;
+  GridGenerator::subdivided_hyper_rectangle(tria,
+                                            std::vector<unsigned int>(dim, 3),
+                                            Point<dim>(),
+                                            upper_right);
+  GridTools::transform(
+    [](const Point<dim> &p) {
+      Point<dim> q = p;
+      q[0] += 0.5 * p[dim - 1];
+      return q;
+    },
+    tria);
+
+  check(tria, FE_DGQ<dim>(0));
+  check(tria, FE_DGQ<dim>(2));
+  check(tria, FESystem<dim>(FE_DGQ<dim>(1), 2));
+
+  // move one vertex, which makes the adjacent cells non-affine
+  if (dim > 1)
+    {
+      tria.begin_active()->vertex(dim == 2 ? 3 : 7)[0] += 0.1;
+      check(tria, FE_DGQ<dim>(2));
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<1>();
+  test<2>();
+  test<3>();
+}
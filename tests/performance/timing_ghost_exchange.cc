@@ -0,0 +1,187 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+//
+// Description:
+//
+// A microbenchmark for the exchange of ghost values of
+// LinearAlgebra::distributed::Vector, comparing update_ghost_values() and
+// compress() with MPI messages against the exchange through MPI-3
+// shared-memory windows between the processes on the same node, see
+// Utilities::MPI::Partitioner::set_shared_memory_communicator(). The ghost
+// layout imitates a three-dimensional domain decomposition, where each
+// process has ghost entries of up to 26 neighbors, most of which reside on
+// the same node when the processes of a node are numbered consecutively.
+//
+// Status: experimental
+//
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/partitioner.h>
+#include <deal.II/base/timer.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <array>
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          4,
+          {"update_ghost_values_mpi",
+           "update_ghost_values_shared",
+           "compress_add_mpi",
+           "compress_add_shared"}};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  const MPI_Comm     comm    = MPI_COMM_WORLD;
+  const unsigned int n_procs = Utilities::MPI::n_mpi_processes(comm);
+  const unsigned int my_rank = Utilities::MPI::this_mpi_process(comm);
+
+  unsigned int face_size = 100;
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        break;
+      case TestingEnvironment::medium:
+        face_size *= 2;
+        break;
+      case TestingEnvironment::heavy:
+        face_size *= 4;
+        break;
+    }
+
+  // each process owns a cube of face_size^3 entries and has ghost entries
+  // from its neighbors in a periodic three-dimensional arrangement of the
+  // processes: face_size^2 entries from face neighbors, face_size entries
+  // from edge neighbors and one entry from vertex neighbors
+  const types::global_dof_index local_size =
+    static_cast<types::global_dof_index>(face_size) * face_size * face_size;
+  std::array<int, 3> grid = {{0, 0, 0}};
+  int                ierr = MPI_Dims_create(n_procs, 3, grid.data());
+  AssertThrowMPI(ierr);
+
+  const std::array<int, 3> my_position = {
+    {static_cast<int>(my_rank) % grid[0],
+     (static_cast<int>(my_rank) / grid[0]) % grid[1],
+     static_cast<int>(my_rank) / grid[0] / grid[1]}};
+
+  IndexSet locally_owned(local_size * n_procs);
+  locally_owned.add_range(my_rank * local_size, (my_rank + 1) * local_size);
+  IndexSet ghosts(local_size * n_procs);
+  for (int dz = -1; dz <= 1; ++dz)
+    for (int dy = -1; dy <= 1; ++dy)
+      for (int dx = -1; dx <= 1; ++dx)
+        {
+          const std::array<int, 3> offset   = {{dx, dy, dz}};
+          types::global_dof_index  neighbor = 0;
+          for (int d = 2; d >= 0; --d)
+            neighbor = neighbor * grid[d] +
+                       (my_position[d] + grid[d] + offset[d]) % grid[d];
+          if (neighbor == my_rank)
+            continue;
+
+          // the number of entries shared with this neighbor
+          const unsigned int n_zero_offsets =
+            (dx == 0) + (dy == 0) + (dz == 0);
+          types::global_dof_index n_entries = 1;
+          for (unsigned int d = 0; d < n_zero_offsets; ++d)
+            n_entries *= face_size;
+          ghosts.add_range(neighbor * local_size,
+                           neighbor * local_size + n_entries);
+        }
+
+  const auto partitioner =
+    std::make_shared<Utilities::MPI::Partitioner>(locally_owned,
+                                                  ghosts,
+                                                  comm);
+
+  MPI_Comm comm_sm;
+  ierr = MPI_Comm_split_type(
+    comm, MPI_COMM_TYPE_SHARED, my_rank, MPI_INFO_NULL, &comm_sm);
+  AssertThrowMPI(ierr);
+  const auto partitioner_sm =
+    std::make_shared<Utilities::MPI::Partitioner>(locally_owned,
+                                                  ghosts,
+                                                  comm);
+  partitioner_sm->set_shared_memory_communicator(comm_sm);
+
+  std::vector<double> results;
+  {
+    LinearAlgebra::distributed::Vector<double> vector_mpi(partitioner);
+    LinearAlgebra::distributed::Vector<double> vector_sm;
+    vector_sm.reinit(partitioner_sm, comm_sm);
+    for (unsigned int i = 0; i < local_size; ++i)
+      {
+        vector_mpi.local_element(i) = my_rank + i;
+        vector_sm.local_element(i)  = my_rank + i;
+      }
+
+    const unsigned int n_repetitions = 50;
+    Timer              timer;
+    for (auto *vector : {&vector_mpi, &vector_sm})
+      {
+        // warm up the buffers and the shared-memory handshake
+        vector->update_ghost_values();
+        vector->zero_out_ghost_values();
+
+        ierr = MPI_Barrier(comm);
+        AssertThrowMPI(ierr);
+        timer.restart();
+        for (unsigned int t = 0; t < n_repetitions; ++t)
+          {
+            vector->update_ghost_values();
+            vector->zero_out_ghost_values();
+          }
+        results.push_back(
+          Utilities::MPI::max(timer.wall_time(), comm) / n_repetitions);
+      }
+
+    for (auto *vector : {&vector_mpi, &vector_sm})
+      {
+        ierr = MPI_Barrier(comm);
+        AssertThrowMPI(ierr);
+        timer.restart();
+        for (unsigned int t = 0; t < n_repetitions; ++t)
+          {
+            for (unsigned int i = 0; i < partitioner->n_ghost_indices(); ++i)
+              vector->local_element(local_size + i) = 1.;
+            vector->compress(VectorOperation::add);
+          }
+        results.push_back(
+          Utilities::MPI::max(timer.wall_time(), comm) / n_repetitions);
+      }
+
+    // make sure both variants compute the same
+    vector_mpi -= vector_sm;
+    AssertThrow(vector_mpi.linfty_norm() == 0., ExcInternalError());
+  }
+
+  ierr = MPI_Comm_free(&comm_sm);
+  AssertThrowMPI(ierr);
+
+  return {results[0], results[1], results[2], results[3]};
+}
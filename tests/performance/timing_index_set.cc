@@ -0,0 +1,180 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+//
+// Description:
+//
+// A microbenchmark for the queries and set operations of IndexSet on a set
+// with many short ranges, as it appears for the locally relevant degrees of
+// freedom of fragmented subdomains. The queries of IndexSet, which use a
+// bitmap for such sets, are compared against a binary search in a vector of
+// ranges, which is how IndexSet answers queries outside its largest range
+// otherwise.
+//
+// Status: experimental
+//
+
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/timer.h>
+
+#include <algorithm>
+#include <random>
+#include <utility>
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+
+IndexSet
+create_fragmented_set(const types::global_dof_index size,
+                      const unsigned int            period,
+                      const unsigned int            shift)
+{
+  IndexSet set(size);
+  for (types::global_dof_index i = shift; i + period <= size; i += period)
+    set.add_range(i, i + 1 + (i / period) % (period - 1));
+  set.compress();
+  return set;
+}
+
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          4,
+          {"range_vector_lookup",
+           "index_within_set",
+           "index_within_set_batched",
+           "is_element",
+           "intersection",
+           "subtract_set",
+           "add_indices"}};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  types::global_dof_index size = 10000000;
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        break;
+      case TestingEnvironment::medium:
+        size *= 4;
+        break;
+      case TestingEnvironment::heavy:
+        size *= 16;
+        break;
+    }
+
+  const IndexSet set   = create_fragmented_set(size, 12, 3);
+  const IndexSet other = create_fragmented_set(size, 7, 0);
+
+  // sorted query indices, about half of which are in the set
+  std::vector<types::global_dof_index> indices;
+  {
+    std::mt19937                                           generator(42);
+    std::uniform_int_distribution<types::global_dof_index> distribution(0,
+                                                                        3);
+    for (types::global_dof_index i = distribution(generator); i < size;
+         i += 1 + distribution(generator))
+      indices.push_back(i);
+  }
+  std::vector<types::global_dof_index> local_indices(indices.size());
+
+  // the plain range representation as a reference
+  std::vector<std::pair<types::global_dof_index, types::global_dof_index>>
+                                       ranges;
+  std::vector<types::global_dof_index> n_preceding;
+  types::global_dof_index              n_elements = 0;
+  for (auto interval = set.begin_intervals(); interval != set.end_intervals();
+       ++interval)
+    {
+      ranges.emplace_back(*interval->begin(), interval->last() + 1);
+      n_preceding.push_back(n_elements);
+      n_elements += interval->n_elements();
+    }
+
+  std::vector<double>     results;
+  Timer                   timer;
+  types::global_dof_index checksum = 0;
+
+  timer.restart();
+  for (std::size_t i = 0; i < indices.size(); ++i)
+    {
+      const auto p = std::upper_bound(
+        ranges.begin(),
+        ranges.end(),
+        indices[i],
+        [](const types::global_dof_index index, const auto &range) {
+          return index < range.second;
+        });
+      local_indices[i] = (p != ranges.end() && p->first <= indices[i]) ?
+                           n_preceding[p - ranges.begin()] +
+                             (indices[i] - p->first) :
+                           numbers::invalid_dof_index;
+    }
+  results.push_back(timer.wall_time());
+  checksum += local_indices.back();
+
+  timer.restart();
+  for (std::size_t i = 0; i < indices.size(); ++i)
+    local_indices[i] = set.index_within_set(indices[i]);
+  results.push_back(timer.wall_time());
+  checksum += local_indices.back();
+
+  timer.restart();
+  set.index_within_set(indices, local_indices);
+  results.push_back(timer.wall_time());
+  checksum += local_indices.back();
+
+  timer.restart();
+  for (std::size_t i = 0; i < indices.size(); ++i)
+    checksum += set.is_element(indices[i]);
+  results.push_back(timer.wall_time());
+
+  timer.restart();
+  const IndexSet intersection = set & other;
+  results.push_back(timer.wall_time());
+  checksum += intersection.n_elements();
+
+  timer.restart();
+  IndexSet difference = set;
+  difference.subtract_set(other);
+  results.push_back(timer.wall_time());
+  checksum += difference.n_elements();
+
+  timer.restart();
+  IndexSet union_set = set;
+  union_set.add_indices(other);
+  results.push_back(timer.wall_time());
+  checksum += union_set.n_elements();
+
+  // make sure the compiler does not optimize away the work
+  AssertThrow(checksum > 0, ExcInternalError());
+
+  return {results[0],
+          results[1],
+          results[2],
+          results[3],
+          results[4],
+          results[5],
+          results[6]};
+}
@@ -17,11 +17,15 @@
  *
  * This test compares the MatrixFree and CUDAWrapper::MatrixFree
  * infrastructure on the CPU. Considered are the initialization
- * costs and the costs for an operator evaluation.
+ * costs and the costs for the evaluation of a Laplace and a Helmholtz
+ * operator, i.e., of a kernel with only gradients and of one with values
+ * and gradients.
  * CUDAWrapper::MatrixFree was written with CUDA and now uses
  * Kokkos as backend and, as consequnce, favors GPU hardware. This
  * performance test is meant to track the improvement of
- * the performance of CUDAWrapper::MatrixFree on the CPU.
+ * the performance of CUDAWrapper::MatrixFree on the CPU, where it runs on
+ * the host execution space Kokkos has been configured with (Serial, OpenMP,
+ * or Threads), against the host-vectorized MatrixFree path.
  *
  * Status: experimental
  */
@@ -51,11 +55,23 @@ using namespace dealii;
 
 
 
-template <int dim, int fe_degree, typename Number, typename MemorySpace>
+enum class OperatorType
+{
+  laplace,
+  helmholtz
+};
+
+
+
+template <int dim,
+          int fe_degree,
+          typename Number,
+          typename MemorySpace,
+          OperatorType operator_type>
 class LaplaceOperator;
 
-template <int dim, int fe_degree, typename Number>
-class LaplaceOperator<dim, fe_degree, Number, MemorySpace::Host>
+template <int dim, int fe_degree, typename Number, OperatorType operator_type>
+class LaplaceOperator<dim, fe_degree, Number, MemorySpace::Host, operator_type>
 {
 public:
   using VectorType =
@@ -95,16 +111,25 @@ private:
               const VectorType                            &src,
               const std::pair<unsigned int, unsigned int> &cell_range) const
   {
+    constexpr EvaluationFlags::EvaluationFlags flags =
+      operator_type == OperatorType::helmholtz ?
+        (EvaluationFlags::values | EvaluationFlags::gradients) :
+        EvaluationFlags::gradients;
+
     FEEvaluation<dim, fe_degree, fe_degree + 1, 1, Number> phi(data);
     for (unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
       {
         phi.reinit(cell);
 
         phi.read_dof_values_plain(src);
-        phi.evaluate(EvaluationFlags::gradients);
+        phi.evaluate(flags);
         for (unsigned int q = 0; q < phi.n_q_points; ++q)
-          phi.submit_gradient(phi.get_gradient(q), q);
-        phi.integrate(EvaluationFlags::gradients);
+          {
+            if constexpr (operator_type == OperatorType::helmholtz)
+              phi.submit_value(phi.get_value(q), q);
+            phi.submit_gradient(phi.get_gradient(q), q);
+          }
+        phi.integrate(flags);
         phi.distribute_local_to_global(dst);
       }
   }
@@ -114,7 +139,7 @@ private:
 
 
 
-template <int dim, int fe_degree, typename Number>
+template <int dim, int fe_degree, typename Number, OperatorType operator_type>
 class LaplaceOperatorQuad
 {
 public:
@@ -124,11 +149,13 @@ public:
              *fe_eval,
     const int q_point) const
   {
+    if constexpr (operator_type == OperatorType::helmholtz)
+      fe_eval->submit_value(fe_eval->get_value(q_point), q_point);
     fe_eval->submit_gradient(fe_eval->get_gradient(q_point), q_point);
   }
 };
 
-template <int dim, int fe_degree, typename Number>
+template <int dim, int fe_degree, typename Number, OperatorType operator_type>
 class LaplaceOperatorLocal
 {
 public:
@@ -142,13 +169,18 @@ public:
   {
     (void)cell; // TODO?
 
+    constexpr EvaluationFlags::EvaluationFlags flags =
+      operator_type == OperatorType::helmholtz ?
+        (EvaluationFlags::values | EvaluationFlags::gradients) :
+        EvaluationFlags::gradients;
+
     CUDAWrappers::FEEvaluation<dim, fe_degree, fe_degree + 1, 1, Number>
       fe_eval(/*cell,*/ gpu_data, shared_data);
     fe_eval.read_dof_values(src);
-    fe_eval.evaluate(EvaluationFlags::gradients);
+    fe_eval.evaluate(flags);
     fe_eval.apply_for_each_quad_point(
-      LaplaceOperatorQuad<dim, fe_degree, Number>());
-    fe_eval.integrate(EvaluationFlags::gradients);
+      LaplaceOperatorQuad<dim, fe_degree, Number, operator_type>());
+    fe_eval.integrate(flags);
     fe_eval.distribute_local_to_global(dst);
   }
   static const unsigned int n_dofs_1d    = fe_degree + 1;
@@ -156,8 +188,12 @@ public:
   static const unsigned int n_q_points   = Utilities::pow(fe_degree + 1, dim);
 };
 
-template <int dim, int fe_degree, typename Number>
-class LaplaceOperator<dim, fe_degree, Number, MemorySpace::Default>
+template <int dim, int fe_degree, typename Number, OperatorType operator_type>
+class LaplaceOperator<dim,
+                      fe_degree,
+                      Number,
+                      MemorySpace::Default,
+                      operator_type>
 {
 public:
   using VectorType =
@@ -188,7 +224,7 @@ public:
   void
   vmult(VectorType &dst, const VectorType &src) const
   {
-    LaplaceOperatorLocal<dim, fe_degree, Number> local_operator;
+    LaplaceOperatorLocal<dim, fe_degree, Number, operator_type> local_operator;
     matrix_free.cell_loop(local_operator, src, dst);
   }
 
@@ -251,8 +287,11 @@ run(const unsigned int n_refinements)
 
   table.add_value("n_dofs", dof_handler.n_dofs());
 
-  AffineConstraints<Number>                         constraints;
-  LaplaceOperator<dim, degree, Number, MemorySpace> laplace_operator;
+  AffineConstraints<Number> constraints;
+  LaplaceOperator<dim, degree, Number, MemorySpace, OperatorType::laplace>
+    laplace_operator;
+  LaplaceOperator<dim, degree, Number, MemorySpace, OperatorType::helmholtz>
+    helmholtz_operator;
 
   std::chrono::time_point<std::chrono::system_clock> now_setup =
     std::chrono::system_clock::now();
@@ -268,6 +307,8 @@ run(const unsigned int n_refinements)
   dt_setup = Utilities::MPI::sum(dt_setup, MPI_COMM_WORLD) /
              Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
 
+  helmholtz_operator.reinit(mapping, dof_handler, constraints, quadrature);
+
   VectorType src, dst;
 
   laplace_operator.initialize_dof_vector(src);
@@ -288,25 +329,32 @@ run(const unsigned int n_refinements)
     dst = 0.0;
   }
 
-  const std::chrono::time_point<std::chrono::system_clock> now_vmult =
-    std::chrono::system_clock::now();
+  const auto time_vmult = [&](const auto &op) {
+    const std::chrono::time_point<std::chrono::system_clock> now_vmult =
+      std::chrono::system_clock::now();
 
-  for (unsigned int i = 0; i < n_repetitions_vmult; ++i)
-    laplace_operator.vmult(dst, src);
+    for (unsigned int i = 0; i < n_repetitions_vmult; ++i)
+      op.vmult(dst, src);
 
-  double dt_vmult = std::chrono::duration_cast<std::chrono::nanoseconds>(
-                      std::chrono::system_clock::now() - now_vmult)
-                      .count() /
-                    1e9;
+    const double dt_vmult =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now() - now_vmult)
+        .count() /
+      1e9;
 
-  dt_vmult = Utilities::MPI::sum(dt_vmult, MPI_COMM_WORLD) /
-             Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+    return Utilities::MPI::sum(dt_vmult, MPI_COMM_WORLD) /
+           Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD);
+  };
 
+  const double dt_vmult_laplace   = time_vmult(laplace_operator);
+  const double dt_vmult_helmholtz = time_vmult(helmholtz_operator);
 
   table.add_value("time_setup", dt_setup);
   table.set_scientific("time_setup", true);
-  table.add_value("time_avg", dt_vmult);
+  table.add_value("time_avg", dt_vmult_laplace);
   table.set_scientific("time_avg", true);
+  table.add_value("time_helmholtz", dt_vmult_helmholtz);
+  table.set_scientific("time_helmholtz", true);
 
   if (Utilities::MPI::this_mpi_process(comm) == 0)
     {
@@ -316,7 +364,7 @@ run(const unsigned int n_refinements)
 #endif
     }
 
-  return {dt_setup, dt_vmult};
+  return {dt_setup, dt_vmult_laplace, dt_vmult_helmholtz};
 }
 
 
@@ -325,7 +373,12 @@ describe_measurements()
 {
   return {Metric::timing,
           4,
-          {"mf_setup", "mf_vmult", "mf_kokkos_setup", "mf_kokkos_vmult"}};
+          {"mf_setup",
+           "mf_vmult",
+           "mf_helmholtz_vmult",
+           "mf_kokkos_setup",
+           "mf_kokkos_vmult",
+           "mf_kokkos_helmholtz_vmult"}};
 }
 
 Measurement
@@ -349,5 +402,10 @@ perform_single_measurement()
   const auto result0 = run<dim, fe_degree, MemorySpace::Host>(n_refinements);
   const auto result1 = run<dim, fe_degree, MemorySpace::Default>(n_refinements);
 
-  return {result0[0], result0[1], result1[0], result1[1]};
+  return {result0[0],
+          result0[1],
+          result0[2],
+          result1[0],
+          result1[1],
+          result1[2]};
 }
@@ -0,0 +1,217 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+//
+// Description:
+//
+// A performance benchmark for the polynomial multigrid transfer of the
+// global-coarsening framework on a hp-mesh. The cells of a 3d mesh are
+// assigned continuous elements with polynomial degrees between 2 and 8, and
+// the coarse level is obtained by bisection of the degree on each cell. This
+// gives many transfer schemes with few cells each per MPI process. The
+// prolongation and restriction are measured both with the default transfer,
+// which processes each pair of degrees separately, and with the transfer
+// combining cells of different degrees within the SIMD lanes
+// (MGTwoLevelTransfer::enable_mixed_degree_batching()).
+//
+// Status: experimental
+//
+
+#include <deal.II/base/timer.h>
+
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/hp/fe_collection.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/multigrid/mg_transfer_global_coarsening.h>
+
+#define ENABLE_MPI
+
+#include "performance_test_driver.h"
+
+using namespace dealii;
+
+
+
+template <int dim>
+Measurement
+run(const unsigned int n_refinements)
+{
+  using Number     = double;
+  using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+  std::map<std::string, dealii::Timer> timer;
+
+  parallel::distributed::Triangulation<dim> tria(MPI_COMM_WORLD);
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(n_refinements);
+
+  const unsigned int    max_degree = 8;
+  hp::FECollection<dim> fe_collection;
+  for (unsigned int degree = 1; degree <= max_degree; ++degree)
+    fe_collection.push_back(FE_Q<dim>(degree));
+
+  DoFHandler<dim> dof_handler_fine(tria);
+  DoFHandler<dim> dof_handler_coarse(tria);
+
+  // pseudo-random degrees between 2 and 8 on the fine level, bisection on
+  // the coarse level
+  {
+    auto cell_coarse = dof_handler_coarse.begin_active();
+    for (const auto &cell : dof_handler_fine.active_cell_iterators())
+      {
+        if (cell->is_locally_owned())
+          {
+            const unsigned int degree =
+              2 + (cell->active_cell_index() * 5 + 3) % (max_degree - 1);
+            cell->set_active_fe_index(degree - 1);
+            cell_coarse->set_active_fe_index(
+              MGTransferGlobalCoarseningTools::
+                create_next_polynomial_coarsening_degree(
+                  degree,
+                  MGTransferGlobalCoarseningTools::
+                    PolynomialCoarseningSequenceType::bisect) -
+              1);
+          }
+        ++cell_coarse;
+      }
+  }
+
+  dof_handler_fine.distribute_dofs(fe_collection);
+  dof_handler_coarse.distribute_dofs(fe_collection);
+
+  AffineConstraints<Number> constraints_fine(
+    dof_handler_fine.locally_owned_dofs(),
+    DoFTools::extract_locally_relevant_dofs(dof_handler_fine));
+  DoFTools::make_hanging_node_constraints(dof_handler_fine, constraints_fine);
+  constraints_fine.close();
+
+  AffineConstraints<Number> constraints_coarse(
+    dof_handler_coarse.locally_owned_dofs(),
+    DoFTools::extract_locally_relevant_dofs(dof_handler_coarse));
+  DoFTools::make_hanging_node_constraints(dof_handler_coarse,
+                                          constraints_coarse);
+  constraints_coarse.close();
+
+  MGTwoLevelTransfer<dim, VectorType> transfer;
+  timer["setup_transfer"].start();
+  transfer.reinit(dof_handler_fine,
+                  dof_handler_coarse,
+                  constraints_fine,
+                  constraints_coarse);
+  timer["setup_transfer"].stop();
+
+  MGTwoLevelTransfer<dim, VectorType> transfer_batched;
+  timer["setup_transfer_batched"].start();
+  transfer_batched.enable_mixed_degree_batching();
+  transfer_batched.reinit(dof_handler_fine,
+                          dof_handler_coarse,
+                          constraints_fine,
+                          constraints_coarse);
+  timer["setup_transfer_batched"].stop();
+
+  VectorType vec_coarse(dof_handler_coarse.locally_owned_dofs(),
+                        DoFTools::extract_locally_relevant_dofs(
+                          dof_handler_coarse),
+                        MPI_COMM_WORLD);
+  VectorType vec_fine(dof_handler_fine.locally_owned_dofs(),
+                      DoFTools::extract_locally_relevant_dofs(
+                        dof_handler_fine),
+                      MPI_COMM_WORLD);
+  VectorType vec_coarse_batched(vec_coarse), vec_fine_batched(vec_fine);
+
+  const unsigned int n_repeat = 100;
+
+  const auto measure = [&](const MGTwoLevelTransfer<dim, VectorType> &t,
+                           VectorType                                &fine,
+                           VectorType                                &coarse,
+                           const std::string                         &name) {
+    coarse = 1.;
+    timer["prolongate" + name].start();
+    for (unsigned int i = 0; i < n_repeat; ++i)
+      {
+        fine = 0.;
+        t.prolongate_and_add(fine, coarse);
+      }
+    timer["prolongate" + name].stop();
+
+    timer["restrict" + name].start();
+    for (unsigned int i = 0; i < n_repeat; ++i)
+      {
+        coarse = 0.;
+        t.restrict_and_add(coarse, fine);
+      }
+    timer["restrict" + name].stop();
+  };
+
+  measure(transfer, vec_fine, vec_coarse, "");
+  measure(transfer_batched, vec_fine_batched, vec_coarse_batched, "_batched");
+
+  // both variants must give the same result
+  vec_coarse_batched -= vec_coarse;
+  AssertThrow(vec_coarse_batched.linfty_norm() <
+                1e-10 * vec_coarse.linfty_norm(),
+              ExcMessage("Transfer with mixed-degree batches is wrong"));
+
+  return {timer["setup_transfer"].wall_time(),
+          timer["setup_transfer_batched"].wall_time(),
+          timer["prolongate"].wall_time(),
+          timer["restrict"].wall_time(),
+          timer["prolongate_batched"].wall_time(),
+          timer["restrict_batched"].wall_time()};
+}
+
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          4,
+          {"setup_transfer",
+           "setup_transfer_batched",
+           "prolongate",
+           "restrict",
+           "prolongate_batched",
+           "restrict_batched"}};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        return run<3>(3);
+      case TestingEnvironment::medium:
+        return run<3>(4);
+      case TestingEnvironment::heavy:
+        return run<3>(5);
+    }
+
+  return run<3>(3);
+}
@@ -0,0 +1,216 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+// Evaluate values and gradients of several solution vectors at a fixed set
+// of points with VectorTools::PointEvaluationCache. The values are compared
+// to VectorTools::point_values(). The gradients are compared to the exact
+// gradients of linear functions, which the isoparametric finite element
+// spaces in this test represent exactly.
+
+#include <deal.II/base/function.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/numerics/vector_tools.h>
+#include <deal.II/numerics/vector_tools_evaluate.h>
+
+#include "../tests.h"
+
+
+double
+difference(const double a, const double b)
+{
+  return std::abs(a - b);
+}
+
+
+
+template <int rank, int dim, typename Number>
+double
+difference(const Tensor<rank, dim, Number> &a,
+           const Tensor<rank, dim, Number> &b)
+{
+  double result = 0.;
+  for (unsigned int i = 0; i < dim; ++i)
+    result = std::max(result, difference(a[i], b[i]));
+  return result;
+}
+
+
+
+template <typename T>
+double
+max_difference(const std::vector<T> &a, const std::vector<T> &b)
+{
+  AssertDimension(a.size(), b.size());
+  double result = 0.;
+  for (unsigned int i = 0; i < a.size(); ++i)
+    result = std::max(result, difference(a[i], b[i]));
+  return result;
+}
+
+
+
+// a linear function whose component c is (c+1) * (0.5 + x + 2y + 3z)
+template <int dim>
+class LinearFunction : public Function<dim>
+{
+public:
+  LinearFunction(const unsigned int n_components = 1)
+    : Function<dim>(n_components)
+  {}
+
+  virtual double
+  value(const Point<dim> &p, const unsigned int component = 0) const override
+  {
+    double result = 0.5;
+    for (unsigned int d = 0; d < dim; ++d)
+      result += (d + 1.) * p[d];
+    return (component + 1.) * result;
+  }
+
+  virtual Tensor<1, dim>
+  gradient(const Point<dim> &,
+           const unsigned int component = 0) const override
+  {
+    Tensor<1, dim> result;
+    for (unsigned int d = 0; d < dim; ++d)
+      result[d] = (component + 1.) * (d + 1.);
+    return result;
+  }
+};
+
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_ball(tria);
+  tria.refine_global(2);
+
+  const MappingQ<dim> mapping(2);
+
+  // points on a lattice, including points on vertices and faces of the mesh
+  std::vector<Point<dim>> points;
+  for (unsigned int i = 0; i < std::pow(9, dim); ++i)
+    {
+      Point<dim>   p;
+      unsigned int index = i;
+      for (unsigned int d = 0; d < dim; ++d, index /= 9)
+        p[d] = -0.4 + 0.1 * (index % 9);
+      points.push_back(p);
+    }
+
+  VectorTools::PointEvaluationCache<dim> cache;
+  cache.reinit(points, tria, mapping);
+  deallog << "dim=" << dim << ", all points found: "
+          << cache.get_remote_point_evaluation().all_points_found()
+          << std::endl;
+
+  Utilities::MPI::RemotePointEvaluation<dim> reference_cache;
+  reference_cache.reinit(points, tria, mapping);
+
+  // a scalar element with two solution vectors
+  {
+    DoFHandler<dim> dof_handler(tria);
+    dof_handler.distribute_dofs(FE_Q<dim>(2));
+
+    const LinearFunction<dim>   function;
+    std::vector<Tensor<1, dim>> exact_gradients(points.size());
+    for (unsigned int p = 0; p < points.size(); ++p)
+      exact_gradients[p] = function.gradient(points[p]);
+
+    for (unsigned int i = 0; i < 2; ++i)
+      {
+        Vector<double> vector(dof_handler.n_dofs());
+        VectorTools::interpolate(mapping, dof_handler, function, vector);
+        vector *= 1. + i;
+
+        const auto values = cache.template point_values<1>(dof_handler, vector);
+        const auto gradients =
+          cache.template point_gradients<1>(dof_handler, vector);
+
+        std::vector<Tensor<1, dim>> scaled_gradients(exact_gradients);
+        for (auto &gradient : scaled_gradients)
+          gradient *= 1. + i;
+
+        deallog << "FE_Q(2), vector " << i << ": values agree: "
+                << (max_difference(values,
+                                   VectorTools::point_values<1>(
+                                     reference_cache, dof_handler, vector)) <
+                    1e-12)
+                << ", gradients exact: "
+                << (max_difference(gradients, scaled_gradients) < 1e-10)
+                << std::endl;
+      }
+  }
+
+  // a vector-valued element on the same mesh, selecting the second and third
+  // components
+  {
+    DoFHandler<dim> dof_handler(tria);
+    dof_handler.distribute_dofs(FESystem<dim>(FE_Q<dim>(2), 3));
+
+    const LinearFunction<dim> function(3);
+    Vector<double>            vector(dof_handler.n_dofs());
+    VectorTools::interpolate(mapping, dof_handler, function, vector);
+
+    const auto values = cache.template point_values<2>(
+      dof_handler, vector, VectorTools::EvaluationFlags::avg, 1);
+    const auto gradients = cache.template point_gradients<2>(
+      dof_handler, vector, VectorTools::EvaluationFlags::avg, 1);
+
+    auto exact_gradients = gradients;
+    for (unsigned int p = 0; p < points.size(); ++p)
+      for (unsigned int c = 0; c < 2; ++c)
+        exact_gradients[p][c] = function.gradient(points[p], c + 1);
+
+    deallog << "FESystem, components 1-2: values agree: "
+            << (max_difference(values,
+                               VectorTools::point_values<2>(
+                                 reference_cache,
+                                 dof_handler,
+                                 vector,
+                                 VectorTools::EvaluationFlags::avg,
+                                 1)) < 1e-12)
+            << ", gradients exact: "
+            << (max_difference(gradients, exact_gradients) < 1e-10)
+            << std::endl;
+  }
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+  initlog();
+
+  test<2>();
+  test<3>();
+}
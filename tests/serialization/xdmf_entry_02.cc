@@ -0,0 +1,89 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+// check serialization for XDMFEntry with the group of the solution file,
+// and that archives written before the group was added can still be read
+
+#include <deal.II/base/data_out_base.h>
+
+#include "serialization.h"
+
+XDMFEntry
+create_entry()
+{
+  XDMFEntry entry("mesh.h5",
+                  "solution.h5",
+                  0.5,
+                  128,
+                  16,
+                  2,
+                  3,
+                  ReferenceCells::Quadrilateral);
+  entry.add_attribute("u", 1);
+  return entry;
+}
+
+
+
+void
+test()
+{
+  XDMFEntry entry1 = create_entry();
+  entry1.set_solution_group("step_3");
+  XDMFEntry entry2;
+
+  std::ostringstream oss;
+  {
+    boost::archive::text_oarchive oa(oss, boost::archive::no_header);
+    oa << entry1;
+  }
+  {
+    std::istringstream            iss(oss.str());
+    boost::archive::text_iarchive ia(iss, boost::archive::no_header);
+    ia >> entry2;
+  }
+  deallog << "solution group restored: "
+          << (entry2.get_xdmf_content(0) == entry1.get_xdmf_content(0))
+          << std::endl;
+
+  // an archive of the entry returned by create_entry() in version 0 of the
+  // format, which did not contain the group of the solution file
+  const std::string version_0_archive =
+    "0 0 1 11 solution.h5 7 mesh.h5 5.00000000000000000e-01 128 16 2 3 0 0 "
+    "3 0 0 1 0 0 0 1 u 1";
+  XDMFEntry entry3;
+  entry3.set_solution_group("step_3");
+  {
+    std::istringstream            iss(version_0_archive);
+    boost::archive::text_iarchive ia(iss, boost::archive::no_header);
+    ia >> entry3;
+  }
+  deallog << "version 0 archive read: "
+          << (entry3.get_xdmf_content(0) == create_entry().get_xdmf_content(0))
+          << std::endl;
+  deallog << entry3.get_xdmf_content(0) << std::endl;
+}
+
+
+int
+main()
+{
+  initlog();
+
+  test();
+
+  deallog << "OK" << std::endl;
+}
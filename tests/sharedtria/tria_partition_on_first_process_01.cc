@@ -0,0 +1,103 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2023 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE.md at
+// the top level directory of deal.II.
+//
+// ---------------------------------------------------------------------
+
+
+// check that partitioning a shared triangulation only on the first process
+// (the partition_on_first_process flag) leads to the same partition as
+// partitioning it on every process, also after adaptive refinement
+
+#include <deal.II/distributed/shared_tria.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_accessor.h>
+#include <deal.II/grid/tria_iterator.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+compare(const parallel::shared::Triangulation<dim> &tria,
+        const parallel::shared::Triangulation<dim> &reference)
+{
+  bool same_subdomains = true;
+  for (auto cell = tria.begin_active(), ref_cell = reference.begin_active();
+       cell != tria.end();
+       ++cell, ++ref_cell)
+    if (cell->subdomain_id() != ref_cell->subdomain_id())
+      same_subdomains = false;
+
+  deallog << "same subdomain ids: " << same_subdomains << std::endl;
+  deallog << "same true subdomain ids: "
+          << (tria.get_true_subdomain_ids_of_cells() ==
+              reference.get_true_subdomain_ids_of_cells())
+          << std::endl;
+  deallog << "same number of locally owned cells: "
+          << (tria.n_locally_owned_active_cells() ==
+              reference.n_locally_owned_active_cells())
+          << std::endl;
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  using Tria = parallel::shared::Triangulation<dim>;
+
+  Tria reference(MPI_COMM_WORLD,
+                 Triangulation<dim>::limit_level_difference_at_vertices,
+                 true,
+                 typename Tria::Settings(Tria::partition_zorder));
+  Tria tria(MPI_COMM_WORLD,
+            Triangulation<dim>::limit_level_difference_at_vertices,
+            true,
+            typename Tria::Settings(Tria::partition_zorder |
+                                    Tria::partition_on_first_process));
+
+  GridGenerator::subdivided_hyper_cube(reference, 2, -1, 1);
+  GridGenerator::subdivided_hyper_cube(tria, 2, -1, 1);
+  reference.refine_global(2);
+  tria.refine_global(2);
+
+  deallog << "dim=" << dim << ", uniform:" << std::endl;
+  compare(tria, reference);
+
+  // refine the cells close to the origin in both meshes
+  for (Tria *t : {&reference, &tria})
+    {
+      for (const auto &cell : t->active_cell_iterators())
+        if (cell->center().norm() < 0.5)
+          cell->set_refine_flag();
+      t->execute_coarsening_and_refinement();
+    }
+
+  deallog << "dim=" << dim << ", adaptive:" << std::endl;
+  compare(tria, reference);
+}
+
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  test<2>();
+  test<3>();
+}